@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API HoistIfCommonOps;
+
+}  // namespace pass
+}  // namespace ov
+
+// clang-format off
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief The transformation moves out of 'If' operations the computations which are performed by both bodies
+ * on the same 'If' inputs. Such operations are executed regardless of the condition, so they are computed once
+ * in the outer model and their results are passed to the bodies as new 'If' inputs:
+ *
+ *          then_body: Parameter(x) -> A -> B -> Result              A -> then_body: Parameter(a) -> B -> Result
+ *  x ->                                                  =>   x -> |
+ *          else_body: Parameter(x) -> A -> C -> Result              A -> else_body: Parameter(a) -> C -> Result
+ *
+ * Operations are considered the same if they have the same type and attributes, and their inputs are
+ * either the same values or equal constants.
+ */
+// clang-format on
+
+class ov::pass::HoistIfCommonOps : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("HoistIfCommonOps", "0");
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
@@ -280,6 +280,10 @@ TRANSFORMATIONS_API bool is_on_constant_path(const ov::Output<ov::Node>& output)
 
 TRANSFORMATIONS_API bool process_subgraph(ov::pass::ModelPass& model_pass, const std::shared_ptr<Node>& node);
 
+/// \brief Compares the attributes of two nodes of the same type, rt_info is not taken into account.
+/// Returns false if some attribute can't be compared.
+TRANSFORMATIONS_API bool have_equal_attributes(const std::shared_ptr<Node>& lhs, const std::shared_ptr<Node>& rhs);
+
 template <typename T>
 ov::pass::pattern::op::ValuePredicate constant_predicate(std::function<bool(const std::vector<T>&)> predicate) {
     return pass::pattern::op::as_value_predicate([=](std::shared_ptr<Node> n) -> bool {
@@ -60,6 +60,7 @@
 #include "transformations/common_optimizations/transpose_sinking.hpp"
 #include "transformations/common_optimizations/transpose_to_reshape.hpp"
 #include "transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp"
+#include "transformations/control_flow/hoist_if_common_ops.hpp"
 #include "transformations/control_flow/unroll_if.hpp"
 #include "transformations/fp16_compression/convert_compression_only_to_legacy.hpp"
 #include "transformations/fp16_compression/mark_decompression_convert_constant_folding.hpp"
@@ -185,6 +186,7 @@ bool ov::pass::CommonOptimizations::run_on_model(const std::shared_ptr<ov::Model
     // LinOpSequenceFusion must be executed after all decompositions
     manager.register_pass<LinOpSequenceFusion>();
     REGISTER_PASS(manager, UnrollIf)
+    REGISTER_DISABLED_PASS(manager, HoistIfCommonOps)
 
     auto multiply_fusions = manager.register_pass<GraphRewrite>();
     ADD_MATCHER(multiply_fusions, ConvolutionMultiplyFusion)
@@ -8,50 +8,13 @@
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/shape_of.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "transformations/utils/utils.hpp"
 
 using namespace std;
 using namespace ov;
 using namespace ov::op;
 
 namespace {
-#define ACCESSOR(type)                                                                \
-    void on_adapter(const std::string& name, ValueAccessor<type>& adapter) override { \
-        m_attributes_map[name] = adapter.get();                                       \
-    };
-#define ACCESSOR_V(type) ACCESSOR(type) ACCESSOR(std::vector<type>)
-
-class NodeComparingVisitor : public ov::AttributeVisitor {
-public:
-    ACCESSOR(bool)
-    ACCESSOR_V(std::string)
-    ACCESSOR_V(int8_t)
-    ACCESSOR_V(int16_t)
-    ACCESSOR_V(int32_t)
-    ACCESSOR_V(int64_t)
-    ACCESSOR_V(uint8_t)
-    ACCESSOR_V(uint16_t)
-    ACCESSOR_V(uint32_t)
-    ACCESSOR_V(uint64_t)
-    ACCESSOR_V(float)
-    ACCESSOR_V(double)
-
-    void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("Can not compare void");
-    };
-    void on_adapter(const std::string& name, ValueAccessor<void*>& adapter) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("Can not compare void*");
-    };
-    void on_adapter(const std::string& name, ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("Can not compare models");
-    };
-    ov::AnyMap get_attributes_map() const {
-        return m_attributes_map;
-    };
-
-private:
-    ov::AnyMap m_attributes_map;
-};
-
 bool inputs_from_same_source_or_equal_constants(const std::shared_ptr<Node>& lhs, const std::shared_ptr<Node>& rhs) {
     if (lhs->get_input_size() != rhs->get_input_size())
         return false;
@@ -86,18 +49,8 @@ bool nodes_are_equal(const std::shared_ptr<Node>& lhs, const std::shared_ptr<Nod
     if (!rhs->get_control_dependents().empty() || !rhs->get_control_dependencies().empty())
         return false;
     // skip comparing rt_info. example: fused_name may have different strings
-    // compare attributes
-    try {
-        auto lhs_visitor = NodeComparingVisitor(), rhs_visitor = NodeComparingVisitor();
-        lhs->visit_attributes(lhs_visitor);
-        rhs->visit_attributes(rhs_visitor);
-        if (lhs_visitor.get_attributes_map() != rhs_visitor.get_attributes_map())
-            return false;
-    } catch (...) {
-        // we avoid errors during comparison of objects without equality operands
-        // assuming they are not equal
+    if (!ov::op::util::have_equal_attributes(lhs, rhs))
         return false;
-    }
     return inputs_from_same_source_or_equal_constants(lhs, rhs);
 }
 
@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/control_flow/hoist_if_common_ops.hpp"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <unordered_set>
+
+#include "itt.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/if.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sink.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/read_value_base.hpp"
+#include "transformations/utils/utils.hpp"
+
+namespace {
+using namespace ov;
+
+bool can_be_hoisted(const std::shared_ptr<Node>& op) {
+    if (is_type<op::v0::Parameter>(op) || is_type<op::v0::Result>(op) || is_type<op::v0::Constant>(op))
+        return false;
+    // stateful and control flow operations stay where they are
+    if (is_type<op::Sink>(op) || is_type<op::util::ReadValueBase>(op) || is_type<op::util::MultiSubGraphOp>(op))
+        return false;
+    return op->get_control_dependencies().empty() && op->get_control_dependents().empty();
+}
+
+bool constants_are_equal(const Output<Node>& lhs, const Output<Node>& rhs) {
+    auto lhs_constant = as_type_ptr<op::v0::Constant>(lhs.get_node_shared_ptr());
+    auto rhs_constant = as_type_ptr<op::v0::Constant>(rhs.get_node_shared_ptr());
+    if (!lhs_constant || !rhs_constant)
+        return false;
+    if (lhs_constant->get_element_type() != rhs_constant->get_element_type() ||
+        lhs_constant->get_shape() != rhs_constant->get_shape())
+        return false;
+    // buffer of string constants holds std::string objects, not their contents
+    if (lhs_constant->get_element_type() == element::string)
+        return lhs_constant->get_value_strings() == rhs_constant->get_value_strings();
+    return std::memcmp(lhs_constant->get_data_ptr(), rhs_constant->get_data_ptr(), lhs_constant->get_byte_size()) == 0;
+}
+
+using OutputMap = std::map<Output<Node>, Output<Node>>;
+
+bool inputs_correspond(const std::shared_ptr<Node>& then_op,
+                       const std::shared_ptr<Node>& else_op,
+                       const OutputMap& then_to_else) {
+    if (then_op->get_input_size() != else_op->get_input_size())
+        return false;
+    for (size_t i = 0; i < then_op->get_input_size(); ++i) {
+        const auto then_value = then_op->input_value(i);
+        const auto else_value = else_op->input_value(i);
+        const auto it = then_to_else.find(then_value);
+        if (it != then_to_else.end() ? it->second != else_value : !constants_are_equal(then_value, else_value))
+            return false;
+    }
+    return true;
+}
+
+bool hoist_common_ops(const std::shared_ptr<op::v8::If>& if_op) {
+    const auto& then_body = if_op->get_then_body();
+    const auto& else_body = if_op->get_else_body();
+
+    // then body value -> the same value in else body and in the outer model
+    OutputMap then_to_else, then_to_outer;
+    std::map<uint64_t, Output<Node>> else_params;
+    for (const auto& desc : if_op->get_input_descriptions(op::v8::If::ELSE_BODY_INDEX)) {
+        else_params[desc->m_input_index] = else_body->get_parameters()[desc->m_body_parameter_index]->output(0);
+    }
+    for (const auto& desc : if_op->get_input_descriptions(op::v8::If::THEN_BODY_INDEX)) {
+        const auto it = else_params.find(desc->m_input_index);
+        if (it == else_params.end())
+            continue;
+        const auto then_param = then_body->get_parameters()[desc->m_body_parameter_index]->output(0);
+        then_to_else[then_param] = it->second;
+        then_to_outer[then_param] = if_op->input_value(desc->m_input_index);
+    }
+
+    std::vector<std::shared_ptr<Node>> hoisted_ops;
+    std::unordered_set<Node*> hoisted_then_ops, hoisted_else_ops;
+    for (const auto& then_op : then_body->get_ordered_ops()) {
+        if (!can_be_hoisted(then_op))
+            continue;
+
+        // operations with constant inputs only are left for constant folding
+        Output<Node> else_anchor;
+        bool inputs_are_hoisted = true;
+        for (const auto& input_value : then_op->input_values()) {
+            const auto it = then_to_else.find(input_value);
+            if (it != then_to_else.end()) {
+                if (!else_anchor.get_node())
+                    else_anchor = it->second;
+            } else if (!is_type<op::v0::Constant>(input_value.get_node())) {
+                inputs_are_hoisted = false;
+                break;
+            }
+        }
+        if (!inputs_are_hoisted || !else_anchor.get_node())
+            continue;
+
+        std::shared_ptr<Node> else_op;
+        for (const auto& target_input : else_anchor.get_target_inputs()) {
+            auto candidate = target_input.get_node()->shared_from_this();
+            if (candidate->get_type_info() == then_op->get_type_info() && !hoisted_else_ops.count(candidate.get()) &&
+                can_be_hoisted(candidate) && inputs_correspond(then_op, candidate, then_to_else) &&
+                op::util::have_equal_attributes(then_op, candidate)) {
+                else_op = candidate;
+                break;
+            }
+        }
+        if (!else_op)
+            continue;
+
+        OutputVector outer_inputs;
+        for (const auto& input_value : then_op->input_values()) {
+            const auto it = then_to_outer.find(input_value);
+            if (it != then_to_outer.end()) {
+                outer_inputs.push_back(it->second);
+            } else {
+                auto constant = input_value.get_node()->clone_with_new_inputs({});
+                copy_runtime_info(input_value.get_node_shared_ptr(), constant);
+                outer_inputs.push_back(constant->output(input_value.get_index()));
+            }
+        }
+        auto outer_op = then_op->clone_with_new_inputs(outer_inputs);
+        outer_op->set_friendly_name(then_op->get_friendly_name());
+        copy_runtime_info({then_op, else_op}, outer_op);
+
+        for (size_t i = 0; i < then_op->get_output_size(); ++i) {
+            then_to_else[then_op->output(i)] = else_op->output(i);
+            then_to_outer[then_op->output(i)] = outer_op->output(i);
+        }
+        hoisted_ops.push_back(then_op);
+        hoisted_then_ops.insert(then_op.get());
+        hoisted_else_ops.insert(else_op.get());
+    }
+
+    // only the values which are still used in a body become new inputs of If, the rest of the hoisted ops
+    // become unreachable from the body results
+    const auto has_other_consumers = [](const Output<Node>& value, const std::unordered_set<Node*>& hoisted) {
+        for (const auto& target_input : value.get_target_inputs()) {
+            if (!hoisted.count(target_input.get_node()))
+                return true;
+        }
+        return false;
+    };
+    bool is_changed = false;
+    for (const auto& then_op : hoisted_ops) {
+        for (auto then_value : then_op->outputs()) {
+            auto else_value = then_to_else.at(then_value);
+            if (!has_other_consumers(then_value, hoisted_then_ops) && !has_other_consumers(else_value, hoisted_else_ops))
+                continue;
+
+            const auto& outer_value = then_to_outer.at(then_value);
+            auto then_param = std::make_shared<op::v0::Parameter>(outer_value.get_element_type(),
+                                                                  outer_value.get_partial_shape());
+            auto else_param = std::make_shared<op::v0::Parameter>(outer_value.get_element_type(),
+                                                                  outer_value.get_partial_shape());
+            then_body->add_parameters({then_param});
+            else_body->add_parameters({else_param});
+            // hoisted consumers are switched to the parameters too, it doesn't matter as they are not used anymore
+            then_value.replace(then_param->output(0));
+            else_value.replace(else_param->output(0));
+            if_op->set_input(outer_value, then_param, else_param);
+            is_changed = true;
+        }
+    }
+
+    if (is_changed)
+        if_op->validate_and_infer_types();
+    return is_changed;
+}
+}  // namespace
+
+bool ov::pass::HoistIfCommonOps::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    RUN_ON_FUNCTION_SCOPE(HoistIfCommonOps);
+    bool is_changed = false;
+    for (const auto& op : f->get_ordered_ops()) {
+        is_changed = ov::op::util::process_subgraph(*this, op) || is_changed;
+
+        auto if_op = ov::as_type_ptr<ov::op::v8::If>(op);
+        if (!if_op || transformation_callback(if_op))
+            continue;
+        is_changed = hoist_common_ops(if_op) || is_changed;
+    }
+    return is_changed;
+}
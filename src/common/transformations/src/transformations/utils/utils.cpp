@@ -23,6 +23,44 @@ namespace op {
 namespace util {
 
 namespace {
+#define ACCESSOR(type)                                                                \
+    void on_adapter(const std::string& name, ValueAccessor<type>& adapter) override { \
+        m_attributes_map[name] = adapter.get();                                       \
+    };
+#define ACCESSOR_V(type) ACCESSOR(type) ACCESSOR(std::vector<type>)
+
+class NodeComparingVisitor : public ov::AttributeVisitor {
+public:
+    ACCESSOR(bool)
+    ACCESSOR_V(std::string)
+    ACCESSOR_V(int8_t)
+    ACCESSOR_V(int16_t)
+    ACCESSOR_V(int32_t)
+    ACCESSOR_V(int64_t)
+    ACCESSOR_V(uint8_t)
+    ACCESSOR_V(uint16_t)
+    ACCESSOR_V(uint32_t)
+    ACCESSOR_V(uint64_t)
+    ACCESSOR_V(float)
+    ACCESSOR_V(double)
+
+    void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override {
+        OPENVINO_THROW_NOT_IMPLEMENTED("Can not compare void");
+    };
+    void on_adapter(const std::string& name, ValueAccessor<void*>& adapter) override {
+        OPENVINO_THROW_NOT_IMPLEMENTED("Can not compare void*");
+    };
+    void on_adapter(const std::string& name, ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        OPENVINO_THROW_NOT_IMPLEMENTED("Can not compare models");
+    };
+    ov::AnyMap get_attributes_map() const {
+        return m_attributes_map;
+    };
+
+private:
+    ov::AnyMap m_attributes_map;
+};
+
 void visit_path_impl(ov::Node* node,
                      std::unordered_set<ov::Node*>& visited,
                      std::function<void(ov::Node*)> func,
@@ -462,6 +500,19 @@ bool is_on_constant_path(const ov::Output<ov::Node>& output) {
     return status;
 }
 
+bool have_equal_attributes(const std::shared_ptr<Node>& lhs, const std::shared_ptr<Node>& rhs) {
+    try {
+        auto lhs_visitor = NodeComparingVisitor(), rhs_visitor = NodeComparingVisitor();
+        lhs->visit_attributes(lhs_visitor);
+        rhs->visit_attributes(rhs_visitor);
+        return lhs_visitor.get_attributes_map() == rhs_visitor.get_attributes_map();
+    } catch (...) {
+        // we avoid errors during comparison of objects without equality operands
+        // assuming they are not equal
+        return false;
+    }
+}
+
 bool process_subgraph(ov::pass::ModelPass& model_pass, const std::shared_ptr<Node>& node) {
     bool changed = false;
 
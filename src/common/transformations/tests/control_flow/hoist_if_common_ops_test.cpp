@@ -0,0 +1,219 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/control_flow/hoist_if_common_ops.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/if.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+
+using namespace ov;
+using namespace ov::op;
+using namespace testing;
+
+TEST_F(TransformationTestsF, HoistIfCommonOps) {
+    auto X = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto Y = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto cond = std::make_shared<v0::Parameter>(element::boolean, Shape{1});
+    {
+        auto Xt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Yt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto then_relu = std::make_shared<v0::Relu>(Xt);
+        auto then_add = std::make_shared<v1::Add>(then_relu, Yt);
+        auto then_res = std::make_shared<v0::Result>(then_add);
+        auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt, Yt});
+
+        auto Xe = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Ye = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto else_relu = std::make_shared<v0::Relu>(Xe);
+        auto else_mul = std::make_shared<v1::Multiply>(else_relu, Ye);
+        auto else_res = std::make_shared<v0::Result>(else_mul);
+        auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe, Ye});
+
+        auto if_op = std::make_shared<v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(X, Xt, Xe);
+        if_op->set_input(Y, Yt, Ye);
+        auto res = if_op->set_output(then_res, else_res);
+        model = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, Y, cond});
+
+        manager.register_pass<ov::pass::HoistIfCommonOps>();
+    }
+    {
+        auto relu = std::make_shared<v0::Relu>(X);
+
+        auto Xt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Yt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Rt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto then_add = std::make_shared<v1::Add>(Rt, Yt);
+        auto then_res = std::make_shared<v0::Result>(then_add);
+        auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt, Yt, Rt});
+
+        auto Xe = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Ye = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Re = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto else_mul = std::make_shared<v1::Multiply>(Re, Ye);
+        auto else_res = std::make_shared<v0::Result>(else_mul);
+        auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe, Ye, Re});
+
+        auto if_op = std::make_shared<v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(X, Xt, Xe);
+        if_op->set_input(Y, Yt, Ye);
+        if_op->set_input(relu, Rt, Re);
+        auto res = if_op->set_output(then_res, else_res);
+        model_ref = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, Y, cond});
+    }
+}
+
+TEST_F(TransformationTestsF, HoistIfCommonOpsChainWithConstants) {
+    auto X = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto cond = std::make_shared<v0::Parameter>(element::boolean, Shape{1});
+    {
+        auto Xt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto then_order = v0::Constant::create(element::i64, Shape{2}, {1, 0});
+        auto then_transpose = std::make_shared<v1::Transpose>(Xt, then_order);
+        auto then_add = std::make_shared<v1::Add>(then_transpose, v0::Constant::create(element::f32, Shape{}, {1}));
+        auto then_mul = std::make_shared<v1::Multiply>(then_add, v0::Constant::create(element::f32, Shape{}, {2}));
+        auto then_res = std::make_shared<v0::Result>(then_mul);
+        auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt});
+
+        auto Xe = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto else_order = v0::Constant::create(element::i64, Shape{2}, {1, 0});
+        auto else_transpose = std::make_shared<v1::Transpose>(Xe, else_order);
+        auto else_add = std::make_shared<v1::Add>(else_transpose, v0::Constant::create(element::f32, Shape{}, {1}));
+        auto else_sub = std::make_shared<v1::Subtract>(else_add, v0::Constant::create(element::f32, Shape{}, {2}));
+        auto else_res = std::make_shared<v0::Result>(else_sub);
+        auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe});
+
+        auto if_op = std::make_shared<v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(X, Xt, Xe);
+        auto res = if_op->set_output(then_res, else_res);
+        model = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, cond});
+
+        manager.register_pass<ov::pass::HoistIfCommonOps>();
+    }
+    {
+        auto order = v0::Constant::create(element::i64, Shape{2}, {1, 0});
+        auto transpose = std::make_shared<v1::Transpose>(X, order);
+        auto add = std::make_shared<v1::Add>(transpose, v0::Constant::create(element::f32, Shape{}, {1}));
+
+        auto Xt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto At = std::make_shared<v0::Parameter>(element::f32, Shape{3, 2});
+        auto then_mul = std::make_shared<v1::Multiply>(At, v0::Constant::create(element::f32, Shape{}, {2}));
+        auto then_res = std::make_shared<v0::Result>(then_mul);
+        auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt, At});
+
+        auto Xe = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+        auto Ae = std::make_shared<v0::Parameter>(element::f32, Shape{3, 2});
+        auto else_sub = std::make_shared<v1::Subtract>(Ae, v0::Constant::create(element::f32, Shape{}, {2}));
+        auto else_res = std::make_shared<v0::Result>(else_sub);
+        auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe, Ae});
+
+        auto if_op = std::make_shared<v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(X, Xt, Xe);
+        if_op->set_input(add, At, Ae);
+        auto res = if_op->set_output(then_res, else_res);
+        model_ref = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, cond});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, HoistIfCommonOpsStringConstants) {
+    auto X = std::make_shared<v0::Parameter>(element::string, Shape{2});
+    auto cond = std::make_shared<v0::Parameter>(element::boolean, Shape{1});
+    {
+        auto Xt = std::make_shared<v0::Parameter>(element::string, Shape{2});
+        auto then_suffix = v0::Constant::create(element::string, Shape{2}, std::vector<std::string>{"a", "b"});
+        auto then_concat = std::make_shared<v0::Concat>(OutputVector{Xt, then_suffix}, 0);
+        auto then_res = std::make_shared<v0::Result>(std::make_shared<v0::Concat>(OutputVector{then_concat, Xt}, 0));
+        auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt});
+
+        // equal strings in a separately allocated constant
+        auto Xe = std::make_shared<v0::Parameter>(element::string, Shape{2});
+        auto else_suffix = v0::Constant::create(element::string, Shape{2}, std::vector<std::string>{"a", "b"});
+        auto else_concat = std::make_shared<v0::Concat>(OutputVector{Xe, else_suffix}, 0);
+        auto else_res = std::make_shared<v0::Result>(std::make_shared<v0::Concat>(OutputVector{Xe, else_concat}, 0));
+        auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe});
+
+        auto if_op = std::make_shared<v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(X, Xt, Xe);
+        auto res = if_op->set_output(then_res, else_res);
+        model = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, cond});
+
+        manager.register_pass<ov::pass::HoistIfCommonOps>();
+    }
+    {
+        auto suffix = v0::Constant::create(element::string, Shape{2}, std::vector<std::string>{"a", "b"});
+        auto concat = std::make_shared<v0::Concat>(OutputVector{X, suffix}, 0);
+
+        auto Xt = std::make_shared<v0::Parameter>(element::string, Shape{2});
+        auto Ct = std::make_shared<v0::Parameter>(element::string, Shape{4});
+        auto then_res = std::make_shared<v0::Result>(std::make_shared<v0::Concat>(OutputVector{Ct, Xt}, 0));
+        auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt, Ct});
+
+        auto Xe = std::make_shared<v0::Parameter>(element::string, Shape{2});
+        auto Ce = std::make_shared<v0::Parameter>(element::string, Shape{4});
+        auto else_res = std::make_shared<v0::Result>(std::make_shared<v0::Concat>(OutputVector{Xe, Ce}, 0));
+        auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe, Ce});
+
+        auto if_op = std::make_shared<v8::If>(cond);
+        if_op->set_then_body(then_body);
+        if_op->set_else_body(else_body);
+        if_op->set_input(X, Xt, Xe);
+        if_op->set_input(concat, Ct, Ce);
+        auto res = if_op->set_output(then_res, else_res);
+        model_ref = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, cond});
+    }
+}
+
+TEST_F(TransformationTestsF, HoistIfCommonOpsDifferentInputs) {
+    auto X = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto Y = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto cond = std::make_shared<v0::Parameter>(element::boolean, Shape{1});
+
+    auto Xt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto Yt = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto then_add = std::make_shared<v1::Add>(Xt, Yt);
+    auto then_res = std::make_shared<v0::Result>(then_add);
+    auto then_body = std::make_shared<Model>(OutputVector{then_res}, ParameterVector{Xt, Yt});
+
+    // the same operation, but on the swapped inputs
+    auto Xe = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto Ye = std::make_shared<v0::Parameter>(element::f32, Shape{2, 3});
+    auto else_add = std::make_shared<v1::Add>(Ye, Xe);
+    auto else_mul = std::make_shared<v1::Multiply>(else_add, v0::Constant::create(element::f32, Shape{}, {3}));
+    auto else_res = std::make_shared<v0::Result>(else_mul);
+    auto else_body = std::make_shared<Model>(OutputVector{else_res}, ParameterVector{Xe, Ye});
+
+    auto if_op = std::make_shared<v8::If>(cond);
+    if_op->set_then_body(then_body);
+    if_op->set_else_body(else_body);
+    if_op->set_input(X, Xt, Xe);
+    if_op->set_input(Y, Yt, Ye);
+    auto res = if_op->set_output(then_res, else_res);
+    model = std::make_shared<Model>(OutputVector{res}, ParameterVector{X, Y, cond});
+
+    manager.register_pass<ov::pass::HoistIfCommonOps>();
+}
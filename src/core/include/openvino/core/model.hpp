@@ -107,7 +107,7 @@ public:
     /// based on traversing the graph from the results and the sinks.
     Model(const ov::OutputVector& results, const ov::SinkVector& sinks, const std::string& name = "");
 
-    virtual ~Model() = default;
+    virtual ~Model();
     /// Return the number of outputs for this Model.
     size_t get_output_size() const;
 
@@ -529,6 +529,25 @@ private:
     const ov::AnyMap& get_map_from_attr(const ov::Any& info) const;
     ov::AnyMap& get_map_from_attr(ov::Any& info) const;
 
+    /// \brief Constructs a Model with already known topological order of operations, e.g. a clone
+    /// of another model, so the order is not computed again.
+    Model(const ov::ResultVector& results,
+          const ov::SinkVector& sinks,
+          const ov::ParameterVector& parameters,
+          const ov::op::util::VariableVector& variables,
+          const std::string& name,
+          const std::vector<std::shared_ptr<ov::Node>>& ordered_ops);
+
+    /// \brief Returns Results, Sinks and Parameters the topological sort starts from.
+    ov::NodeVector get_topological_sort_roots() const;
+
+    /// \brief Checks that the nodes are in a valid topological order and that they are the same nodes
+    /// as the full topological sort of the model gives.
+    bool is_valid_topological_order(const ov::NodeVector& nodes) const;
+
+    /// \brief Removes nodes which became unreachable after graph edits from the topological nodes order cache.
+    void remove_detached_ops() const;
+
     /// \brief Depending on the options selected,
     /// checks all the Parameter/Variables are registered in the list of Model
     /// parameters/variables or finds all Parameters/Variables in a model and registers them.
@@ -552,17 +571,11 @@ private:
     ov::op::util::VariableVector m_variables;
     RTMap m_rt_info;
 
-    // Cache of topologically sorted nodes which is stored as a vector
-    // of weak_ptr not to increase node ref counter to prevent the situation when
-    // node has no consumers but still exists in a graph.
-    mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
-    mutable std::unordered_set<Node*> m_cached_ops;
-
     mutable std::unordered_map<std::string, Output<Node>> m_cached_output_names;
     mutable std::unordered_map<std::string, std::weak_ptr<Node>> m_cached_op_names;
 
     // Private runtime info which is shared across nodes and used only
-    // for internal purposes.
+    // for internal purposes. It holds the cache of topologically sorted nodes.
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
 
     mutable std::mutex m_model_mutex;
@@ -106,6 +106,9 @@ class OPENVINO_API Node : public std::enable_shared_from_this<Node> {
     // For access to m_outputs.
     friend class descriptor::Input;
 
+    // For access to m_inputs.
+    friend class SharedRTInfo;
+
     // For access to m_inputs and m_outputs.
     template <typename NodeType>
     friend class Input;
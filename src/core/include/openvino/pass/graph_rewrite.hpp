@@ -138,6 +138,16 @@ public:
         return m_matcher;
     }
 
+    /// \brief Nodes matched by the last successful application of the pass. The callback can
+    /// change them in place, so GraphRewrite revalidates them together with their consumers.
+    const std::vector<std::weak_ptr<ov::Node>>& get_matched_nodes() const {
+        return m_matched_nodes;
+    }
+
+    void clear_matched_nodes() {
+        m_matched_nodes.clear();
+    }
+
 protected:
     void register_matcher(const std::shared_ptr<pattern::Matcher>& m,
                           const matcher_pass_callback& callback,
@@ -149,6 +159,7 @@ private:
     handler_callback m_handler;
     std::shared_ptr<pattern::Matcher> m_matcher;
     NodeRegistry m_new_nodes;
+    std::vector<std::weak_ptr<ov::Node>> m_matched_nodes;
 };
 
 /// \brief GraphRewrite is a container for MatcherPasses that allows to run them on Function
@@ -158,13 +169,12 @@ private:
 /// Graph rewrite pass is used for matcher passes execution on Function.
 /// To register MatcherPass use \sa add_matcher<T>(args) method where T is a MatcherPass
 /// class.
-/// As a default algorithm graph rewrite pass traverse Function in topological order and
-/// applies
-/// registered matcher passes for each node. But if all registered matcher passes have type
-/// based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
-/// Matcher pattern root is type based if it's operation from opset or
-/// pattern::op::WrapType.
+/// Graph rewrite pass traverse Function in topological order and applies registered matcher
+/// passes for each node. Matcher passes that have type based root node in Matcher pattern are
+/// dispatched by the node type, so they are executed only for nodes of matching type; the rest
+/// of matcher passes are executed for every node.
+/// Matcher pattern root is type based if it's operation from opset, pattern::op::WrapType
+/// or pattern::op::Or / pattern::op::Optional over type based patterns.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation
 /// from opset
 /// or has ov::pattern::op::WrapType. That will help GraphRewrite to execute matcher
@@ -134,6 +134,13 @@ public:
     Output<Node> get_pattern_value() {
         return m_pattern_node;
     }
+    /// \brief Collects types of operations the pattern root can be matched with. Operations
+    /// derived from the collected types can be matched as well.
+    ///
+    /// \param root_types receives the collected types
+    /// \return false if root types can't be determined statically, i.e. the pattern root
+    /// may match an operation of any type
+    bool get_root_types(std::vector<NodeTypeInfo>& root_types) const;
     std::shared_ptr<Node> get_match_root();
     Output<Node> get_match_value();
     PatternMap get_pattern_map() const;
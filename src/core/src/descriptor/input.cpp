@@ -31,6 +31,8 @@ ov::descriptor::Input::~Input() {
 }
 
 void ov::descriptor::Input::replace_output(Output& new_output) {
+    // the former producer is kept alive until the topological order is updated
+    const auto old_producer = m_src_node;
     if (m_output != nullptr) {
         m_output->remove_input(this);
     }
@@ -38,13 +40,11 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     m_output = &new_output;
     m_src_node = std::shared_ptr<ov::Node>(new_output.get_node());
 
-    // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
-    for_each(m_node->m_shared_rt_info.cbegin(),
-             m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
-             });
+    // Output replacement may change the topological order of nodes, so the new producer is spliced
+    // into the cached order of every model the node belongs to.
+    for (const auto& info : m_node->m_shared_rt_info) {
+        info->update_inputs(m_node, {old_producer.get()});
+    }
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
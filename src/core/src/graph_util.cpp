@@ -27,12 +27,15 @@ namespace {
 
 void clone_ov_nodes(const std::vector<std::shared_ptr<ov::Node>>& nodes,
                     std::unordered_map<ov::Node*, std::shared_ptr<ov::Node>>& node_map) {
+    node_map.reserve(node_map.size() + nodes.size());
     // for each node in topological order
     for (const auto& node : nodes) {
         if (!node_map.count(node.get())) {
             // get (already) cloned arguments and clone the node
+            const auto inputs = node->inputs();
             ov::OutputVector cloned_args;
-            for (const auto& input : node->inputs()) {
+            cloned_args.reserve(inputs.size());
+            for (const auto& input : inputs) {
                 ov::Output<ov::Node> output = input.get_source_output();
                 cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
             }
@@ -53,7 +56,7 @@ void clone_ov_nodes(const std::vector<std::shared_ptr<ov::Node>>& nodes,
                 cloned_node->output(output.get_index()).get_tensor().clone_from(output.get_tensor());
             }
 
-            for (const auto& input : node->inputs()) {
+            for (const auto& input : inputs) {
                 cloned_node->input(input.get_index()).get_rt_info() = input.get_rt_info();
             }
 
@@ -196,8 +199,13 @@ void replace_nodes(const std::shared_ptr<Model>& f,
 }
 
 std::shared_ptr<Model> clone_ov_model(const Model& func, std::unordered_map<Node*, std::shared_ptr<Node>>& node_map) {
+    // Nodes mapped by the caller may be connected differently than their originals, so the order
+    // of the original model can be reused only if all nodes are cloned here
+    const bool reuse_order = node_map.empty();
+
     // clone model operations
-    clone_ov_nodes(func.get_ordered_ops(), node_map);
+    const auto ordered_ops = func.get_ordered_ops();
+    clone_ov_nodes(ordered_ops, node_map);
 
     // clone variables
     auto variables = func.get_variables();
@@ -238,8 +246,27 @@ std::shared_ptr<Model> clone_ov_model(const Model& func, std::unordered_map<Node
     }
 
     // create and return cloned model
-    auto result =
-        std::make_shared<ov::Model>(cloned_results, cloned_sinks, cloned_params, cloned_vars, func.get_friendly_name());
+    std::shared_ptr<ov::Model> result;
+    if (reuse_order) {
+        // clones keep connections of the originals, so the original order is valid for them
+        std::vector<std::shared_ptr<Node>> cloned_ordered_ops;
+        cloned_ordered_ops.reserve(ordered_ops.size());
+        for (const auto& node : ordered_ops) {
+            cloned_ordered_ops.push_back(node_map.at(node.get()));
+        }
+        result = std::shared_ptr<ov::Model>(new ov::Model(cloned_results,
+                                                          cloned_sinks,
+                                                          cloned_params,
+                                                          cloned_vars,
+                                                          func.get_friendly_name(),
+                                                          cloned_ordered_ops));
+    } else {
+        result = std::make_shared<ov::Model>(cloned_results,
+                                             cloned_sinks,
+                                             cloned_params,
+                                             cloned_vars,
+                                             func.get_friendly_name());
+    }
     result->get_rt_info() = func.get_rt_info();
     result->m_shared_object = func.m_shared_object;
     return result;
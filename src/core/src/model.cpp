@@ -161,6 +161,24 @@ ov::Model::Model(const OutputVector& results,
                  const std::string& name)
     : Model(as_result_vector(results), sinks, parameters, variables, name) {}
 
+ov::Model::Model(const ov::ResultVector& results,
+                 const ov::SinkVector& sinks,
+                 const ov::ParameterVector& parameters,
+                 const ov::op::util::VariableVector& variables,
+                 const std::string& name,
+                 const std::vector<std::shared_ptr<ov::Node>>& ordered_ops)
+    : m_name(name),
+      m_unique_name("Model" + to_string(m_next_instance_id.fetch_add(1))),
+      m_topological_sorter(ov::topological_sort<std::vector<std::shared_ptr<Node>>>),
+      m_results(results),
+      m_sinks(sinks),
+      m_parameters(parameters),
+      m_variables(variables) {
+    m_shared_rt_info = std::make_shared<SharedRTInfo>();
+    m_shared_rt_info->set_topological_order(ordered_ops);
+    prerequirements(false, false);
+}
+
 ov::Model::Model(const ov::OutputVector& results,
                  const ov::ParameterVector& parameters,
                  const ov::op::util::VariableVector& variables,
@@ -184,6 +202,12 @@ ov::Model::Model(const ov::OutputVector& results, const ov::SinkVector& sinks, c
 
 ov::Model::Model(const OutputVector& results, const string& name) : Model(results, ov::SinkVector{}, name) {}
 
+ov::Model::~Model() {
+    // nodes may outlive the model, the cached order is dropped so they don't keep updating it
+    if (m_shared_rt_info)
+        m_shared_rt_info->set_use_topological_cache(false);
+}
+
 void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::prerequirements");
 
@@ -203,7 +227,9 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
         OPENVINO_ASSERT(variable != nullptr, "Model is incorrect! Some Variable equals to nullptr.");
     }
 
-    m_shared_rt_info = std::make_shared<SharedRTInfo>();
+    // topological order may be already known, in this case shared rt info holds the cache of it
+    if (!m_shared_rt_info)
+        m_shared_rt_info = std::make_shared<SharedRTInfo>();
 
     const auto& ordered_ops = get_ordered_ops();
     if (detect_parameters)
@@ -266,43 +292,75 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::get_ordered_ops");
     lock_guard<mutex> lock(m_model_mutex);
 
-    NodeVector nodes;
     if (m_shared_rt_info->get_use_topological_cache()) {
-        for (const auto& node : m_cached_ordered_ops) {
-            if (auto locked_node = node.lock()) {
-                nodes.emplace_back(locked_node);
-            }
+        remove_detached_ops();
+        auto nodes = m_shared_rt_info->get_topological_order();
+#ifndef NDEBUG
+        // incrementally updated order must be a valid order of the same nodes as the full sort gives,
+        // it's checked once after the order was changed
+        if (m_shared_rt_info->reset_order_changed()) {
+            OPENVINO_ASSERT(is_valid_topological_order(nodes),
+                            "Model::get_ordered_ops. Cached topological order of model '",
+                            get_friendly_name(),
+                            "' is out of date.");
         }
+#endif
         return nodes;
     }
 
-    for (const auto& r : get_results()) {
-        nodes.emplace_back(r);
-    }
-    for (auto& r : get_sinks()) {
-        nodes.emplace_back(r);
-    }
-    for (auto& param : get_parameters()) {
-        nodes.push_back(param);
-    }
-
-    auto order = m_topological_sorter(nodes);
+    auto order = m_topological_sorter(get_topological_sort_roots());
 
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
-    m_cached_ordered_ops.clear();
-    for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
-        m_cached_ordered_ops.push_back(node);
-        m_cached_ops.insert(node.get());
-        node->insert_info(m_shared_rt_info);
-    });
+    m_shared_rt_info->set_topological_order(order);
     m_cached_output_names.clear();
     m_cached_op_names.clear();
-    m_shared_rt_info->set_use_topological_cache(true);
 
     return order;
 }
 
+void ov::Model::remove_detached_ops() const {
+    if (!m_shared_rt_info->has_detach_candidates())
+        return;
+    std::unordered_set<const Node*> roots;
+    for (const auto& root : get_topological_sort_roots())
+        roots.insert(root.get());
+    m_shared_rt_info->remove_detached(roots);
+}
+
+ov::NodeVector ov::Model::get_topological_sort_roots() const {
+    NodeVector roots;
+    roots.reserve(m_results.size() + m_sinks.size() + m_parameters.size());
+    roots.insert(roots.end(), m_results.begin(), m_results.end());
+    roots.insert(roots.end(), m_sinks.begin(), m_sinks.end());
+    roots.insert(roots.end(), m_parameters.begin(), m_parameters.end());
+    return roots;
+}
+
+bool ov::Model::is_valid_topological_order(const NodeVector& nodes) const {
+    std::unordered_map<Node*, size_t> positions;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        positions[nodes[i].get()] = i;
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        for (const auto& input : nodes[i]->input_values()) {
+            auto it = positions.find(input.get_node());
+            if (it == positions.end() || it->second >= i)
+                return false;
+        }
+        for (const auto& dependency : nodes[i]->get_control_dependencies()) {
+            auto it = positions.find(dependency.get());
+            if (it == positions.end() || it->second >= i)
+                return false;
+        }
+    }
+    const auto full_order = m_topological_sorter(get_topological_sort_roots());
+    return full_order.size() == nodes.size() &&
+           std::all_of(full_order.begin(), full_order.end(), [&](const std::shared_ptr<Node>& node) {
+               return positions.count(node.get()) > 0;
+           });
+}
+
 void ov::Model::map_unordered_ops(std::function<void(Node*)> f) const {
     std::unordered_set<Node*> unordered_ops;
     std::stack<Node*, std::vector<Node*>> remaining_ops;
@@ -423,7 +481,12 @@ void ov::Model::replace_parameter(size_t parameter_index, const shared_ptr<ov::o
                     m_parameters.size(),
                     " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
+    // parameters without consumers are not affected by replace_node, so the cached order is updated here
+    m_shared_rt_info->add_detach_candidate(m_parameters[parameter_index].get());
     m_parameters[parameter_index] = parameter;
+    if (!m_shared_rt_info->append(parameter)) {
+        m_shared_rt_info->set_use_topological_cache(false);
+    }
 }
 
 void ov::Model::set_topological_sort(topological_sort_t sorter) {
@@ -556,9 +619,14 @@ void ov::Model::add_sinks(const ov::SinkVector& sinks) {
             }
         }
     }
-    // reset topological nodes order cache as new sinks/results/parameters
-    // can be in a separate connectivity component.
-    m_shared_rt_info->set_use_topological_cache(false);
+    // new sinks are appended to the topological nodes order cache if they depend on ordered nodes only,
+    // otherwise the cache is reset as they can be in a separate connectivity component.
+    for (const auto& sink : sinks) {
+        if (!m_shared_rt_info->append(sink)) {
+            m_shared_rt_info->set_use_topological_cache(false);
+            break;
+        }
+    }
 }
 
 void ov::Model::remove_sink(const std::shared_ptr<ov::op::Sink>& sink) {
@@ -573,9 +641,14 @@ void ov::Model::remove_sink(const std::shared_ptr<ov::op::Sink>& sink) {
 
 void ov::Model::add_results(const ResultVector& results) {
     m_results.insert(m_results.end(), results.begin(), results.end());
-    // reset topological nodes order cache as new sinks/results/parameters
-    // can be in a separate connectivity component.
-    m_shared_rt_info->set_use_topological_cache(false);
+    // new results are appended to the topological nodes order cache if they depend on ordered nodes only,
+    // otherwise the cache is reset as they can be in a separate connectivity component.
+    for (const auto& result : results) {
+        if (!m_shared_rt_info->append(result)) {
+            m_shared_rt_info->set_use_topological_cache(false);
+            break;
+        }
+    }
 }
 
 void ov::Model::remove_result(const std::shared_ptr<ov::op::v0::Result>& result) {
@@ -599,9 +672,14 @@ void ov::Model::add_parameters(const ov::ParameterVector& params) {
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
-    // reset topological nodes order cache as new sinks/results/parameters
-    // can be in a separate connectivity component.
-    m_shared_rt_info->set_use_topological_cache(false);
+    // Parameters have no inputs, so a new parameter is either already ordered as an input of some
+    // ordered node or it is a separate component which can be appended to the end of the order.
+    for (const auto& param : params) {
+        if (!m_shared_rt_info->append(param)) {
+            m_shared_rt_info->set_use_topological_cache(false);
+            break;
+        }
+    }
 }
 
 void ov::Model::remove_parameter(const std::shared_ptr<ov::op::v0::Parameter>& param) {
@@ -847,8 +925,10 @@ void ov::Model::reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>&
 
 ov::Output<ov::Node> ov::Model::add_output(const std::string& tensor_name) {
     auto cache_valid = [&]() {
+        remove_detached_ops();
         return m_cached_output_names.count(tensor_name) &&
-               m_cached_output_names[tensor_name].get_names().count(tensor_name) > 0;
+               m_cached_output_names[tensor_name].get_names().count(tensor_name) > 0 &&
+               m_shared_rt_info->is_ordered(m_cached_output_names[tensor_name].get_node());
     };
     if (!m_shared_rt_info->get_use_topological_cache() || !cache_valid()) {
         m_cached_output_names.clear();
@@ -870,8 +950,10 @@ ov::Output<ov::Node> ov::Model::add_output(const std::string& tensor_name) {
 ov::Output<ov::Node> ov::Model::add_output(const std::string& op_name, size_t output_idx) {
     auto cache_valid = [&]() {
         if (m_cached_op_names.count(op_name)) {
+            remove_detached_ops();
             auto op = m_cached_op_names[op_name].lock();
-            return op && op->get_friendly_name() == op_name && op->get_output_size() > output_idx;
+            return op && op->get_friendly_name() == op_name && op->get_output_size() > output_idx &&
+                   m_shared_rt_info->is_ordered(op.get());
         }
         return false;
     };
@@ -901,9 +983,6 @@ ov::Output<ov::Node> ov::Model::add_output(const std::string& op_name, size_t ou
 }
 
 ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
-    auto cache_valid = [&]() {
-        return m_cached_ops.count(port.get_node());
-    };
     if (ov::op::util::is_output(port.get_node()))
         return port;
     for (const auto& input : port.get_target_inputs()) {
@@ -914,15 +993,9 @@ ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
     }
     auto result = std::make_shared<ov::op::v0::Result>(port);
     m_results.push_back(result);
-    if (m_shared_rt_info->get_use_topological_cache()) {
-        if (cache_valid()) {
-            // Full update of topological cache is not needed, 'result' can be just inserted to the end
-            m_cached_ordered_ops.push_back(result);
-            m_cached_ops.insert(result.get());
-            result->insert_info(m_shared_rt_info);  // Just for consistency, not required for Result nodes
-        } else {
-            m_shared_rt_info->set_use_topological_cache(false);
-        }
+    // Full update of topological cache is not needed if 'port' is ordered, 'result' can be just inserted to the end
+    if (!m_shared_rt_info->append(result)) {
+        m_shared_rt_info->set_use_topological_cache(false);
     }
     return result->output(0);
 }
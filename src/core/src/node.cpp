@@ -105,9 +105,9 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
+        // drop the node from the cached topological order of the models
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [this](const std::shared_ptr<SharedRTInfo>& info) {
+            info->remove_destroyed(this);
         });
 
         for (descriptor::Input& input : m_inputs) {
@@ -198,6 +198,13 @@ void ov::Node::set_arguments(const NodeVector& arguments) {
 }
 
 void ov::Node::set_arguments(const OutputVector& arguments) {
+    // the former producers are kept alive until the topological order is updated
+    NodeVector old_producers;
+    for (const auto& input : m_inputs) {
+        if (input.has_output())
+            old_producers.push_back(input.get_output().get_node());
+    }
+
     // Remove existing inputs of this node
     m_inputs.clear();
 
@@ -207,10 +214,15 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
         set_argument(i++, output);
     }
 
-    // set_arguments doesn't use replace_output method, so we have to reset cache manually here
-    for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
-        info->set_use_topological_cache(false);
-    });
+    // removed inputs don't use replace_output method, so the former producers are passed to the cache here
+    if (!old_producers.empty()) {
+        std::vector<Node*> old_producer_ptrs;
+        for (const auto& producer : old_producers)
+            old_producer_ptrs.push_back(producer.get());
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [&](const std::shared_ptr<SharedRTInfo>& info) {
+            info->update_inputs(this, old_producer_ptrs);
+        });
+    }
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
@@ -241,6 +253,10 @@ void ov::Node::set_argument(size_t position, const Output<Node>& argument) {
             m_inputs.emplace_back(this, m_inputs.size());
         }
         m_inputs.emplace_back(this, position, output_descriptor);
+        // new input may bring new nodes to the topological order
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [this](const std::shared_ptr<SharedRTInfo>& info) {
+            info->update_inputs(this, {});
+        });
     }
 }
 
@@ -367,6 +383,15 @@ void ov::Node::remove_control_dependency(std::shared_ptr<Node> node) {
             node->m_control_dependents.erase(it);
         }
     }
+
+    // removed dependency may drop nodes from the topological order so we have to reset cache
+    // by setting a flag into shared node info.
+    for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
+        info->set_use_topological_cache(false);
+    });
+    for_each(node->m_shared_rt_info.cbegin(), node->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
+        info->set_use_topological_cache(false);
+    });
 }
 
 void ov::Node::clear_control_dependencies() {
@@ -375,6 +400,16 @@ void ov::Node::clear_control_dependencies() {
         if (it != node->m_control_dependents.end()) {
             node->m_control_dependents.erase(it);
         }
+        for_each(node->m_shared_rt_info.cbegin(),
+                 node->m_shared_rt_info.cend(),
+                 [](std::shared_ptr<SharedRTInfo> info) {
+                     info->set_use_topological_cache(false);
+                 });
+    }
+    if (!m_control_dependencies.empty()) {
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
+            info->set_use_topological_cache(false);
+        });
     }
     m_control_dependencies.clear();
 }
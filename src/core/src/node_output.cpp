@@ -8,6 +8,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/op/parameter.hpp"
+#include "shared_node_info.hpp"
 
 namespace ov {
 Output<Node>::Output(Node* node, size_t index) : m_index(index) {
@@ -65,6 +66,11 @@ std::set<Input<Node>> Output<Node>::get_target_inputs() const {
 
 void Output<Node>::remove_target_input(const Input<Node>& target_input) const {
     m_node->m_outputs.at(m_index).remove_input(&(target_input.get_node()->m_inputs.at(target_input.get_index())));
+    // the input still refers to the node, so it can't be told if the node remains reachable from the
+    // cached topological order and the cache is reset
+    for (const auto& info : m_node->m_shared_rt_info) {
+        info->set_use_topological_cache(false);
+    }
 }
 
 void Output<Node>::replace(const Output<Node>& replacement) {
@@ -14,7 +14,6 @@
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
-#include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
 
@@ -65,6 +64,41 @@ PerfCounters& perf_counters_graph_rewrite() {
 
 #endif  // ENABLE_PROFILING_ITT
 
+namespace {
+// Orders the given nodes topologically taking into account only connections between them
+std::vector<std::shared_ptr<ov::Node>> sort_subgraph(const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+    std::vector<std::shared_ptr<ov::Node>> unique_nodes;
+    std::unordered_map<ov::Node*, size_t> producers_count;
+    for (const auto& node : nodes) {
+        if (producers_count.emplace(node.get(), 0).second)
+            unique_nodes.push_back(node);
+    }
+    for (const auto& node : unique_nodes) {
+        for (const auto& input : node->inputs()) {
+            if (producers_count.count(input.get_source_output().get_node()))
+                ++producers_count[node.get()];
+        }
+    }
+
+    std::vector<std::shared_ptr<ov::Node>> sorted;
+    sorted.reserve(unique_nodes.size());
+    for (const auto& node : unique_nodes) {
+        if (producers_count[node.get()] == 0)
+            sorted.push_back(node);
+    }
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        for (const auto& output : sorted[i]->outputs()) {
+            for (const auto& consumer : output.get_target_inputs()) {
+                auto count = producers_count.find(consumer.get_node());
+                if (count != producers_count.end() && --count->second == 0)
+                    sorted.push_back(consumer.get_node()->shared_from_this());
+            }
+        }
+    }
+    return sorted;
+}
+}  // namespace
+
 bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(BackwardGraphRewrite);
     // Initialize execution queue with nodes in topological order
@@ -92,9 +126,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with type based root node are indexed by the root type. Matchers which root type
+    // can't be extracted are collected separately and applied to every node.
+    std::vector<size_t> any_type_matchers;
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -102,37 +138,156 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            any_type_matchers.push_back(matcher_index);
+            continue;
         }
 
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+        // Root types are known if the pattern root is an operation from opset, pattern::op::WrapType or
+        // combination of them through pattern::op::Or, pattern::op::Optional. In this case they are
+        // used in unordered_map as key for fast MatcherPass search. Otherwise the matcher is applied
+        // to all nodes.
+        if (matcher->get_root_types(root_types)) {
+            for (const auto& root_type_info : root_types) {
+                type_to_matcher[root_type_info].push_back(matcher_index);
+            }
+        } else {
+            any_type_matchers.push_back(matcher_index);
         }
+    }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
+    // Complete list of matchers for the node type: matchers registered for the type itself, for its
+    // parents and type agnostic ones, sorted in order of the registration. It's built once for each
+    // node type met in the model, so the type hierarchy is not traversed for every node.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers = [&](const std::shared_ptr<Node>& node) -> const std::vector<size_t>& {
+        const auto& type_info = node->get_type_info();
+        auto cached = node_type_to_matchers.find(type_info);
+        if (cached != node_type_to_matchers.end()) {
+            return cached->second;
+        }
+
+        std::vector<size_t> matcher_passes_to_run(any_type_matchers);
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
             }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
+        // the same matcher may be registered for a type and its parent, e.g. through pattern::op::Or
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return node_type_to_matchers.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
+    // Shape inference is limited to the nodes affected by the transformations: a node is revalidated
+    // if one of its inputs was reconnected by a matcher, if it was created during this run or if one
+    // of its producers changed its outputs during revalidation. Reconnected inputs are detected by
+    // comparing them with the sources recorded before the run, so rewiring onto an already existing
+    // producer (e.g. removal of a pass-through Reshape) is caught as well.
+    std::unordered_set<size_t> changed_nodes;
+    std::unordered_map<size_t, std::pair<size_t, size_t>> initial_inputs_offset;
+    std::vector<std::pair<size_t, size_t>> initial_inputs;
+    if (m_enable_shape_inference) {
+        for (const auto& weak_node : nodes_to_run) {
+            auto node = weak_node.lock();
+            if (!node)
+                continue;
+            initial_inputs_offset.emplace(node->get_instance_id(),
+                                          std::make_pair(initial_inputs.size(), node->get_input_size()));
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                initial_inputs.emplace_back(source.get_node()->get_instance_id(), source.get_index());
+            }
+        }
     }
+    // Revalidates the node and reports whether types or shapes of its outputs were changed
+    auto revalidate = [&](const std::shared_ptr<Node>& node) -> bool {
+        std::vector<std::pair<element::Type, PartialShape>> outputs_before;
+        outputs_before.reserve(node->get_output_size());
+        for (const auto& output : node->outputs())
+            outputs_before.emplace_back(output.get_element_type(), output.get_partial_shape());
+
+        node->revalidate_and_infer_types();
+
+        for (size_t i = 0; i < node->get_output_size(); ++i) {
+            if (outputs_before[i].first != node->get_output_element_type(i) ||
+                outputs_before[i].second != node->get_output_partial_shape(i)) {
+                changed_nodes.insert(node->get_instance_id());
+                return true;
+            }
+        }
+        return false;
+    };
+    // Returns true if the node was affected and revalidated
+    auto revalidate_if_affected = [&](const std::shared_ptr<Node>& node) -> bool {
+        bool affected = false;
+        const auto offset = initial_inputs_offset.find(node->get_instance_id());
+        if (offset == initial_inputs_offset.end() || offset->second.second != node->get_input_size()) {
+            affected = true;
+        } else {
+            auto initial_input = initial_inputs.begin() + offset->second.first;
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                const auto producer_id = source.get_node()->get_instance_id();
+                if (initial_input->first != producer_id || initial_input->second != source.get_index() ||
+                    changed_nodes.count(producer_id)) {
+                    affected = true;
+                }
+                *initial_input++ = {producer_id, source.get_index()};
+            }
+        }
+        if (affected)
+            revalidate(node);
+        return affected;
+    };
+
+    // A successful callback may change matched nodes in place (attributes or inputs) and most of them
+    // precede the root node in topological order, so their consumers could be already processed. The
+    // matched nodes are revalidated and, if outputs of any of them were changed, the cone below them is
+    // revalidated in topological order. Affected nodes of the cone are put back to the beginning of the
+    // execution queue, so matchers are applied to them again.
+    auto revalidate_matched_nodes = [&](const std::shared_ptr<MatcherPass>& m_pass, const std::shared_ptr<Node>& root) {
+        std::vector<std::shared_ptr<Node>> matched{root};
+        for (const auto& weak_node : m_pass->get_matched_nodes()) {
+            if (auto node = weak_node.lock())
+                matched.push_back(std::move(node));
+        }
+        m_pass->clear_matched_nodes();
+
+        std::vector<std::shared_ptr<Node>> cone;
+        std::unordered_set<Node*> in_cone;
+        auto add_consumers = [&](const std::shared_ptr<Node>& node) {
+            for (const auto& output : node->outputs()) {
+                for (const auto& consumer : output.get_target_inputs()) {
+                    if (in_cone.insert(consumer.get_node()).second)
+                        cone.push_back(consumer.get_node()->shared_from_this());
+                }
+            }
+        };
+        for (const auto& node : sort_subgraph(matched)) {
+            // nodes replaced by the callback are left detached and may not be valid anymore
+            const auto outputs = node->outputs();
+            const bool used = std::any_of(outputs.begin(), outputs.end(), [](const Output<Node>& output) {
+                return !output.get_target_inputs().empty();
+            });
+            if (used && revalidate(node))
+                add_consumers(node);
+        }
+        for (size_t i = 0; i < cone.size(); ++i)
+            add_consumers(cone[i]);
+
+        std::vector<std::shared_ptr<Node>> affected;
+        for (const auto& node : sort_subgraph(cone)) {
+            if (revalidate_if_affected(node))
+                affected.push_back(node);
+        }
+        for (auto it = affected.rbegin(); it != affected.rend(); ++it)
+            nodes_to_run.emplace_front(*it);
+    };
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
@@ -151,6 +306,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        if (status && m_enable_shape_inference) {
+            revalidate_matched_nodes(m_pass, node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -166,9 +324,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -189,49 +344,13 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         }
         // Temporary keep this GraphRewrite property for backward compatibility
         if (m_enable_shape_inference) {
-            node->revalidate_and_infer_types();
+            revalidate_if_affected(node);
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
 
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers(node)) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
@@ -271,12 +390,16 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
     set_name(m->get_name());
     set_property(property, true);
     m_matcher = m;
-    m_handler = [m, callback](const std::shared_ptr<Node>& node) -> bool {
+    m_handler = [this, m, callback](const std::shared_ptr<Node>& node) -> bool {
         if (m->match(node->output(0))) {
             OPENVINO_DEBUG << "Matcher " << m->get_name() << " matched " << node;
             OV_PASS_CALLBACK(m);
             const bool status = callback(*m.get());
             OPENVINO_DEBUG << "Matcher " << m->get_name() << " callback " << (status ? "succeded" : "failed");
+            if (status) {
+                for (const auto& value : m->get_matched_values())
+                    m_matched_nodes.emplace_back(value.get_node_shared_ptr());
+            }
             // explicitly clear Matcher state because it holds pointers to matched nodes
             m->clear_state();
             return status;
@@ -294,6 +417,7 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
 bool ov::pass::MatcherPass::apply(std::shared_ptr<ov::Node> node) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, pass::perf_counters_graph_rewrite()[get_type_info()]);
     clear_new_nodes();
+    clear_matched_nodes();
     if (m_handler)
         return m_handler(node);
     return false;
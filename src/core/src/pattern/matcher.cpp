@@ -8,6 +8,9 @@
 #include <regex>
 
 #include "openvino/op/util/op_types.hpp"
+#include "openvino/pass/pattern/op/optional.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 
@@ -26,8 +29,56 @@ namespace {
 Output<Node> make_node_output(const std::shared_ptr<Node>& node) {
     return node->get_output_size() == 1 ? node->output(0) : std::make_shared<op::AnyOutput>(node)->output(0);
 }
+
+bool collect_root_types(const Output<Node>& pattern_value, std::vector<NodeTypeInfo>& root_types) {
+    const auto node = pattern_value.get_node_shared_ptr();
+    // AnyOutput is appended for multi output roots, the actual root is its input
+    if (std::dynamic_pointer_cast<op::AnyOutput>(node)) {
+        return collect_root_types(node->input_value(0), root_types);
+    }
+    if (auto wrap_type = std::dynamic_pointer_cast<op::WrapType>(node)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    // Or matches if any of its branches matches, so the root types are united
+    if (std::dynamic_pointer_cast<op::Or>(node)) {
+        for (const auto& branch : node->input_values()) {
+            if (!collect_root_types(branch, root_types))
+                return false;
+        }
+        return true;
+    }
+    // Optional matches either one of the optional types or its input pattern
+    if (auto optional = std::dynamic_pointer_cast<op::Optional>(node)) {
+        if (node->get_input_size() == 0)
+            return false;
+        const auto optional_types = optional->get_optional_types();
+        root_types.insert(root_types.end(), optional_types.begin(), optional_types.end());
+        return collect_root_types(node->input_value(0), root_types);
+    }
+    // The rest of patterns (Label, Any, AnyOf, Skip, etc.) may match a node of any type
+    if (std::dynamic_pointer_cast<op::Pattern>(node)) {
+        return false;
+    }
+    root_types.push_back(node->get_type_info());
+    return true;
+}
 }  // namespace
 
+bool Matcher::get_root_types(std::vector<NodeTypeInfo>& root_types) const {
+    std::vector<NodeTypeInfo> types;
+    if (!collect_root_types(m_pattern_node, types))
+        return false;
+
+    root_types.clear();
+    for (const auto& type : types) {
+        if (std::find(root_types.begin(), root_types.end(), type) == root_types.end())
+            root_types.push_back(type);
+    }
+    return true;
+}
+
 Matcher::Matcher(std::shared_ptr<Node> pattern_node) : m_pattern_node(make_node_output(pattern_node)) {}
 
 Matcher::Matcher(std::shared_ptr<Node> pattern_node, const std::string& name)
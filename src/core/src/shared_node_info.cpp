@@ -0,0 +1,223 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_node_info.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace {
+// Distance between labels of neighbour nodes after full relabeling, leaves room for insertions
+constexpr uint64_t label_step = uint64_t{1} << 20;
+}  // namespace
+
+template <typename F>
+void ov::SharedRTInfo::for_each_dependency(const Node* node, F&& f) {
+    for (const auto& input : node->m_inputs) {
+        if (input.has_output())
+            f(input.get_output().get_node().get());
+    }
+    for (const auto& dependency : node->get_control_dependencies())
+        f(dependency.get());
+}
+
+void ov::SharedRTInfo::set_use_topological_cache(bool status) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_use_topological_cache = status;
+    if (!status)
+        clear();
+}
+
+void ov::SharedRTInfo::set_topological_order(const std::vector<std::shared_ptr<Node>>& order) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    clear();
+    m_positions.reserve(order.size());
+    uint64_t label = 0;
+    for (const auto& node : order) {
+        label += label_step;
+        m_positions.emplace(node.get(), m_order.insert(m_order.end(), OrderedNode{node, label}));
+        node->insert_info(shared_from_this());
+    }
+    m_use_topological_cache = true;
+}
+
+std::vector<std::shared_ptr<ov::Node>> ov::SharedRTInfo::get_topological_order() const {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::vector<std::shared_ptr<Node>> nodes;
+    nodes.reserve(m_order.size());
+    for (const auto& ordered_node : m_order) {
+        if (auto node = ordered_node.node.lock())
+            nodes.push_back(std::move(node));
+    }
+    return nodes;
+}
+
+bool ov::SharedRTInfo::is_ordered(const Node* node) const {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    return m_positions.count(node) > 0;
+}
+
+bool ov::SharedRTInfo::append(const std::shared_ptr<Node>& node) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (!m_use_topological_cache)
+        return false;
+    if (m_positions.count(node.get()))
+        return true;
+    // the node can be appended only if everything it depends on is ordered already
+    bool dependencies_ordered = true;
+    for_each_dependency(node.get(), [&](const Node* dependency) {
+        dependencies_ordered = dependencies_ordered && m_positions.count(dependency);
+    });
+    if (!dependencies_ordered)
+        return false;
+
+    if (!m_order.empty() && m_order.back().label > std::numeric_limits<uint64_t>::max() - label_step)
+        relabel();
+    const uint64_t label = m_order.empty() ? label_step : m_order.back().label + label_step;
+    m_positions.emplace(node.get(), m_order.insert(m_order.end(), OrderedNode{node, label}));
+    node->insert_info(shared_from_this());
+    m_order_changed = true;
+    return true;
+}
+
+void ov::SharedRTInfo::update_inputs(Node* node, const std::vector<Node*>& old_producers) {
+    // declared before the lock, so nodes are not released under it
+    std::vector<std::shared_ptr<Node>> new_nodes;
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (!m_use_topological_cache)
+        return;
+    for (const auto old_producer : old_producers)
+        add_detach_candidate(old_producer);
+    const auto position = m_positions.find(node);
+    if (position == m_positions.end())
+        return;
+    m_order_changed = true;
+
+    // Nodes the node depends on which are not ordered yet are collected in topological order by DFS.
+    // Ordered nodes met on the way must precede the node, otherwise ordered nodes have to be moved
+    // and the order is dropped.
+    const uint64_t label = position->second->label;
+    std::unordered_set<const Node*> visited;
+    std::vector<std::pair<Node*, bool>> nodes_to_do;
+    bool precedes = true;
+    auto push_dependencies = [&](const Node* consumer) {
+        const auto first = nodes_to_do.size();
+        for_each_dependency(consumer, [&](Node* dependency) {
+            const auto dependency_position = m_positions.find(dependency);
+            if (dependency_position != m_positions.end()) {
+                precedes = precedes && dependency_position->second->label < label;
+            } else if (!visited.count(dependency)) {
+                nodes_to_do.emplace_back(dependency, false);
+            }
+        });
+        // the first input is visited first as in the full sort
+        std::reverse(nodes_to_do.begin() + first, nodes_to_do.end());
+    };
+    push_dependencies(node);
+    while (precedes && !nodes_to_do.empty()) {
+        Node* current = nodes_to_do.back().first;
+        if (nodes_to_do.back().second) {
+            new_nodes.push_back(current->shared_from_this());
+            nodes_to_do.pop_back();
+        } else if (!visited.insert(current).second) {
+            nodes_to_do.pop_back();
+        } else {
+            nodes_to_do.back().second = true;
+            push_dependencies(current);
+        }
+    }
+    if (!precedes) {
+        set_use_topological_cache(false);
+        return;
+    }
+    if (new_nodes.empty())
+        return;
+
+    const uint64_t prev_label = position->second == m_order.begin() ? 0 : std::prev(position->second)->label;
+    const uint64_t step = (label - prev_label) / (new_nodes.size() + 1);
+    uint64_t new_label = prev_label;
+    for (const auto& new_node : new_nodes) {
+        new_label += step;
+        m_positions.emplace(new_node.get(), m_order.insert(position->second, OrderedNode{new_node, new_label}));
+        new_node->insert_info(shared_from_this());
+    }
+    if (step == 0)
+        relabel();
+}
+
+void ov::SharedRTInfo::remove_destroyed(Node* node) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_detach_candidates.erase(node);
+    const auto position = m_positions.find(node);
+    if (position == m_positions.end())
+        return;
+    m_order.erase(position->second);
+    m_positions.erase(position);
+    for_each_dependency(node, [&](const Node* dependency) {
+        add_detach_candidate(dependency);
+    });
+    m_order_changed = true;
+}
+
+void ov::SharedRTInfo::add_detach_candidate(const Node* node) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (m_positions.count(node))
+        m_detach_candidates.insert(node);
+}
+
+bool ov::SharedRTInfo::has_detach_candidates() const {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    return !m_detach_candidates.empty();
+}
+
+void ov::SharedRTInfo::remove_detached(const std::unordered_set<const Node*>& roots) {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    while (!m_detach_candidates.empty()) {
+        const Node* node = *m_detach_candidates.begin();
+        m_detach_candidates.erase(m_detach_candidates.begin());
+        const auto position = m_positions.find(node);
+        if (position == m_positions.end() || roots.count(node))
+            continue;
+
+        bool used = false;
+        for (const auto& output : node->outputs()) {
+            for (const auto& consumer : output.get_target_inputs())
+                used = used || m_positions.count(consumer.get_node());
+        }
+        for (const auto dependent : node->get_control_dependents())
+            used = used || m_positions.count(dependent);
+        if (used)
+            continue;
+
+        m_order.erase(position->second);
+        m_positions.erase(position);
+        for_each_dependency(node, [&](const Node* dependency) {
+            add_detach_candidate(dependency);
+        });
+        m_order_changed = true;
+    }
+}
+
+bool ov::SharedRTInfo::reset_order_changed() {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    const bool order_changed = m_order_changed;
+    m_order_changed = false;
+    return order_changed;
+}
+
+void ov::SharedRTInfo::clear() {
+    m_order.clear();
+    m_positions.clear();
+    m_detach_candidates.clear();
+    m_order_changed = false;
+}
+
+void ov::SharedRTInfo::relabel() {
+    uint64_t label = 0;
+    for (auto& ordered_node : m_order) {
+        label += label_step;
+        ordered_node.label = label;
+    }
+}
@@ -4,24 +4,83 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ov {
-class SharedRTInfo {
+/// \brief Information shared between a Model and its nodes. It keeps the topological order of the
+/// model operations, so node level graph edits update the order of every model the node belongs to
+/// without full re-sort.
+///
+/// Ordered nodes are labeled by increasing numbers, so the order of two nodes is compared in O(1) and
+/// new nodes are inserted between the existing ones. Nodes which may become unreachable after an edit
+/// are collected as candidates and removed from the order by the Model, as it knows its root nodes.
+class SharedRTInfo : public std::enable_shared_from_this<SharedRTInfo> {
 public:
     SharedRTInfo() : m_use_topological_cache(false) {}
 
-    void set_use_topological_cache(bool status) {
-        m_use_topological_cache = status;
-    }
+    /// \brief Disabling of the cache drops the cached order, it's enabled by set_topological_order() only.
+    void set_use_topological_cache(bool status);
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    /// \brief Replaces the cached order with the given one and enables the cache.
+    void set_topological_order(const std::vector<std::shared_ptr<Node>>& order);
+
+    std::vector<std::shared_ptr<Node>> get_topological_order() const;
+
+    bool is_ordered(const Node* node) const;
+
+    /// \brief Appends the node to the end of the order.
+    /// \return false if the cache is disabled or the node depends on nodes that are not ordered
+    bool append(const std::shared_ptr<Node>& node);
+
+    /// \brief Splices nodes the node started to depend on into the order before it. If it's not possible
+    /// without moving already ordered nodes, the cache is disabled.
+    /// \param old_producers  Former producers of the node, they may become unreachable
+    void update_inputs(Node* node, const std::vector<Node*>& old_producers);
+
+    /// \brief Removes the destroyed node from the order, its producers may become unreachable.
+    void remove_destroyed(Node* node);
+
+    /// \brief Marks the node as one that may become unreachable.
+    void add_detach_candidate(const Node* node);
+
+    bool has_detach_candidates() const;
+
+    /// \brief Removes candidates which are not roots and have no ordered consumers, cascading to their
+    /// producers.
+    void remove_detached(const std::unordered_set<const Node*>& roots);
+
+    /// \brief Returns true if the order was changed incrementally since the previous call.
+    bool reset_order_changed();
+
 private:
+    struct OrderedNode {
+        std::weak_ptr<Node> node;
+        uint64_t label;
+    };
+    using Position = std::list<OrderedNode>::iterator;
+
+    // calls f for producers and control dependencies of the node
+    template <typename F>
+    static void for_each_dependency(const Node* node, F&& f);
+
+    void clear();
+    void relabel();
+
     bool m_use_topological_cache;
+    bool m_order_changed = false;
+    std::list<OrderedNode> m_order;
+    std::unordered_map<const Node*, Position> m_positions;
+    std::unordered_set<const Node*> m_detach_candidates;
+    mutable std::recursive_mutex m_mutex;
 };
 }  // namespace ov
@@ -8,14 +8,17 @@
 
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/rtti.hpp"
+#include "openvino/op/concat.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/op.hpp"
 #include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
 #include "openvino/op/result.hpp"
 #include "openvino/op/tanh.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -267,6 +270,145 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndAnyTypeMatcherPassOrder1) {
+    auto f = get_model();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    // Divide was replaced by the first matcher, so the next one is not applied to it
+    ASSERT_EQ(order.size(), 3);
+    for (const auto& node : order) {
+        ASSERT_FALSE(ov::is_type<op::v1::Divide>(node));
+    }
+}
+
+TEST(GraphRewriteTest, TypeBasedAndAnyTypeMatcherPassOrder2) {
+    auto f = get_model();
+    const auto ref_order = f->get_ordered_ops();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(order, ref_order);
+}
+
+class ShapeInferenceAnchor : public ov::pass::GraphRewrite {
+public:
+    OPENVINO_RTTI("ShapeInferenceAnchor");
+    ShapeInferenceAnchor() : GraphRewrite() {
+        m_enable_shape_inference = true;
+    }
+};
+
+TEST(GraphRewriteTest, ShapeInferenceOfAffectedNodes) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+    auto divide_constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{2, 1, 1, 1}, {1.5});
+    auto divide = std::make_shared<ov::op::v1::Divide>(data, divide_constant);
+    auto tanh = std::make_shared<ov::op::v0::Tanh>(divide);
+    auto f = std::make_shared<ov::Model>(ov::NodeVector{tanh}, ov::ParameterVector{data});
+    ASSERT_EQ(tanh->get_output_partial_shape(0), PartialShape({2, 3, 1, 2}));
+
+    ShapeInferenceAnchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    // Divide is replaced with Relu of the data, so shapes of its consumers are inferred again
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(tanh->get_output_partial_shape(0), PartialShape({3, 1, 2}));
+    ASSERT_EQ(f->get_results()[0]->get_output_partial_shape(0), PartialShape({3, 1, 2}));
+}
+
+class RemoveReshapePass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("RemoveReshapePass");
+    RemoveReshapePass() : MatcherPass() {
+        auto reshape = pattern::wrap_type<ov::op::v1::Reshape>();
+        ov::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            const auto root = m.get_match_root();
+            return ov::replace_output_update_name(root->output(0), root->input_value(0));
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(reshape, "RemoveReshapePass");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, ShapeInferenceOfReconnectedNodes) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+    auto relu = std::make_shared<ov::op::v0::Relu>(data);
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {6});
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(relu, shape, false);
+    auto tanh = std::make_shared<ov::op::v0::Tanh>(reshape);
+    auto f = std::make_shared<ov::Model>(ov::NodeVector{tanh}, ov::ParameterVector{data});
+    ASSERT_EQ(tanh->get_output_partial_shape(0), PartialShape({6}));
+
+    ShapeInferenceAnchor anchor;
+    anchor.add_matcher<RemoveReshapePass>();
+    anchor.run_on_model(f);
+
+    // Tanh is reconnected to the already existing Relu, so its shape is inferred again
+    ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(f), 0);
+    ASSERT_EQ(tanh->input_value(0).get_node_shared_ptr(), relu);
+    ASSERT_EQ(tanh->get_output_partial_shape(0), PartialShape({3, 1, 2}));
+    ASSERT_EQ(f->get_results()[0]->get_output_partial_shape(0), PartialShape({3, 1, 2}));
+}
+
+class ConcatAxisPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ConcatAxisPass");
+    ConcatAxisPass() : MatcherPass() {
+        auto concat = pattern::wrap_type<ov::op::v0::Concat>();
+        auto relu = pattern::wrap_type<ov::op::v0::Relu>({concat});
+        ov::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+            auto concat_node = ov::as_type_ptr<ov::op::v0::Concat>(m.get_pattern_map().at(concat));
+            if (concat_node->get_axis() == 1)
+                return false;
+            // the normalized axis is cached by validation, so it's changed as well
+            concat_node->set_axis(1);
+            concat_node->set_concatenation_axis(1);
+            return true;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(relu, "ConcatAxisPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, ShapeInferenceOfNodesChangedInPlace) {
+    auto a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3});
+    auto b = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2, 3});
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{a, b}, 0);
+    auto tanh = std::make_shared<ov::op::v0::Tanh>(concat);
+    auto relu = std::make_shared<ov::op::v0::Relu>(concat);
+    auto f = std::make_shared<ov::Model>(ov::NodeVector{tanh, relu}, ov::ParameterVector{a, b});
+    ASSERT_EQ(relu->get_output_partial_shape(0), PartialShape({4, 3}));
+
+    NodeVector order;
+    ShapeInferenceAnchor anchor;
+    anchor.add_matcher<ConcatAxisPass>();
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_model(f);
+
+    // the callback changes the axis of Concat preceding Relu, so all consumers of Concat are inferred again
+    ASSERT_EQ(concat->get_output_partial_shape(0), PartialShape({2, 6}));
+    ASSERT_EQ(tanh->get_output_partial_shape(0), PartialShape({2, 6}));
+    ASSERT_EQ(relu->get_output_partial_shape(0), PartialShape({2, 6}));
+    for (const auto& result : f->get_results()) {
+        ASSERT_EQ(result->get_output_partial_shape(0), PartialShape({2, 6}));
+    }
+    // Relu is put back to the queue as affected, so the rest of matchers are applied to it
+    ASSERT_EQ(std::count(order.begin(), order.end(), relu), 1);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
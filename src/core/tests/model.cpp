@@ -1457,18 +1457,63 @@ TEST(model, topological_sort_caching_replace_node) {
     auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
     ov::replace_node(relu2, new_relu);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
-
-    // Before get_ordered_ops, new_node shouldn't have shared_info, but after
-    // it will be set to the model shared_info and cache will be used.
-    ASSERT_FALSE(ov::NodeAccessor(new_relu).get_shared_info().count(shared_info));
-    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    // new node is spliced into the cached order before its consumer without full sort
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_TRUE(ov::NodeAccessor(new_relu).get_shared_info().count(shared_info));
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu1, new_relu, result}));
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_replace_node_with_subgraph) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
     ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    auto arg1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto tanh = std::make_shared<ov::opset8::Tanh>(relu1);
+    auto add = std::make_shared<ov::opset8::Add>(tanh, arg1);
+    ov::replace_node(relu2, add);
+    relu2.reset();
+
+    // all new nodes are spliced in topological order, destroyed node leaves the order
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu1, tanh, arg1, add, result}));
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
+TEST(model, topological_sort_caching_reconnect_to_later_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto tanh = std::make_shared<ov::opset8::Tanh>(arg0);
+    auto result0 = std::make_shared<ov::opset8::Result>(relu);
+    auto result1 = std::make_shared<ov::opset8::Result>(tanh);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result0, result1}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    const auto ops = f->get_ordered_ops();
+    auto position = [&](const std::shared_ptr<ov::Node>& node) {
+        return std::find(ops.begin(), ops.end(), node) - ops.begin();
+    };
+    std::shared_ptr<ov::Node> first = relu, second = tanh;
+    if (position(first) > position(second))
+        std::swap(first, second);
+
+    // ordered nodes would have to be moved to consume the later node, so the cache is reset
+    first->input(0).replace_source_output(second);
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    const auto new_ops = f->get_ordered_ops();
+    ASSERT_EQ(new_ops.size(), 5);
+    ASSERT_LT(std::find(new_ops.begin(), new_ops.end(), second), std::find(new_ops.begin(), new_ops.end(), first));
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+}
+
 TEST(model, topological_sort_caching_replace_source_output) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
     auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
@@ -1481,11 +1526,9 @@ TEST(model, topological_sort_caching_replace_source_output) {
 
     relu2->input(0).replace_source_output(relu1);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
-
-    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    // the source is already ordered before the node, so the cached order is kept
     ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
@@ -1520,10 +1563,9 @@ TEST(model, topological_sort_caching_replace_output) {
     auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
     relu2->output(0).replace(new_relu);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
-    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    // new node is spliced into the cached order, the replaced one is not reachable anymore
     ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu1, new_relu, result}));
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
@@ -1539,10 +1581,9 @@ TEST(model, topological_sort_caching_set_argument) {
 
     relu2->set_argument(0, arg0);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
-    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    // relu1 is not reachable anymore, so it leaves the cached order
     ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu2, result}));
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
@@ -1558,10 +1599,9 @@ TEST(model, topological_sort_caching_set_arguments) {
 
     relu2->set_arguments({arg0->output(0)});
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
-    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    // relu1 is not reachable anymore, so it leaves the cached order
     ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu2, result}));
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
@@ -1600,24 +1640,30 @@ TEST(model, topological_sort_caching_result_parameter_sink) {
         ASSERT_TRUE(shared_info->get_use_topological_cache());
         ASSERT_TRUE(all_ops_have_same_info(f));
     };
+    // nodes depending on ordered nodes only are appended to the cache without full sort
+    auto check_incremental_caching_status = [=](int64_t expected_number_of_ops) {
+        ASSERT_TRUE(shared_info->get_use_topological_cache());
+        ASSERT_EQ(f->get_ordered_ops().size(), expected_number_of_ops);
+        ASSERT_TRUE(all_ops_have_same_info(f));
+    };
 
     auto result2 = std::make_shared<ov::opset8::Result>(relu2);
     f->add_results({result2});
-    check_caching_status(5);
+    check_incremental_caching_status(5);
 
     f->remove_result(result2);
     check_caching_status(4);
 
     auto arg1 = std::make_shared<ov::opset8::Parameter>();
     f->add_parameters({arg1});
-    check_caching_status(5);
+    check_incremental_caching_status(5);
 
     f->remove_parameter(arg1);
     check_caching_status(4);
 
     auto assign = std::make_shared<ov::opset8::Assign>();
     f->add_sinks({assign});
-    check_caching_status(5);
+    check_incremental_caching_status(5);
 
     f->remove_sink(assign);
     check_caching_status(4);
@@ -1663,6 +1709,108 @@ TEST(model, topological_sort_caching_shared_nodes) {
     ASSERT_FALSE(f2_shared_info->get_use_topological_cache());
 }
 
+TEST(model, topological_sort_caching_add_results) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // Result of an ordered node is spliced into the cache without full sort
+    auto result1 = std::make_shared<ov::opset8::Result>(relu1);
+    f->add_results({result1});
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(ov::NodeAccessor(result1).get_shared_info().count(shared_info));
+    ASSERT_EQ(f->get_ordered_ops().size(), 5);
+    ASSERT_EQ(f->get_ordered_ops().back(), result1);
+
+    // Result of a node that is not in the model needs full sort
+    auto relu3 = std::make_shared<ov::opset8::Relu>(relu2);
+    auto result3 = std::make_shared<ov::opset8::Result>(relu3);
+    f->add_results({result3});
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 7);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_add_parameters) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // Parameter without consumers is a separate component, it's appended to the order
+    auto arg1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    f->add_parameters({arg1});
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    ASSERT_EQ(f->get_ordered_ops().back(), arg1);
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_remove_control_dependency) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu0 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto result = std::make_shared<ov::opset8::Result>(relu0);
+    relu0->add_control_dependency(relu1);
+    relu0->add_control_dependency(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_EQ(f->get_ordered_ops().size(), 5);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // Nodes reachable only through the removed control dependency leave the order
+    relu0->remove_control_dependency(relu1);
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 4);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    relu0->clear_control_dependencies();
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+}
+
+TEST(model, topological_sort_caching_clone) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto arg1 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto add = std::make_shared<ov::opset8::Add>(arg0, arg1);
+    auto relu = std::make_shared<ov::opset8::Relu>(add);
+    relu->add_control_dependency(arg1);
+    auto result = std::make_shared<ov::opset8::Result>(relu);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0, arg1});
+
+    auto cloned = f->clone();
+    auto shared_info = ov::ModelAccessor(cloned).get_shared_info();
+    // Clone reuses topological order of the original model
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(cloned));
+
+    const auto ordered_ops = f->get_ordered_ops();
+    const auto cloned_ordered_ops = cloned->get_ordered_ops();
+    ASSERT_EQ(cloned_ordered_ops.size(), ordered_ops.size());
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        ASSERT_NE(cloned_ordered_ops[i], ordered_ops[i]);
+        ASSERT_EQ(cloned_ordered_ops[i]->get_type_info(), ordered_ops[i]->get_type_info());
+        ASSERT_EQ(cloned_ordered_ops[i]->get_friendly_name(), ordered_ops[i]->get_friendly_name());
+    }
+
+    // The cached order is updated on graph modification as usual
+    auto cloned_relu = cloned->get_results()[0]->get_input_node_shared_ptr(0);
+    cloned_relu->input(0).replace_source_output(cloned->get_parameters()[0]);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(cloned->get_ordered_ops().size(), 4);
+}
+
 namespace bs_utils {
 static std::shared_ptr<ov::Model> create_n_inputs(ov::element::Type type,
                                                   const std::vector<ov::PartialShape>& shapes,
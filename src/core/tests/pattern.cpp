@@ -814,3 +814,46 @@ TEST(pattern, wrap_type_multi_op) {
         ASSERT_FALSE(matcher->match(static_pointer_cast<Node>(c)));
     }
 }
+
+TEST(pattern, root_types) {
+    std::vector<NodeTypeInfo> root_types;
+    {
+        auto m = pattern::wrap_type<op::v1::Add, op::v1::Multiply>();
+        ASSERT_TRUE(pattern::Matcher(m).get_root_types(root_types));
+        ASSERT_EQ(root_types,
+                  (std::vector<NodeTypeInfo>{op::v1::Add::get_type_info_static(),
+                                             op::v1::Multiply::get_type_info_static()}));
+    }
+    {
+        auto a = make_shared<op::v0::Parameter>(element::f32, Shape{1});
+        auto relu = std::make_shared<op::v0::Relu>(a);
+        ASSERT_TRUE(pattern::Matcher(relu).get_root_types(root_types));
+        ASSERT_EQ(root_types, std::vector<NodeTypeInfo>{op::v0::Relu::get_type_info_static()});
+    }
+    {
+        auto input = pattern::any_input();
+        auto m = std::make_shared<pattern::op::Or>(
+            OutputVector{pattern::wrap_type<op::v1::Add>({input, input}),
+                         pattern::wrap_type<op::v1::Add, op::v0::Exp>({input}),
+                         std::make_shared<op::v0::Abs>(input)});
+        ASSERT_TRUE(pattern::Matcher(m).get_root_types(root_types));
+        ASSERT_EQ(root_types,
+                  (std::vector<NodeTypeInfo>{op::v1::Add::get_type_info_static(),
+                                             op::v0::Exp::get_type_info_static(),
+                                             op::v0::Abs::get_type_info_static()}));
+    }
+    {
+        auto m = pattern::optional<op::v0::Relu>(pattern::wrap_type<op::v0::Exp>());
+        ASSERT_TRUE(pattern::Matcher(m).get_root_types(root_types));
+        ASSERT_EQ(root_types,
+                  (std::vector<NodeTypeInfo>{op::v0::Relu::get_type_info_static(),
+                                             op::v0::Exp::get_type_info_static()}));
+    }
+    ASSERT_FALSE(pattern::Matcher(pattern::any_input()).get_root_types(root_types));
+    ASSERT_FALSE(pattern::Matcher(pattern::optional<op::v0::Relu>()).get_root_types(root_types));
+    {
+        auto m = std::make_shared<pattern::op::Or>(
+            OutputVector{pattern::wrap_type<op::v1::Add>(), std::make_shared<pattern::op::Label>()});
+        ASSERT_FALSE(pattern::Matcher(m).get_root_types(root_types));
+    }
+}
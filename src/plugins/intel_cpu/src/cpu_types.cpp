@@ -241,6 +241,8 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"RoPE", Type::RoPE},
         {"GatherCompressed", Type::Gather},
         {"CausalMaskPreprocess", Type::CausalMaskPreprocess},
+        {"Sampling", Type::Sampling},
+        {"ImagePreprocess", Type::ImagePreprocess},
     };
     return type_to_name_tbl;
 }
@@ -360,6 +362,8 @@ std::string NameFromType(const Type type) {
         CASE(ScaledDotProductAttention);
         CASE(RoPE);
         CASE(CausalMaskPreprocess);
+        CASE(Sampling);
+        CASE(ImagePreprocess);
         CASE(Unknown);
     }
 #undef CASE
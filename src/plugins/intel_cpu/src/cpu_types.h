@@ -120,6 +120,8 @@ enum class Type {
     ScaledDotProductAttention,
     RoPE,
     CausalMaskPreprocess,
+    Sampling,
+    ImagePreprocess,
 };
 
 enum class Algorithm {
@@ -5,9 +5,12 @@
 #include "graph.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -1396,7 +1399,21 @@ void Graph::ParalleMtNuma(size_t num_nodes,
     OPENVINO_ASSERT(num_nodes > 1, "Parallel Nodes must be more than 1. But now got ",
                                    num_nodes,
                                    " Nodes, which shouldn't invoke multi nodes parallel.");
-    std::atomic<int> nodes_remain(num_nodes);
+    // the sub stream tasks may still be running when the main stream starts waiting,
+    // so the sync state is shared with them instead of living on the stack of this function
+    struct SyncState {
+        explicit SyncState(int n) : nodes_remain(n) {}
+        std::atomic<int> nodes_remain;
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    auto sync = std::make_shared<SyncState>(static_cast<int>(num_nodes));
+    auto node_done = [](SyncState& state) {
+        if (state.nodes_remain.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.cv.notify_all();
+        }
+    };
     int cur_numa_id = executor->get_numa_node_id();
     // enqueue (nsockets-1) sub stream tasks
     int sub_stream_id = 0;
@@ -1405,10 +1422,10 @@ void Graph::ParalleMtNuma(size_t num_nodes,
             size_t i0{0}, i1{0};
             splitter(num_nodes, num_nodes, socket_id, i0, i1);
             executor->run_sub_stream(
-                [socket_id, i0, i1, &func, &nodes_remain]() {
+                [socket_id, i0, i1, &func, sync, node_done]() {
                     for (size_t i = i0; i < i1; i++) {
                         func(socket_id, i);
-                        nodes_remain--;
+                        node_done(*sync);
                     }
                 },
                 sub_stream_id);
@@ -1421,11 +1438,20 @@ void Graph::ParalleMtNuma(size_t num_nodes,
         splitter(num_nodes, num_nodes, static_cast<size_t>(cur_numa_id), i0, i1);
         for (size_t i = i0; i < i1; i++) {
             func(cur_numa_id, i);
-            nodes_remain--;
+            node_done(*sync);
         }
     }
-    // wait and sync
-    while (nodes_remain.load() > 0) {}
+    // wait and sync: the nodes of one group are of similar size, so spin shortly first
+    // and then sleep instead of burning the core of the main stream until the slowest socket finishes
+    constexpr int spin_count = 1 << 14;
+    for (int i = 0; i < spin_count; i++) {
+        if (sync->nodes_remain.load(std::memory_order_acquire) == 0)
+            return;
+    }
+    std::unique_lock<std::mutex> lock(sync->mutex);
+    sync->cv.wait(lock, [&] {
+        return sync->nodes_remain.load(std::memory_order_acquire) == 0;
+    });
 }
 
 void Graph::Infer(SyncInferRequest* request) {
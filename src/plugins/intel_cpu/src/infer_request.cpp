@@ -13,6 +13,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "nodes/memory.hpp"
 #include "openvino/core/shape.hpp"
+#include "openvino/op/parameter.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "proxy_mem_mgr.h"
@@ -147,6 +148,11 @@ void SyncInferRequest::infer() {
     if (!m_memory_states.empty()) {
         commit_states();
     }
+
+    if (m_paged_step_pending) {
+        m_paged_scheduler->step_done();
+        m_paged_step_pending = false;
+    }
 }
 
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
@@ -324,6 +330,56 @@ void SyncInferRequest::throw_if_canceled() const {
     }
 }
 
+namespace {
+// PagedAttentionExtension inputs owned by the scheduler
+constexpr size_t paged_attn_key_cache = 3;
+constexpr size_t paged_attn_is_prompt = 5;
+constexpr size_t paged_attn_slot_mapping = 6;
+constexpr size_t paged_attn_max_context_len = 7;
+constexpr size_t paged_attn_context_lens = 8;
+constexpr size_t paged_attn_block_tables = 9;
+}  // namespace
+
+const ov::Output<const ov::Node>& SyncInferRequest::get_paged_attn_input(size_t input_idx) const {
+    const auto& model = m_compiled_model->m_model;
+    // all the PagedAttention layers of a model share the scheduling inputs and the shape of the caches
+    for (const auto& op : model->get_ordered_ops()) {
+        if (op->get_type_name() != std::string("PagedAttentionExtension"))
+            continue;
+        auto param = ov::as_type_ptr<ov::op::v0::Parameter>(op->get_input_node_shared_ptr(input_idx));
+        OPENVINO_ASSERT(param, "PagedAttention input ", input_idx, " is expected to be a model input");
+        return m_input_ports_map.at(static_cast<size_t>(model->get_parameter_index(param)));
+    }
+    OPENVINO_THROW("The model has no PagedAttention to schedule sequences for");
+}
+
+void SyncInferRequest::add_sequence(uint64_t id, size_t prompt_len) {
+    if (!m_paged_scheduler) {
+        // key cache: [num_blocks, Hk, block_size, S]
+        const auto key_cache_shape = get_tensor(get_paged_attn_input(paged_attn_key_cache))->get_shape();
+        OPENVINO_ASSERT(key_cache_shape.size() == 4, "PagedAttention key cache is expected to be 4D");
+        m_paged_scheduler = std::make_unique<PagedBatchScheduler>(key_cache_shape[0], key_cache_shape[2]);
+    }
+    m_paged_scheduler->add_sequence(id, prompt_len);
+}
+
+void SyncInferRequest::remove_sequence(uint64_t id) {
+    OPENVINO_ASSERT(m_paged_scheduler, "No sequences were added to the infer request");
+    m_paged_scheduler->remove_sequence(id);
+}
+
+PagedBatchStep SyncInferRequest::schedule_step() {
+    OPENVINO_ASSERT(m_paged_scheduler, "No sequences were added to the infer request");
+    auto step = m_paged_scheduler->schedule();
+    set_tensor(get_paged_attn_input(paged_attn_is_prompt), ov::get_tensor_impl(step.is_prompt));
+    set_tensor(get_paged_attn_input(paged_attn_slot_mapping), ov::get_tensor_impl(step.slot_mapping));
+    set_tensor(get_paged_attn_input(paged_attn_max_context_len), ov::get_tensor_impl(step.max_context_len));
+    set_tensor(get_paged_attn_input(paged_attn_context_lens), ov::get_tensor_impl(step.context_lens));
+    set_tensor(get_paged_attn_input(paged_attn_block_tables), ov::get_tensor_impl(step.block_tables));
+    m_paged_step_pending = true;
+    return step;
+}
+
 ov::SoPtr<ov::ITensor> SyncInferRequest::get_tensor(const ov::Output<const ov::Node>& in_port) const {
     auto port = get_internal_port(in_port);
     return ov::ISyncInferRequest::get_tensor(port);
@@ -9,6 +9,7 @@
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "memory_state.h"
+#include "paged_batch_scheduler.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -47,6 +48,20 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Continuous batching of a model with PagedAttentionExtension. Sequences join and leave between any two
+     * steps. The scheduler is created by the first add_sequence() from the shape of the key cache tensor.
+     */
+    void add_sequence(uint64_t id, size_t prompt_len);
+    void remove_sequence(uint64_t id);
+
+    /**
+     * @brief Schedules the next step and sets is_prompt, slot_mapping, max_context_len, context_lens and block_tables
+     * of the request. The caller sets query, key and value in the layout of the returned step, its tokens are marked
+     * as cached after the next successful infer().
+     */
+    PagedBatchStep schedule_step();
+
 private:
     class OutputControlBlock {
     public:
@@ -104,6 +119,7 @@ private:
     void change_default_ptr();
 
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
+    const ov::Output<const ov::Node>& get_paged_attn_input(size_t input_idx) const;
 
 private:
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
@@ -120,6 +136,9 @@ private:
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_output_ports_map;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_outputs;
+
+    std::unique_ptr<PagedBatchScheduler> m_paged_scheduler;
+    bool m_paged_step_pending = false;
 };
 
 }  // namespace intel_cpu
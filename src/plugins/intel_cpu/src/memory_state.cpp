@@ -4,6 +4,10 @@
 
 #include "memory_state.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 #include <nodes/common/cpu_convert.h>
 #include "cpu_memory.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
@@ -14,6 +18,7 @@
 #include "openvino/core/parallel.hpp"
 #include "nodes/common/cpu_convert.h"
 #include "nodes/kernels/scaled_attn/attn_quant.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 using namespace ov::Extensions::Cpu::XARCH;
 
@@ -166,7 +171,15 @@ VariableStateKVcache::VariableStateKVcache(
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
+VariableStateKVcache::~VariableStateKVcache() {
+    try {
+        drop_swapped();
+    } catch (...) {
+    }
+}
+
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
+    ensure_swapped_in();
     if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
@@ -231,6 +244,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
 }
 
 void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
+    drop_swapped();
     //1. reset the memory object
     m_state = state; // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -291,8 +305,305 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
 }
 
+size_t VariableStateKVcache::get_length() const {
+    // the length is known without restoring the swapped out cache
+    if (m_swapped) {
+        return m_swapped->dims[2];
+    }
+    if (!m_internal_mem || is_reset_state()) {
+        return 0;
+    }
+    // internal order is [B, H, L, S]
+    return m_internal_mem->getDescWithType<BlockedMemoryDesc>()->getBlockDims()[2];
+}
+
+void VariableStateKVcache::truncate(size_t length) {
+    if (length == 0) {
+        reset();
+        return;
+    }
+    ensure_swapped_in();
+    OPENVINO_ASSERT(m_internal_mem && m_hidden_state && !is_reset_state(),
+                    "Cannot truncate KV cache state ",
+                    get_name(),
+                    " which has not been initialized");
+
+    auto internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto&& order = internal_desc->getOrder();
+    auto block_dims = internal_desc->getBlockDims();
+    OPENVINO_ASSERT(block_dims.size() == 4);
+    OPENVINO_ASSERT(length <= block_dims[2],
+                    "Cannot truncate KV cache state ",
+                    get_name(),
+                    " to ",
+                    length,
+                    " tokens, it contains only ",
+                    block_dims[2]);
+    if (length == block_dims[2]) {
+        return;
+    }
+
+    // keep the strides, so the capacity along L is preserved and the next append is done in place
+    block_dims[2] = length;
+    VectorDims dims(block_dims.size());
+    for (size_t i = 0; i < block_dims.size(); i++) {
+        dims[order[i]] = block_dims[i];
+    }
+    auto new_internal_desc = std::make_shared<CpuBlockedMemoryDesc>(internal_desc->getPrecision(),
+                                                                    Shape(dims),
+                                                                    block_dims,
+                                                                    order,
+                                                                    0,
+                                                                    VectorDims{},
+                                                                    internal_desc->getStrides());
+    m_internal_mem->redefineDesc(new_internal_desc);
+
+    auto hidden_desc = m_hidden_state->getDescWithType<BlockedMemoryDesc>();
+    VectorDims hidden_dims{block_dims[0], length};
+    auto new_hidden_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                  Shape(hidden_dims),
+                                                                  hidden_dims,
+                                                                  VectorDims{0, 1},
+                                                                  0,
+                                                                  VectorDims{},
+                                                                  hidden_desc->getStrides());
+    m_hidden_state->redefineDesc(new_hidden_desc);
+    // m_scale_zp is addressed by the token index and keeps its capacity, nothing to do
+}
+
+void VariableStateKVcache::compact(size_t past_len, const std::vector<size_t>& accepted) {
+    ensure_swapped_in();
+    auto length = get_length();
+    OPENVINO_ASSERT(past_len <= length,
+                    "KV cache state ",
+                    get_name(),
+                    " contains ",
+                    length,
+                    " tokens, past length ",
+                    past_len,
+                    " is out of range");
+    for (size_t i = 0; i < accepted.size(); i++) {
+        OPENVINO_ASSERT(past_len + accepted[i] < length && (i == 0 || accepted[i] > accepted[i - 1]),
+                        "KV cache state ",
+                        get_name(),
+                        " got invalid accepted token offsets");
+    }
+
+    PlainTensor pastkv, beam_table;
+    pastkv.reset(m_internal_mem);
+    pastkv = pastkv.permute(m_internal_mem->getDescWithType<BlockedMemoryDesc>()->getOrder());
+    beam_table.reset(m_hidden_state);
+    auto B = pastkv.size(0);
+    auto H = pastkv.size(1);
+    auto S = pastkv.size(3);
+    auto is_u8 = pastkv.get_precision() == element::u8;
+    parallel_for2d(B, H, [&](size_t b, size_t h) {
+        for (size_t i = 0; i < accepted.size(); i++) {
+            auto src = past_len + accepted[i];
+            auto dst = past_len + i;
+            if (src == dst)
+                continue;
+            std::memcpy(pastkv.ptr_v(b, h, dst), pastkv.ptr_v(b, h, src), S * pastkv.m_element_size);
+            if (is_u8) {
+                m_scale_zp.at<float>({b, h, dst, size_t{0}}) = m_scale_zp.at<float>({b, h, src, size_t{0}});
+                m_scale_zp.at<float>({b, h, dst, size_t{1}}) = m_scale_zp.at<float>({b, h, src, size_t{1}});
+            }
+        }
+    });
+    for (size_t b = 0; b < B; b++) {
+        for (size_t i = 0; i < accepted.size(); i++) {
+            beam_table.at<int32_t>({b, past_len + i}) = beam_table.at<int32_t>({b, past_len + accepted[i]});
+        }
+    }
+
+    truncate(past_len + accepted.size());
+}
+
+void VariableStateKVcache::swap_out(const std::string& spill_file) {
+    OPENVINO_ASSERT(!m_swapped, "KV cache state ", get_name(), " is already swapped out");
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        return;
+    }
+
+    PlainTensor pastkv, beam_table;
+    pastkv.reset(m_internal_mem);
+    pastkv = pastkv.permute(m_internal_mem->getDescWithType<BlockedMemoryDesc>()->getOrder());
+    beam_table.reset(m_hidden_state);
+    auto B = pastkv.size(0);
+    auto H = pastkv.size(1);
+    auto L0 = pastkv.size(2);
+    auto S = pastkv.size(3);
+    auto is_u8 = pastkv.get_precision() == element::u8;
+
+    std::unique_ptr<SwappedKV> swapped(new SwappedKV);
+    swapped->dims = {B, H, L0, S};
+    if (is_u8) {
+        swapped->scale_zp.resize(B * H * L0 * 2);
+    }
+    // rows are stored in [B, H, L] order with the beam table applied
+    auto row_idx = [&](size_t b, size_t h, size_t m) {
+        return (b * H + h) * L0 + m;
+    };
+    if (!spill_file.empty()) {
+        std::ofstream out(spill_file, std::ios::binary);
+        OPENVINO_ASSERT(out.is_open(), "Cannot open ", spill_file, " to swap out KV cache state ", get_name());
+        auto row_size = S * pastkv.m_element_size;
+        for (size_t b = 0; b < B; b++) {
+            for (size_t h = 0; h < H; h++) {
+                for (size_t m = 0; m < L0; m++) {
+                    auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
+                    out.write(static_cast<const char*>(pastkv.ptr_v(b_kv, h, m)), row_size);
+                    if (is_u8) {
+                        std::memcpy(&swapped->scale_zp[row_idx(b, h, m) * 2], m_scale_zp.ptr<float>(b_kv, h, m), 2 * sizeof(float));
+                    }
+                }
+            }
+        }
+        OPENVINO_ASSERT(out.good(), "Failed to write ", spill_file, " to swap out KV cache state ", get_name());
+        swapped->spill_file = spill_file;
+    } else {
+        swapped->data.resize(B * H * L0 * S);
+        if (is_u8) {
+            parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+                auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
+                std::memcpy(&swapped->data[row_idx(b, h, m) * S], pastkv.ptr<uint8_t>(b_kv, h, m), S);
+                std::memcpy(&swapped->scale_zp[row_idx(b, h, m) * 2], m_scale_zp.ptr<float>(b_kv, h, m), 2 * sizeof(float));
+            });
+        } else {
+            swapped->scale_zp.resize(B * H * L0 * 2);
+            auto nthr = parallel_get_max_threads();
+            std::vector<PlainTensor> buffers(nthr);
+            parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
+                auto b_kv = static_cast<size_t>(beam_table.at<int32_t>({b, m}));
+                auto idx = row_idx(b, h, m);
+                buffers[ithr].resize<float>({S});
+                cpu_convert(pastkv.ptr_v(b_kv, h, m), buffers[ithr].ptr<float>(), pastkv.m_dt, element::f32, S);
+                attn_quant_u8(buffers[ithr].ptr<float>(),
+                              &swapped->data[idx * S],
+                              S,
+                              swapped->scale_zp[idx * 2],
+                              swapped->scale_zp[idx * 2 + 1]);
+            });
+        }
+    }
+
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = PlainTensor();
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    m_swapped = std::move(swapped);
+}
+
+void VariableStateKVcache::prefetch() {
+    if (m_swapped && !m_swapped->restore.valid()) {
+        m_swapped->restore = std::async(std::launch::async, [this] {
+            restore_swapped();
+        });
+    }
+}
+
+void VariableStateKVcache::swap_in() {
+    if (!m_swapped) {
+        return;
+    }
+    if (m_swapped->restore.valid()) {
+        m_swapped->restore.get();
+    } else {
+        restore_swapped();
+    }
+    if (!m_swapped->spill_file.empty()) {
+        std::remove(m_swapped->spill_file.c_str());
+    }
+    m_swapped.reset();
+}
+
+void VariableStateKVcache::restore_swapped() {
+    const auto& swapped = *m_swapped;
+    auto B = swapped.dims[0];
+    auto H = swapped.dims[1];
+    auto L0 = swapped.dims[2];
+    auto S = swapped.dims[3];
+    auto&& order = m_dense_internal_desc->getOrder();
+    VectorDims dims(swapped.dims.size());
+    for (size_t i = 0; i < dims.size(); i++) {
+        dims[order[i]] = swapped.dims[i];
+    }
+    auto internal_mem = std::make_shared<Memory>(get_engine(), m_dense_internal_desc->cloneWithNewDims(dims));
+    PlainTensor pastkv;
+    pastkv.reset(internal_mem);
+    pastkv = pastkv.permute(order);
+    auto is_u8 = pastkv.get_precision() == element::u8;
+    auto row_idx = [&](size_t b, size_t h, size_t m) {
+        return (b * H + h) * L0 + m;
+    };
+
+    if (!swapped.spill_file.empty()) {
+        auto mapped = ov::load_mmap_object(swapped.spill_file);
+        auto row_size = S * pastkv.m_element_size;
+        OPENVINO_ASSERT(mapped && mapped->size() == B * H * L0 * row_size,
+                        "Spill file ",
+                        swapped.spill_file,
+                        " of KV cache state ",
+                        get_name(),
+                        " is corrupted");
+        parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+            std::memcpy(pastkv.ptr_v(b, h, m), mapped->data() + row_idx(b, h, m) * row_size, row_size);
+        });
+    } else if (is_u8) {
+        parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+            std::memcpy(pastkv.ptr<uint8_t>(b, h, m), &swapped.data[row_idx(b, h, m) * S], S);
+        });
+    } else {
+        auto nthr = parallel_get_max_threads();
+        std::vector<PlainTensor> buffers(nthr);
+        parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
+            auto idx = row_idx(b, h, m);
+            buffers[ithr].resize<float>({S});
+            attn_dequant_u8(&swapped.data[idx * S],
+                            buffers[ithr].ptr<float>(),
+                            S,
+                            swapped.scale_zp[idx * 2],
+                            swapped.scale_zp[idx * 2 + 1]);
+            cpu_convert(buffers[ithr].ptr<float>(), pastkv.ptr_v(b, h, m), element::f32, pastkv.m_dt, S);
+        });
+    }
+    if (is_u8) {
+        m_scale_zp.resize<float>({B, H, L0, 2});
+        std::memcpy(m_scale_zp.ptr<float>(), swapped.scale_zp.data(), swapped.scale_zp.size() * sizeof(float));
+    }
+
+    // the rows were stored with the beam table applied
+    auto hidden_state = std::make_shared<Memory>(get_engine(),
+                                                 std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{B, L0}));
+    auto buff = hidden_state->getDataAs<int32_t>();
+    for (size_t b = 0; b < B; b++) {
+        for (size_t m = 0; m < L0; m++) {
+            buff[b * L0 + m] = static_cast<int32_t>(b);
+        }
+    }
+
+    m_internal_mem = internal_mem;
+    m_hidden_state = hidden_state;
+    m_internal_mem_max_size = B * H * L0 * S;
+    m_hidden_state_max_size = B * L0;
+}
+
+void VariableStateKVcache::drop_swapped() {
+    if (!m_swapped) {
+        return;
+    }
+    if (m_swapped->restore.valid()) {
+        m_swapped->restore.wait();
+    }
+    if (!m_swapped->spill_file.empty()) {
+        std::remove(m_swapped->spill_file.c_str());
+    }
+    m_swapped.reset();
+}
+
 void VariableStateKVcache::reset_impl() {
-    //nothing to do
+    drop_swapped();
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -300,10 +611,12 @@ void VariableStateKVcache::commit_impl() {
 }
 
 MemoryPtr VariableStateKVcache::input_mem() {
+    ensure_swapped_in();
     return m_internal_mem;
 }
 
 MemoryPtr VariableStateKVcache::output_mem() {
+    ensure_swapped_in();
     return m_internal_mem;
 }
 
@@ -312,6 +625,7 @@ MemoryDescPtr VariableStateKVcache::internal_desc() const {
 }
 
 MemoryPtr VariableStateKVcache::internal_state_mem() const {
+    ensure_swapped_in();
     return m_internal_mem;
 }
 
@@ -320,6 +634,7 @@ void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
+    ensure_swapped_in();
     return m_hidden_state;
 }
 
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <future>
+#include <memory>
+#include <string>
+
 #include "cpu_memory.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -99,6 +103,7 @@ public:
     VariableStateKVcache(const std::string& name,
                          const MemoryDescPtr& external_desc,
                          const BlockedMemoryDescPtr& dense_internal_desc);
+    ~VariableStateKVcache() override;
 
     //ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -129,7 +134,35 @@ public:
         m_hidden_state_max_size = max_size;
     }
 
+    // Drops the tail of the cache so that only the first `length` tokens are kept. Only the memory
+    // descriptors are redefined, the buffers and the beam table keep their capacity, so rejecting
+    // the draft tokens of speculative decoding costs O(1). truncate(0) is equivalent to reset().
+    void truncate(size_t length);
+
+    // Keeps the first `past_len` tokens plus the tokens at offsets `accepted` (relative to `past_len`,
+    // strictly increasing) and truncates the rest. Used after verifying a token tree with a tree
+    // attention mask, when the accepted branch is not a prefix of the appended tokens. Only the
+    // accepted rows are moved.
+    void compact(size_t past_len, const std::vector<size_t>& accepted);
+
+    // current number of tokens in the cache
+    size_t get_length() const;
+
+    // Releases the cache buffers of an idle session. The cache is kept in host memory compressed to u8
+    // (per token asymmetric quantization, an u8 cache is kept as is), or, if spill_file is not empty, it's
+    // written to that file in its own precision and is mmapped back. The beam table is resolved on the way
+    // out. Any access to the cache swaps it in implicitly.
+    void swap_out(const std::string& spill_file = {});
+    // Starts swapping the cache in on a background thread, e.g. when the session is about to come back.
+    void prefetch();
+    // Restores the cache, waits for the prefetch if there is one. The spill file is removed afterwards.
+    void swap_in();
+    bool is_swapped_out() const {
+        return m_swapped != nullptr;
+    }
+
     PlainTensor& get_scale_zp() {
+        ensure_swapped_in();
         return m_scale_zp;
     }
     void set_scale_zp(const PlainTensor& t) {
@@ -142,7 +175,22 @@ private:
     void reset_impl() override;
     void commit_impl() override;
 
+    void restore_swapped();
+    void drop_swapped();
+    void ensure_swapped_in() const {
+        if (m_swapped)
+            const_cast<VariableStateKVcache*>(this)->swap_in();
+    }
+
 private:
+    struct SwappedKV {
+        VectorDims dims;               // [B, H, L, S]
+        std::vector<uint8_t> data;     // u8 rows, empty if spilled to the file
+        std::vector<float> scale_zp;   // [B, H, L, 2], for u8 rows
+        std::string spill_file;        // rows in the cache precision
+        std::future<void> restore;
+    };
+
     MemoryPtr m_internal_mem; // kv cache
     MemoryPtr m_hidden_state; // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -153,6 +201,8 @@ private:
 
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
+
+    std::unique_ptr<SwappedKV> m_swapped;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <vector>
 #include <string>
 #include "dnnl_types.h"
@@ -44,6 +46,18 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+namespace {
+inline void prefetchRow(const void* row, size_t bytes) {
+#if defined(__GNUC__) || defined(__clang__)
+    constexpr size_t cacheLineSize = 64lu;
+    // gathered rows are far from each other in big tables, so the hardware prefetcher can't predict them
+    const char* ptr = static_cast<const char*>(row);
+    for (size_t offset = 0lu; offset < bytes; offset += cacheLineSize)
+        __builtin_prefetch(ptr + offset);
+#endif
+}
+}  // namespace
+
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const VectorDims& inDataDims, const MemoryPtr& outMemory) {
@@ -53,63 +67,76 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
 
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto *dstData = outMemory->getDataAs<T>();
+    // local copies let the compiler keep them in registers and vectorize the row loops
+    const size_t embDepth = _embDepth;
+    const size_t tableRows = inDataDims[0];
+    const size_t rowBytes = embDepth * sizeof(T);
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
-        size_t indicesSize = 0lu;
+    struct Bag {
         const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        size_t size = 0lu;
+        int weightsIdx = 0;
+        bool withWeights = false;
+    };
+
+    // Bags may contain very different number of indices, so the work is split between threads by the number
+    // of accumulated rows instead of the number of bags. bagsWork[i] is the amount of work before the bag i.
+    std::vector<Bag> bags(outputBagsNum);
+    std::vector<size_t> bagsWork(outputBagsNum + 1lu, 0lu);
+    parallel_for(outputBagsNum, [&](size_t obi) {
+        auto& bag = bags[obi];
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights & _withWeights;
+        // one more item for the output row initialization
+        bagsWork[obi + 1lu] = (bag.indices != nullptr ? bag.size : 0lu) + 1lu;
+    });
+    std::partial_sum(bagsWork.begin(), bagsWork.end(), bagsWork.begin());
+    const size_t totalWork = bagsWork.back();
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        // the bag belongs to the thread which work range contains the first item of the bag
+        const auto bagsWorkEnd = bagsWork.begin() + outputBagsNum;
+        const size_t start = std::lower_bound(bagsWork.begin(), bagsWorkEnd, totalWork * ithr / nthr) - bagsWork.begin();
+        const size_t end = std::lower_bound(bagsWork.begin(), bagsWorkEnd, totalWork * (ithr + 1) / nthr) - bagsWork.begin();
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const auto& bag = bags[obi];
+            T* dst = dstData + obi * embDepth;
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+            if (bag.indices == nullptr || bag.size == 0lu) {
+                std::fill(dst, dst + embDepth, static_cast<T>(0));
+                continue;
+            }
 
-                size_t inIdx = 0lu;
-                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+            int weightsIdx = bag.weightsIdx;
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                const size_t rowIdx = static_cast<size_t>(bag.indices[inIdx]);
+                if (rowIdx >= tableRows) {
+                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[inIdx]));
                 }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
+                if (inIdx + 1lu < bag.size && static_cast<size_t>(bag.indices[inIdx + 1lu]) < tableRows) {
+                    prefetchRow(srcData + bag.indices[inIdx + 1lu] * embDepth, rowBytes);
                 }
+                const T* src = srcData + rowIdx * embDepth;
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                        OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                if (bag.withWeights) {
+                    const T weight = weightsData[weightsIdx++];
+                    if (inIdx == 0lu) {
+                        for (size_t i = 0lu; i < embDepth; i++)
+                            dst[i] = src[i] * weight;
+                    } else {
+                        for (size_t i = 0lu; i < embDepth; i++)
+                            dst[i] += src[i] * weight;
                     }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
+                } else {
+                    if (inIdx == 0lu) {
+                        std::copy(src, src + embDepth, dst);
                     } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
+                        for (size_t i = 0lu; i < embDepth; i++)
+                            dst[i] += src[i];
                     }
                 }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
             }
         }
     };
@@ -88,6 +88,20 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = getSrcDataAtPortAs<const int>(DEFAULT_INDEX_IDX);
     }
+
+    // Collect the first position and the size of every segment in one pass, so getIndices doesn't have to scan
+    // all the segment ids for each output bag. Ids out of the [0, numSegments) range don't belong to any bag.
+    const size_t numSegments = lastNumSegments_ > 0 ? static_cast<size_t>(lastNumSegments_) : 0lu;
+    segmentsBegin_.assign(numSegments, -1);
+    segmentsSize_.assign(numSegments, 0lu);
+    for (size_t si = 0lu; si < indicesSize_; si++) {
+        const auto segmentId = static_cast<size_t>(segmentIds_[si]);
+        if (segmentId >= numSegments)
+            continue;
+        if (segmentsBegin_[segmentId] < 0)
+            segmentsBegin_[segmentId] = static_cast<int>(si);
+        segmentsSize_[segmentId]++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -95,17 +109,12 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size
         OPENVINO_THROW("Invalid embedding bag index.");
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
@@ -43,6 +43,10 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    // position of the first index and number of indices of each segment
+    std::vector<int> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }   // namespace node
@@ -16,6 +16,7 @@
 #define UNSUPPORTED_DST_RANK " unsupported dst rank"
 #define UNSUPPORTED_DST_STRIDES " unsupported dst strides"
 #define HEURISTICS_MISMATCH " heuristics mismatch"
+#define UNSUPPORTED_IMPL_PRIORITY " another implementation is prioritized"
 
 #define VERIFY(condition, ...) \
     do { \
@@ -8,10 +8,18 @@
 
 #include "cpu_memory.h"
 #include "executor_config.hpp"
+#include "onednn/iml_type_mapper.h"
 
 namespace ov {
 namespace intel_cpu {
 
+// compressed formats of constant weights with structured sparsity
+enum class SparseWeightsFormat {
+    None,
+    Blocked,  // only non zero blocks of 16 output channels x 1 input channel are stored
+    NM,       // every output channel has at most 2 non zero weights in each 4 input channels (2:4)
+};
+
 // @todo require explicit initialization of all the attributes?
 struct FCAttrs {
     // @todo probably we don't want with bias flag, since this information is already
@@ -19,6 +27,7 @@ struct FCAttrs {
     bool withBias = false;
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
+    SparseWeightsFormat sparseWeightsFormat = SparseWeightsFormat::None;
     // @todo only memory descriptors should be a part of attributes
     // actual memory should be passed into "execute" or "prepareMemory" calls
     std::vector<float> dequantizationScales;
@@ -26,6 +35,8 @@ struct FCAttrs {
     MemoryCPtr decompressionSubtractPtr;
     MemoryCPtr decompressionMultiplyPtr;
     uint64_t dynamicQuantizationGroupSize;
+    // the first entry of the node implementation priorities ("primitivesPriority" runtime info)
+    impl_desc_type preferredImplType = impl_desc_type::unknown;
 };
 
 using FCConfig = executor::Config<FCAttrs>;
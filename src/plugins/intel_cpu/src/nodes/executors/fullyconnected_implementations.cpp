@@ -22,6 +22,9 @@
 #include "nodes/executors/precision_matcher.hpp"
 #include "nodes/executors/precision_translation.hpp"
 #include "nodes/executors/type_mask.hpp"
+#include "nodes/executors/x64/dynquant_fullyconnected.hpp"
+#include "nodes/executors/x64/sparse_fullyconnected.hpp"
+#include "nodes/executors/x64/w4_fullyconnected.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "ov_optional.hpp"
 #include "utils/cpp/maybe_unused.hpp"
@@ -169,6 +172,32 @@ OV_CPU_MAYBE_UNUSED_FUNCTION static inline bool noPostOps(const FCConfig& config
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_sparse",
+            ExecutorType::Common,
+            OperationType::FullyConnected,
+            ShapeTolerance::Dependant,
+            // supports
+            [](const FCConfig& config) -> bool {
+                return SparseFCExecutor::supports(config);
+            },
+            // requiresFallback
+            [](const FCConfig& config) -> ov::optional<executor::Config<FCAttrs>> {
+                // supported configurations are exactly the ones which do not require a fallback
+                return {};
+            },
+            // acceptsShapes
+            [](const MemoryArgs& memory) -> bool {
+                // N:M weights are rejected for big M by the executor update()
+                return true;
+            },
+            // create
+            [](const FCAttrs& attrs,
+               const PostOps& postOps,
+               const MemoryArgs& memory,
+               const ExecutorContext::CPtr context) {
+                return std::make_shared<SparseFCExecutor>(attrs, postOps, memory, context);
+            })
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
@@ -205,6 +234,56 @@ const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
                const ExecutorContext::CPtr context) {
                 return std::make_shared<MlasGemmExecutor>(attrs, postOps, memory, context);
             })
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_w4",
+            ExecutorType::Common,
+            OperationType::FullyConnected,
+            ShapeTolerance::Dependant,
+            // supports
+            [](const FCConfig& config) -> bool {
+                return W4FCExecutor::supports(config);
+            },
+            // requiresFallback
+            [](const FCConfig& config) -> ov::optional<executor::Config<FCAttrs>> {
+                // supported configurations are exactly the ones which do not require a fallback
+                return {};
+            },
+            // acceptsShapes
+            [](const MemoryArgs& memory) -> bool {
+                return W4FCExecutor::acceptsShapes(memory);
+            },
+            // create
+            [](const FCAttrs& attrs,
+               const PostOps& postOps,
+               const MemoryArgs& memory,
+               const ExecutorContext::CPtr context) {
+                return std::make_shared<W4FCExecutor>(attrs, postOps, memory, context);
+            })
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_dynamic_quantization",
+            ExecutorType::Common,
+            OperationType::FullyConnected,
+            ShapeTolerance::Dependant,
+            // supports
+            [](const FCConfig& config) -> bool {
+                return DynQuantFCExecutor::supports(config);
+            },
+            // requiresFallback
+            [](const FCConfig& config) -> ov::optional<executor::Config<FCAttrs>> {
+                // supported configurations are exactly the ones which do not require a fallback
+                return {};
+            },
+            // acceptsShapes
+            [](const MemoryArgs& memory) -> bool {
+                return true;
+            },
+            // create
+            [](const FCAttrs& attrs,
+               const PostOps& postOps,
+               const MemoryArgs& memory,
+               const ExecutorContext::CPtr context) {
+                return std::make_shared<DynQuantFCExecutor>(attrs, postOps, memory, context);
+            })
         OV_CPU_INSTANCE_X64(
             "convolution_1x1_dnnl",
             ExecutorType::Dnnl,
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "decompression_params.hpp"
+
+#include <cstdint>
+
+#include "nodes/common/cpu_convert.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace ov::element;
+
+namespace {
+
+std::vector<float> toFloat(const MemoryCPtr& mem) {
+    const auto precision = mem->getDesc().getPrecision();
+    const auto size = mem->getShape().getElementsCount();
+    std::vector<float> values(size);
+    if (one_of(precision, u4, i4)) {
+        const auto* data = static_cast<const uint8_t*>(mem->getData());
+        for (size_t i = 0; i < size; i++) {
+            const uint8_t code = (data[i / 2] >> (4 * (i % 2))) & 0x0F;
+            values[i] = precision == i4 ? static_cast<float>(static_cast<int8_t>(code << 4) >> 4) : code;
+        }
+    } else {
+        cpu_convert(mem->getData(), values.data(), precision, f32, size);
+    }
+    return values;
+}
+
+}  // namespace
+
+WeightsLayout weightsLayout(const VectorDims& dims, bool weightsNonTransposed) {
+    return weightsNonTransposed ? WeightsLayout{dims[1], dims[0]} : WeightsLayout{dims[0], dims[1]};
+}
+
+size_t decompressionGroups(const MemoryCPtr& params, const WeightsLayout& wei, bool weightsNonTransposed) {
+    auto shape = params->getShape().getStaticDims();
+    if (shape.size() == 1 && shape[0] == 1)
+        shape.push_back(1);
+    if (shape.size() != 2 && shape.size() != 3)
+        return 0;
+    const size_t channels = weightsNonTransposed ? shape.back() : shape[0];
+    const size_t groups = weightsNonTransposed ? shape[0] : shape[1];
+    if (!one_of(channels, 1u, wei.N) || groups == 0 || wei.K % groups != 0)
+        return 0;
+    return groups;
+}
+
+std::vector<float> packDecompressionParams(const MemoryCPtr& params,
+                                           const WeightsLayout& wei,
+                                           size_t groups,
+                                           bool weightsNonTransposed,
+                                           size_t nBlock) {
+    const auto values = toFloat(params);
+    const size_t srcGroups = decompressionGroups(params, wei, weightsNonTransposed);
+    const size_t srcChannels = values.size() / srcGroups;
+    const size_t blocks = div_up(wei.N, nBlock);
+    std::vector<float> packed(blocks * groups * nBlock, 0.f);
+    for (size_t n = 0; n < wei.N; n++) {
+        const size_t c = srcChannels == 1 ? 0 : n;
+        for (size_t g = 0; g < groups; g++) {
+            // zero points may be per channel while scales are per group
+            const size_t sg = g * srcGroups / groups;
+            const size_t idx = weightsNonTransposed ? sg * srcChannels + c : c * srcGroups + sg;
+            packed[((n / nBlock) * groups + g) * nBlock + n % nBlock] = values[idx];
+        }
+    }
+    return packed;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
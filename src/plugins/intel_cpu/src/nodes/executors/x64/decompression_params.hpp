@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+struct WeightsLayout {
+    size_t N;
+    size_t K;
+};
+
+// Weights are [N, K] if transposed by MatMulConstTransposesExtraction and [K, N] otherwise
+WeightsLayout weightsLayout(const VectorDims& dims, bool weightsNonTransposed);
+
+/*
+ * Decompression scales / zero points are [N, groups] (or [N, groups, 1]) for transposed weights
+ * and [1, N] (or [groups, 1, N]) otherwise, the same way DnnlPostOpsComposer prepacks them.
+ * Returns the number of groups, or 0 if the layout is not supported.
+ */
+size_t decompressionGroups(const MemoryCPtr& params, const WeightsLayout& wei, bool weightsNonTransposed);
+
+// [N, groups] decompression params to [N / nBlock][groups][nBlock] f32 values, the padded channels are zeros
+std::vector<float> packDecompressionParams(const MemoryCPtr& params,
+                                           const WeightsLayout& wei,
+                                           size_t groups,
+                                           bool weightsNonTransposed,
+                                           size_t nBlock);
+
+}  // namespace intel_cpu
+}  // namespace ov
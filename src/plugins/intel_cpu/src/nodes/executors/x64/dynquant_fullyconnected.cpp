@@ -0,0 +1,266 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynquant_fullyconnected.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/executors/x64/decompression_params.hpp"
+#include "nodes/kernels/fullyconnected/gemm_i8.hpp"
+#include "openvino/core/parallel.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace executor;
+using namespace ov::element;
+using ov::Extensions::Cpu::XARCH::gemm_i8;
+using ov::Extensions::Cpu::XARCH::gemm_i8_k_pack;
+using ov::Extensions::Cpu::XARCH::gemm_i8_n_block;
+using ov::Extensions::Cpu::XARCH::quantize_u8;
+
+namespace {
+
+// rows of the activations which share the weights of one block of output channels
+constexpr size_t mBlock = 64;
+
+/*
+ * The activations are quantized with the granularity of both the dynamic quantization group
+ * and the weights decompression group, so every group of the kernel has a single scale of each.
+ * Returns 0 if the groups are not supported.
+ */
+size_t kernelGroupSize(const FCAttrs& attrs, const WeightsLayout& wei) {
+    const auto weiGroups = decompressionGroups(attrs.decompressionMultiplyPtr, wei, attrs.weightsNonTransposed);
+    if (weiGroups == 0)
+        return 0;
+    if (attrs.decompressionSubtractPtr) {
+        const auto zpGroups = decompressionGroups(attrs.decompressionSubtractPtr, wei, attrs.weightsNonTransposed);
+        if (!one_of(zpGroups, 1u, weiGroups))
+            return 0;
+    }
+
+    const size_t weiGroupSize = wei.K / weiGroups;
+    const size_t srcGroupSize = static_cast<size_t>(std::min<uint64_t>(attrs.dynamicQuantizationGroupSize, wei.K));
+    const size_t groupSize = std::min(weiGroupSize, srcGroupSize);
+    if (wei.K % srcGroupSize != 0 || std::max(weiGroupSize, srcGroupSize) % groupSize != 0 ||
+        groupSize % gemm_i8_k_pack != 0)
+        return 0;
+    return groupSize;
+}
+
+// u8 weights to s8 ones in the [N / 16][K / 4][16][4] layout expected by gemm_i8, the padded channels are zeros
+void packWeights(const uint8_t* src, int8_t* dst, const WeightsLayout& wei, bool weightsNonTransposed) {
+    const size_t N = wei.N;
+    const size_t K = wei.K;
+    parallel_for(div_up(N, gemm_i8_n_block), [&](size_t nb) {
+        int8_t* block = dst + nb * gemm_i8_n_block * K;
+        for (size_t k = 0; k < K; k++) {
+            for (size_t j = 0; j < gemm_i8_n_block; j++) {
+                const size_t n = nb * gemm_i8_n_block + j;
+                const auto w = n < N ? src[weightsNonTransposed ? k * N + n : n * K + k] : 128;
+                block[(k / gemm_i8_k_pack * gemm_i8_n_block + j) * gemm_i8_k_pack + k % gemm_i8_k_pack] =
+                    static_cast<int8_t>(w - 128);
+            }
+        }
+    });
+}
+
+MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
+                              const ExecutorContext::CPtr context,
+                              const WeightsLayout& wei,
+                              const bool weightsNonTransposed) {
+    DEBUG_LOG("DynQuantFCExecutor: prepack weights");
+    const size_t packedSize = div_up(wei.N, gemm_i8_n_block) * gemm_i8_n_block * wei.K;
+
+    auto create = [&]() {
+        MemoryPtr _ptr = std::make_shared<Memory>(context->getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(i8, intel_cpu::Shape{packedSize}));
+        DEBUG_LOG("DynQuantFCExecutor: cache miss, perform packing");
+        packWeights(weightsMemory->getDataAs<const uint8_t>(), _ptr->getDataAs<int8_t>(), wei, weightsNonTransposed);
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "fc_i8_" + std::to_string(wei.N) + "_" + std::to_string(wei.K) + "_" +
+                             std::to_string(weightsNonTransposed);
+        const std::string string_hash = format + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+            std::to_string(*weightsMemory->getDataAs<uint64_t>());
+        DEBUG_LOG("DynQuantFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return *weightCache->findOrCreate(string_hash, create);
+    }
+
+    DEBUG_LOG("DynQuantFCExecutor: Weights cache is not available");
+    return create();
+}
+
+impl_desc_type dynQuantImplType() {
+    return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? impl_desc_type::gemm_avx512
+                                                                           : impl_desc_type::gemm_avx2;
+}
+
+}  // namespace
+
+bool DynQuantFCExecutor::supports(const FCConfig& config) {
+    // AMX hosts are served by the oneDNN brgemm kernels
+    VERIFY(dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2), UNSUPPORTED_ISA);
+    VERIFY(!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx), UNSUPPORTED_ISA);
+    // another implementation is enforced by "primitivesPriority" runtime info
+    VERIFY(one_of(config.attrs.preferredImplType, impl_desc_type::unknown, impl_desc_type::undef, dynQuantImplType()),
+           UNSUPPORTED_IMPL_PRIORITY);
+    VERIFY(config.attrs.dynamicQuantizationGroupSize != 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    VERIFY(config.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(config.attrs.dequantizationScales.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(everyone_is(f32, srcType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(weiType(config) == u8, UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(!config.attrs.withBias || biaType(config) == f32, UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(weiRank(config) == 2, UNSUPPORTED_WEI_RANK);
+    VERIFY(config.descs.at(ARG_WEI)->getShape().isStatic(), UNSUPPORTED_WEI_RANK);
+
+    const auto& attrs = config.attrs;
+    VERIFY(attrs.decompressionMultiplyPtr, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    const auto wei = weightsLayout(config.descs.at(ARG_WEI)->getShape().getStaticDims(), attrs.weightsNonTransposed);
+    VERIFY(kernelGroupSize(attrs, wei) != 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+
+    return true;
+}
+
+DynQuantFCExecutor::DynQuantFCExecutor(const FCAttrs& attrs,
+                                       const PostOps& postOps,
+                                       const MemoryArgs& memory,
+                                       const ExecutorContext::CPtr context)
+    : m_attrs(attrs),
+      m_memoryArgs(memory),
+      m_context(context) {
+    const auto& weiMemory = memory.at(ARG_WEI);
+    const auto wei = weightsLayout(weiMemory->getStaticDims(), attrs.weightsNonTransposed);
+    N = wei.N;
+    K = wei.K;
+    m_groupSize = kernelGroupSize(attrs, wei);
+    const size_t groups = K / m_groupSize;
+
+    m_scales = packDecompressionParams(attrs.decompressionMultiplyPtr,
+                                       wei,
+                                       groups,
+                                       attrs.weightsNonTransposed,
+                                       gemm_i8_n_block);
+    // the weights are shifted from u8 to s8, so are the zero points
+    if (attrs.decompressionSubtractPtr) {
+        m_zeroPoints = packDecompressionParams(attrs.decompressionSubtractPtr,
+                                               wei,
+                                               groups,
+                                               attrs.weightsNonTransposed,
+                                               gemm_i8_n_block);
+    } else {
+        m_zeroPoints.resize(m_scales.size(), 0.f);
+    }
+    for (auto& zp : m_zeroPoints)
+        zp -= 128.f;
+
+    m_packedWeights = prepareWeightMemory(weiMemory, context, wei, attrs.weightsNonTransposed);
+
+    // the VNNI kernel multiplies the activations shifted to u8: sum_k (x + 128) * w = sum_k x * w + 128 * sum_k w,
+    // the other kernels multiply the signed ones and need no compensation
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni))
+        return;
+    const size_t nBlocks = div_up(N, gemm_i8_n_block);
+    const auto* packed = m_packedWeights->getDataAs<const int8_t>();
+    m_compensation.resize(nBlocks * groups * gemm_i8_n_block);
+    parallel_for2d(nBlocks, groups, [&](size_t nb, size_t g) {
+        int32_t* comp = m_compensation.data() + (nb * groups + g) * gemm_i8_n_block;
+        std::fill(comp, comp + gemm_i8_n_block, 0);
+        for (size_t k = g * m_groupSize; k < (g + 1) * m_groupSize; k++) {
+            const int8_t* w =
+                packed + (nb * K + k / gemm_i8_k_pack * gemm_i8_k_pack) * gemm_i8_n_block + k % gemm_i8_k_pack;
+            for (size_t j = 0; j < gemm_i8_n_block; j++)
+                comp[j] += 128 * w[j * gemm_i8_k_pack];
+        }
+    });
+}
+
+impl_desc_type DynQuantFCExecutor::implType() const {
+    return dynQuantImplType();
+}
+
+bool DynQuantFCExecutor::update(const MemoryArgs& memory) {
+    const auto& dstDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t groups = K / m_groupSize;
+    m_srcQuantized.resize(M * K);
+    m_srcScales.resize(M * groups);
+    m_srcSums.resize(M * groups);
+    return true;
+}
+
+void DynQuantFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = m_attrs.withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr;
+    const auto* wei = m_packedWeights->getDataAs<const int8_t>();
+    const size_t groups = K / m_groupSize;
+
+    parallel_for2d(M, groups, [&](size_t m, size_t g) {
+        const size_t offset = m * K + g * m_groupSize;
+        quantize_u8(src + offset,
+                    m_groupSize,
+                    m_srcQuantized.data() + offset,
+                    m_srcScales.data() + m * groups + g,
+                    m_srcSums.data() + m * groups + g);
+    });
+
+    parallel_for2d(div_up(M, mBlock), div_up(N, gemm_i8_n_block), [&](size_t mb, size_t nb) {
+        const size_t m0 = mb * mBlock;
+        const size_t n0 = nb * gemm_i8_n_block;
+        const size_t nValid = std::min(gemm_i8_n_block, N - n0);
+        const size_t paramsOffset = nb * groups * gemm_i8_n_block;
+        float biasTail[gemm_i8_n_block] = {};
+        const float* biasBlock = bias ? bias + n0 : nullptr;
+        if (bias && nValid < gemm_i8_n_block) {
+            std::memcpy(biasTail, biasBlock, nValid * sizeof(float));
+            biasBlock = biasTail;
+        }
+        gemm_i8(m_srcQuantized.data() + m0 * K,
+                std::min(mBlock, M - m0),
+                K,
+                m_srcScales.data() + m0 * groups,
+                m_srcSums.data() + m0 * groups,
+                m_groupSize,
+                wei + n0 * K,
+                m_scales.data() + paramsOffset,
+                m_zeroPoints.data() + paramsOffset,
+                m_compensation.empty() ? nullptr : m_compensation.data() + paramsOffset,
+                biasBlock,
+                dst + m0 * N + n0,
+                N,
+                nValid);
+    });
+}
+
+void DynQuantFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID)
+        return;
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (m_attrs.withBias) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
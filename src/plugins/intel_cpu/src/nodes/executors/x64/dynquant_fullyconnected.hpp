@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * FullyConnected with u8 weights decompression and dynamic quantization of f32 activations (W8A8 on the fly):
+ * the activations are quantized per row and per group of input channels at runtime, the products
+ * are computed by the int8 instructions (VNNI when available) and dequantized with the activation and weights scales.
+ * The activations group is the smaller one of hint::dynamic_quantization_group_size and the weights
+ * decompression group.
+ */
+class DynQuantFCExecutor : public Executor {
+public:
+    DynQuantFCExecutor(const FCAttrs& attrs,
+                       const PostOps& postOps,
+                       const MemoryArgs& memory,
+                       const ExecutorContext::CPtr context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    const FCAttrs& m_attrs;
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    size_t M = 0, N = 0, K = 0;
+    size_t m_groupSize = 0;
+    MemoryCPtr m_packedWeights;
+    // [N / block][groups][block]
+    std::vector<float> m_scales;
+    std::vector<float> m_zeroPoints;
+    // empty on hosts without avx512_vnni
+    std::vector<int32_t> m_compensation;
+    // quantized activations, their scales and sums
+    std::vector<uint8_t> m_srcQuantized;
+    std::vector<float> m_srcScales;
+    std::vector<int32_t> m_srcSums;
+    int curNumaNode = -1;
+};
+
+using DynQuantFCExecutorPtr = std::shared_ptr<DynQuantFCExecutor>;
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,350 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fullyconnected.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/fullyconnected/gemm_sparse.hpp"
+#include "openvino/core/parallel.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace executor;
+using namespace ov::element;
+using ov::Extensions::Cpu::XARCH::gemm_sparse_blocked;
+using ov::Extensions::Cpu::XARCH::gemm_sparse_n_block;
+using ov::Extensions::Cpu::XARCH::gemm_sparse_nm;
+using ov::Extensions::Cpu::XARCH::gemm_sparse_nm_group;
+using ov::Extensions::Cpu::XARCH::gemm_sparse_nm_max_m;
+using ov::Extensions::Cpu::XARCH::gemm_sparse_nm_nnz;
+
+namespace {
+
+// rows of the activations which share the weights of one block of output channels
+constexpr size_t mBlock = 64;
+
+// Weights are [N, K] if transposed by MatMulConstTransposesExtraction and [K, N] otherwise
+class WeightsView {
+public:
+    WeightsView(const MemoryCPtr& weights, bool weightsNonTransposed) : m_nonTransposed(weightsNonTransposed) {
+        const auto& dims = weights->getStaticDims();
+        N = weightsNonTransposed ? dims[1] : dims[0];
+        K = weightsNonTransposed ? dims[0] : dims[1];
+        if (weights->getPrecision() == f32) {
+            m_data = weights->getDataAs<const float>();
+        } else {
+            m_converted.resize(N * K);
+            cpu_convert(weights->getData(), m_converted.data(), weights->getPrecision(), f32, N * K);
+            m_data = m_converted.data();
+        }
+    }
+
+    float at(size_t n, size_t k) const {
+        return m_data[m_nonTransposed ? k * N + n : n * K + k];
+    }
+
+    size_t N;
+    size_t K;
+
+private:
+    bool m_nonTransposed;
+    const float* m_data = nullptr;
+    std::vector<float> m_converted;
+};
+
+size_t nmGroups(size_t K) {
+    return div_up(K, gemm_sparse_nm_group);
+}
+
+/*
+ * Blocked format: [offsets: nBlocks + 1][k_idx: nnz] as uint32_t, where the non zero blocks of the block
+ * of output channels nb are [offsets[nb], offsets[nb + 1]), followed by the values [nnz][gemm_sparse_n_block]
+ * starting at 64 bytes boundary.
+ */
+size_t blockedValuesOffset(size_t nBlocks, size_t nnz) {
+    return rnd_up((nBlocks + 1 + nnz) * sizeof(uint32_t), 64);
+}
+
+MemoryPtr packBlocked(const WeightsView& wei, const dnnl::engine& engine) {
+    const size_t nBlocks = div_up(wei.N, gemm_sparse_n_block);
+    auto isZeroBlock = [&](size_t nb, size_t k) {
+        for (size_t n = nb * gemm_sparse_n_block; n < std::min(wei.N, (nb + 1) * gemm_sparse_n_block); n++) {
+            if (wei.at(n, k) != 0.f)
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<uint32_t> offsets(nBlocks + 1, 0);
+    parallel_for(nBlocks, [&](size_t nb) {
+        uint32_t nnz = 0;
+        for (size_t k = 0; k < wei.K; k++)
+            nnz += !isZeroBlock(nb, k);
+        offsets[nb + 1] = nnz;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const size_t nnz = offsets.back();
+
+    const size_t valuesOffset = blockedValuesOffset(nBlocks, nnz);
+    const size_t size = valuesOffset + nnz * gemm_sparse_n_block * sizeof(float);
+    MemoryPtr packed = std::make_shared<Memory>(engine, intel_cpu::CpuBlockedMemoryDesc(u8, intel_cpu::Shape{size}));
+    auto* data = packed->getDataAs<uint8_t>();
+    std::memcpy(data, offsets.data(), offsets.size() * sizeof(uint32_t));
+    auto* kIdx = reinterpret_cast<uint32_t*>(data) + nBlocks + 1;
+    auto* values = reinterpret_cast<float*>(data + valuesOffset);
+    parallel_for(nBlocks, [&](size_t nb) {
+        size_t i = offsets[nb];
+        for (size_t k = 0; k < wei.K; k++) {
+            if (isZeroBlock(nb, k))
+                continue;
+            kIdx[i] = static_cast<uint32_t>(k);
+            for (size_t j = 0; j < gemm_sparse_n_block; j++) {
+                const size_t n = nb * gemm_sparse_n_block + j;
+                values[i * gemm_sparse_n_block + j] = n < wei.N ? wei.at(n, k) : 0.f;
+            }
+            i++;
+        }
+    });
+    return packed;
+}
+
+// N:M format: [nBlocks][groups][gemm_sparse_nm_nnz][gemm_sparse_n_block] values (float), followed by the same indices
+MemoryPtr packNM(const WeightsView& wei, const dnnl::engine& engine) {
+    const size_t nBlocks = div_up(wei.N, gemm_sparse_n_block);
+    const size_t count = nBlocks * nmGroups(wei.K) * gemm_sparse_nm_nnz * gemm_sparse_n_block;
+    MemoryPtr packed =
+        std::make_shared<Memory>(engine, intel_cpu::CpuBlockedMemoryDesc(u8, intel_cpu::Shape{count * (sizeof(float) + 1)}));
+    auto* values = packed->getDataAs<float>();
+    auto* idx = packed->getDataAs<uint8_t>() + count * sizeof(float);
+    std::memset(packed->getData(), 0, packed->getSize());
+    parallel_for2d(nBlocks, nmGroups(wei.K), [&](size_t nb, size_t g) {
+        const size_t offset = (nb * nmGroups(wei.K) + g) * gemm_sparse_nm_nnz * gemm_sparse_n_block;
+        for (size_t j = 0; j < gemm_sparse_n_block && nb * gemm_sparse_n_block + j < wei.N; j++) {
+            const size_t n = nb * gemm_sparse_n_block + j;
+            size_t nnz = 0;
+            for (size_t p = 0; p < gemm_sparse_nm_group && g * gemm_sparse_nm_group + p < wei.K; p++) {
+                const auto value = wei.at(n, g * gemm_sparse_nm_group + p);
+                if (value == 0.f)
+                    continue;
+                values[offset + nnz * gemm_sparse_n_block + j] = value;
+                idx[offset + nnz * gemm_sparse_n_block + j] = static_cast<uint8_t>(p);
+                nnz++;
+            }
+        }
+    });
+    return packed;
+}
+
+MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
+                              const ExecutorContext::CPtr context,
+                              const SparseWeightsFormat format,
+                              const bool weightsNonTransposed) {
+    DEBUG_LOG("SparseFCExecutor: prepack weights");
+    auto create = [&]() {
+        DEBUG_LOG("SparseFCExecutor: cache miss, perform packing");
+        const WeightsView wei(weightsMemory, weightsNonTransposed);
+        return format == SparseWeightsFormat::NM ? packNM(wei, context->getEngine())
+                                                 : packBlocked(wei, context->getEngine());
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const auto& dims = weightsMemory->getStaticDims();
+        std::string format_str = "fc_sparse_" + std::to_string(static_cast<int>(format)) + "_" +
+                                 std::to_string(dims[0]) + "_" + std::to_string(dims[1]) + "_" +
+                                 std::to_string(weightsNonTransposed);
+        const std::string string_hash = format_str + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+            std::to_string(*weightsMemory->getDataAs<uint64_t>());
+        DEBUG_LOG("SparseFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return *weightCache->findOrCreate(string_hash, create);
+    }
+
+    DEBUG_LOG("SparseFCExecutor: Weights cache is not available");
+    return create();
+}
+
+impl_desc_type sparseImplType() {
+    return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? impl_desc_type::gemm_sparse_avx512
+                                                                           : impl_desc_type::gemm_sparse_avx2;
+}
+
+}  // namespace
+
+SparseWeightsFormat SparseFCExecutor::selectWeightsFormat(const MemoryCPtr& weights,
+                                                          bool weightsNonTransposed,
+                                                          float minSparseRate) {
+    const WeightsView wei(weights, weightsNonTransposed);
+    const size_t nBlocks = div_up(wei.N, gemm_sparse_n_block);
+    std::vector<size_t> zeroBlocks(nBlocks, 0);
+    std::vector<uint8_t> isNM(nBlocks, 1);
+    parallel_for(nBlocks, [&](size_t nb) {
+        const size_t nEnd = std::min(wei.N, (nb + 1) * gemm_sparse_n_block);
+        std::vector<size_t> groupNnz(gemm_sparse_n_block, 0);
+        for (size_t k = 0; k < wei.K; k++) {
+            if (k % gemm_sparse_nm_group == 0)
+                std::fill(groupNnz.begin(), groupNnz.end(), 0);
+            bool zeroBlock = true;
+            for (size_t n = nb * gemm_sparse_n_block; n < nEnd; n++) {
+                if (wei.at(n, k) == 0.f)
+                    continue;
+                zeroBlock = false;
+                if (++groupNnz[n % gemm_sparse_n_block] > gemm_sparse_nm_nnz)
+                    isNM[nb] = 0;
+            }
+            zeroBlocks[nb] += zeroBlock;
+        }
+    });
+
+    const auto blockedRate = static_cast<float>(std::accumulate(zeroBlocks.begin(), zeroBlocks.end(), size_t{0})) /
+                             static_cast<float>(nBlocks * wei.K);
+    const bool nm = std::all_of(isNM.begin(), isNM.end(), [](uint8_t v) {
+        return v != 0;
+    });
+    const auto nmRate = nm ? 1.f - static_cast<float>(gemm_sparse_nm_nnz) / gemm_sparse_nm_group : 0.f;
+
+    DEBUG_LOG("Zero blocks rate = ", blockedRate * 100, "%, N:M sparse weights = ", nm,
+              ", min sparse rate = ", minSparseRate * 100, "%");
+
+    // the blocks are cheaper to skip than the N:M weights, so they win the ties
+    if (blockedRate >= nmRate)
+        return blockedRate >= minSparseRate && blockedRate > 0.f ? SparseWeightsFormat::Blocked : SparseWeightsFormat::None;
+    return nmRate >= minSparseRate ? SparseWeightsFormat::NM : SparseWeightsFormat::None;
+}
+
+bool SparseFCExecutor::supports(const FCConfig& config) {
+    VERIFY(dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2), UNSUPPORTED_ISA);
+    // another implementation is enforced by "primitivesPriority" runtime info
+    VERIFY(one_of(config.attrs.preferredImplType, impl_desc_type::unknown, impl_desc_type::undef, sparseImplType()),
+           UNSUPPORTED_IMPL_PRIORITY);
+    VERIFY(config.attrs.sparseWeightsFormat != SparseWeightsFormat::None, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(config.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(config.attrs.dequantizationScales.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(!config.attrs.decompressionMultiplyPtr && !config.attrs.decompressionSubtractPtr,
+           UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    VERIFY(everyone_is(f32, srcType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(one_of(weiType(config), f32, f16, bf16), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(!config.attrs.withBias || biaType(config) == f32, UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(weiRank(config) == 2, UNSUPPORTED_WEI_RANK);
+    VERIFY(config.descs.at(ARG_WEI)->getShape().isStatic(), UNSUPPORTED_WEI_RANK);
+
+    return true;
+}
+
+SparseFCExecutor::SparseFCExecutor(const FCAttrs& attrs,
+                                   const PostOps& postOps,
+                                   const MemoryArgs& memory,
+                                   const ExecutorContext::CPtr context)
+    : m_attrs(attrs),
+      m_memoryArgs(memory),
+      m_context(context) {
+    const auto& weiMemory = memory.at(ARG_WEI);
+    const auto& weiDims = weiMemory->getStaticDims();
+    N = attrs.weightsNonTransposed ? weiDims[1] : weiDims[0];
+    K = attrs.weightsNonTransposed ? weiDims[0] : weiDims[1];
+    m_packedWeights = prepareWeightMemory(weiMemory, context, attrs.sparseWeightsFormat, attrs.weightsNonTransposed);
+}
+
+impl_desc_type SparseFCExecutor::implType() const {
+    return sparseImplType();
+}
+
+bool SparseFCExecutor::update(const MemoryArgs& memory) {
+    const auto& dstDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    if (m_attrs.sparseWeightsFormat == SparseWeightsFormat::NM && M > gemm_sparse_nm_max_m) {
+        DEBUG_LOG("SparseFCExecutor: N:M sparse weights are not profitable for M = ", M);
+        return false;
+    }
+    return true;
+}
+
+void SparseFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = m_attrs.withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr;
+    const auto* packed = m_packedWeights->getDataAs<const uint8_t>();
+    const size_t nBlocks = div_up(N, gemm_sparse_n_block);
+
+    auto forEachBlock = [&](const std::function<void(size_t, size_t, size_t, const float*, float*, size_t)>& kernel) {
+        parallel_for2d(div_up(M, mBlock), nBlocks, [&](size_t mb, size_t nb) {
+            const size_t m0 = mb * mBlock;
+            const size_t n0 = nb * gemm_sparse_n_block;
+            const size_t nValid = std::min(gemm_sparse_n_block, N - n0);
+            float biasTail[gemm_sparse_n_block] = {};
+            const float* biasBlock = bias ? bias + n0 : nullptr;
+            if (bias && nValid < gemm_sparse_n_block) {
+                std::memcpy(biasTail, biasBlock, nValid * sizeof(float));
+                biasBlock = biasTail;
+            }
+            kernel(m0, std::min(mBlock, M - m0), nb, biasBlock, dst + m0 * N + n0, nValid);
+        });
+    };
+
+    if (m_attrs.sparseWeightsFormat == SparseWeightsFormat::NM) {
+        const size_t blockSize = nmGroups(K) * gemm_sparse_nm_nnz * gemm_sparse_n_block;
+        const auto* values = reinterpret_cast<const float*>(packed);
+        const auto* idx = packed + nBlocks * blockSize * sizeof(float);
+        forEachBlock([&](size_t m0, size_t rows, size_t nb, const float* biasBlock, float* out, size_t nValid) {
+            gemm_sparse_nm(src + m0 * K,
+                           K,
+                           rows,
+                           K,
+                           values + nb * blockSize,
+                           idx + nb * blockSize,
+                           biasBlock,
+                           out,
+                           N,
+                           nValid);
+        });
+        return;
+    }
+
+    const auto* offsets = reinterpret_cast<const uint32_t*>(packed);
+    const auto* kIdx = offsets + nBlocks + 1;
+    const auto* values = reinterpret_cast<const float*>(packed + blockedValuesOffset(nBlocks, offsets[nBlocks]));
+    forEachBlock([&](size_t m0, size_t rows, size_t nb, const float* biasBlock, float* out, size_t nValid) {
+        gemm_sparse_blocked(src + m0 * K,
+                            K,
+                            rows,
+                            values + offsets[nb] * gemm_sparse_n_block,
+                            kIdx + offsets[nb],
+                            offsets[nb + 1] - offsets[nb],
+                            biasBlock,
+                            out,
+                            N,
+                            nValid);
+    });
+}
+
+void SparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID)
+        return;
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (m_attrs.withBias) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "cpu_memory.h"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * FullyConnected with f32 activations and pruned constant weights for AVX2 / AVX-512 hosts
+ * (oneDNN sparse weights decompression is available on AMX only).
+ * The weights are compressed at compile time into the block sparse or N:M format
+ * and the zero weights are skipped by the kernels.
+ */
+class SparseFCExecutor : public Executor {
+public:
+    SparseFCExecutor(const FCAttrs& attrs,
+                     const PostOps& postOps,
+                     const MemoryArgs& memory,
+                     const ExecutorContext::CPtr context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    /**
+     * Chooses the format which skips the most of the weights.
+     * Returns SparseWeightsFormat::None if the rate of the weights it skips is less than minSparseRate.
+     */
+    static SparseWeightsFormat selectWeightsFormat(const MemoryCPtr& weights,
+                                                   bool weightsNonTransposed,
+                                                   float minSparseRate);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    const FCAttrs& m_attrs;
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    size_t M = 0, N = 0, K = 0;
+    MemoryCPtr m_packedWeights;
+    int curNumaNode = -1;
+};
+
+using SparseFCExecutorPtr = std::shared_ptr<SparseFCExecutor>;
+
+}  // namespace intel_cpu
+}  // namespace ov
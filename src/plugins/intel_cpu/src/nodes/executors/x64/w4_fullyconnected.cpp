@@ -0,0 +1,245 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "w4_fullyconnected.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/x64/decompression_params.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/fullyconnected/gemm_w4.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/nf4.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace executor;
+using namespace ov::element;
+using ov::Extensions::Cpu::XARCH::gemm_w4;
+using ov::Extensions::Cpu::XARCH::gemm_w4_max_m;
+using ov::Extensions::Cpu::XARCH::gemm_w4_n_block;
+
+namespace {
+
+// see gemm_w4 for the packed layout
+void packWeights(const uint8_t* src, uint8_t* dst, const WeightsLayout& wei, bool weightsNonTransposed) {
+    const size_t N = wei.N;
+    const size_t K = wei.K;
+    constexpr size_t half = gemm_w4_n_block / 2;
+    auto code = [&](size_t n, size_t k) -> uint8_t {
+        if (n >= N)
+            return 0;
+        const size_t idx = weightsNonTransposed ? k * N + n : n * K + k;
+        return (src[idx / 2] >> (4 * (idx % 2))) & 0x0F;
+    };
+
+    parallel_for(div_up(N, gemm_w4_n_block), [&](size_t nb) {
+        uint8_t* block = dst + nb * K * half;
+        const size_t n0 = nb * gemm_w4_n_block;
+        for (size_t k = 0; k < K; k++) {
+            for (size_t j = 0; j < half; j++) {
+                block[k * half + j] = code(n0 + j, k) | (code(n0 + j + half, k) << 4);
+            }
+        }
+    });
+}
+
+MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
+                              const ExecutorContext::CPtr context,
+                              const WeightsLayout& wei,
+                              const bool weightsNonTransposed) {
+    DEBUG_LOG("W4FCExecutor: prepack weights");
+    const size_t packedSize = div_up(wei.N, gemm_w4_n_block) * gemm_w4_n_block * wei.K / 2;
+
+    auto create = [&]() {
+        MemoryPtr _ptr = std::make_shared<Memory>(context->getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(u8, intel_cpu::Shape{packedSize}));
+        DEBUG_LOG("W4FCExecutor: cache miss, perform packing");
+        packWeights(weightsMemory->getDataAs<const uint8_t>(),
+                    _ptr->getDataAs<uint8_t>(),
+                    wei,
+                    weightsNonTransposed);
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "fc_w4_" + std::to_string(wei.N) + "_" + std::to_string(wei.K) + "_" +
+                             std::to_string(weightsNonTransposed);
+        const std::string string_hash = format + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+            std::to_string(*weightsMemory->getDataAs<uint64_t>());
+        DEBUG_LOG("W4FCExecutor: findOrCreate, string_hash: ", string_hash);
+        return *weightCache->findOrCreate(string_hash, create);
+    }
+
+    DEBUG_LOG("W4FCExecutor: Weights cache is not available");
+    return create();
+}
+
+impl_desc_type w4ImplType() {
+    return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? impl_desc_type::gemm_avx512
+                                                                           : impl_desc_type::gemm_avx2;
+}
+
+}  // namespace
+
+bool W4FCExecutor::supports(const FCConfig& config) {
+    VERIFY(dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2), UNSUPPORTED_ISA);
+    // another implementation is enforced by "primitivesPriority" runtime info
+    VERIFY(one_of(config.attrs.preferredImplType, impl_desc_type::unknown, impl_desc_type::undef, w4ImplType()),
+           UNSUPPORTED_IMPL_PRIORITY);
+    VERIFY(config.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(config.attrs.dequantizationScales.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    // activations quantization is handled by oneDNN
+    VERIFY(config.attrs.dynamicQuantizationGroupSize == 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    VERIFY(everyone_is(f32, srcType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(one_of(weiType(config), u4, i4, nf4), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(!config.attrs.withBias || biaType(config) == f32, UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(weiRank(config) == 2, UNSUPPORTED_WEI_RANK);
+    VERIFY(config.descs.at(ARG_WEI)->getShape().isStatic(), UNSUPPORTED_WEI_RANK);
+
+    const auto& attrs = config.attrs;
+    VERIFY(attrs.decompressionMultiplyPtr, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    const auto wei = weightsLayout(config.descs.at(ARG_WEI)->getShape().getStaticDims(), attrs.weightsNonTransposed);
+    const auto groups = decompressionGroups(attrs.decompressionMultiplyPtr, wei, attrs.weightsNonTransposed);
+    VERIFY(groups != 0, UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    if (attrs.decompressionSubtractPtr) {
+        const auto zpGroups = decompressionGroups(attrs.decompressionSubtractPtr, wei, attrs.weightsNonTransposed);
+        VERIFY(one_of(zpGroups, 1u, groups), UNSUPPORTED_WEIGHTS_DECOMPRESSION);
+    }
+
+    return true;
+}
+
+bool W4FCExecutor::acceptsShapes(const MemoryArgs& memory) {
+    const auto& srcDims = memory.at(ARG_SRC)->getShape().getStaticDims();
+    const auto M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    // the weights are reused by a few rows only, bigger M is compute bound and goes to oneDNN
+    VERIFY(M <= gemm_w4_max_m, HEURISTICS_MISMATCH);
+    return true;
+}
+
+W4FCExecutor::W4FCExecutor(const FCAttrs& attrs,
+                           const PostOps& postOps,
+                           const MemoryArgs& memory,
+                           const ExecutorContext::CPtr context)
+    : m_attrs(attrs),
+      m_memoryArgs(memory),
+      m_context(context) {
+    const auto& weiMemory = memory.at(ARG_WEI);
+    const auto wei = weightsLayout(weiMemory->getStaticDims(), attrs.weightsNonTransposed);
+    N = wei.N;
+    K = wei.K;
+    const auto groups = decompressionGroups(attrs.decompressionMultiplyPtr, wei, attrs.weightsNonTransposed);
+    m_groupSize = K / groups;
+
+    m_scales = packDecompressionParams(attrs.decompressionMultiplyPtr,
+                                       wei,
+                                       groups,
+                                       attrs.weightsNonTransposed,
+                                       gemm_w4_n_block);
+    if (attrs.decompressionSubtractPtr)
+        m_zeroPoints = packDecompressionParams(attrs.decompressionSubtractPtr,
+                                               wei,
+                                               groups,
+                                               attrs.weightsNonTransposed,
+                                               gemm_w4_n_block);
+
+    const auto weiPrecision = weiMemory->getDesc().getPrecision();
+    m_lut.resize(16);
+    for (uint8_t code = 0; code < 16; code++) {
+        if (weiPrecision == nf4)
+            m_lut[code] = ov::ConvertNF4::dequantize(code);
+        else if (weiPrecision == i4)
+            m_lut[code] = static_cast<float>(static_cast<int8_t>(code << 4) >> 4);
+        else
+            m_lut[code] = code;
+    }
+
+    m_packedWeights = prepareWeightMemory(weiMemory, context, wei, attrs.weightsNonTransposed);
+}
+
+impl_desc_type W4FCExecutor::implType() const {
+    return w4ImplType();
+}
+
+bool W4FCExecutor::update(const MemoryArgs& memory) {
+    const auto& dstDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = std::accumulate(dstDims.begin(), dstDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    return true;
+}
+
+void W4FCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = m_attrs.withBias ? memory.at(ARG_BIAS)->getDataAs<const float>() : nullptr;
+    const auto* wei = m_packedWeights->getDataAs<const uint8_t>();
+    const size_t groups = K / m_groupSize;
+
+    const float* srcGroupSums = nullptr;
+    if (!m_zeroPoints.empty()) {
+        m_srcGroupSums.resize(M * groups);
+        parallel_for2d(M, groups, [&](size_t m, size_t g) {
+            const float* x = src + m * K + g * m_groupSize;
+            float sum = 0.f;
+            for (size_t k = 0; k < m_groupSize; k++)
+                sum += x[k];
+            m_srcGroupSums[m * groups + g] = sum;
+        });
+        srcGroupSums = m_srcGroupSums.data();
+    }
+
+    parallel_for(div_up(N, gemm_w4_n_block), [&](size_t nb) {
+        const size_t n0 = nb * gemm_w4_n_block;
+        const size_t nValid = std::min(gemm_w4_n_block, N - n0);
+        const size_t paramsOffset = nb * groups * gemm_w4_n_block;
+        float biasTail[gemm_w4_n_block] = {};
+        const float* biasBlock = bias ? bias + n0 : nullptr;
+        if (bias && nValid < gemm_w4_n_block) {
+            std::memcpy(biasTail, biasBlock, nValid * sizeof(float));
+            biasBlock = biasTail;
+        }
+        gemm_w4(src,
+                K,
+                M,
+                K,
+                wei + n0 * K / 2,
+                m_lut.data(),
+                m_scales.data() + paramsOffset,
+                m_zeroPoints.empty() ? nullptr : m_zeroPoints.data() + paramsOffset,
+                m_groupSize,
+                srcGroupSums,
+                biasBlock,
+                dst + n0,
+                N,
+                nValid);
+    });
+}
+
+void W4FCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID)
+        return;
+    curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+    if (m_attrs.withBias) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * FullyConnected with u4 / i4 / nf4 weights and per output channel or per group decompression scales
+ * (and optional zero points) for f32 activations with a few rows only (GEMV and small M).
+ * The weights are repacked once into blocks of output channels and unpacked in registers,
+ * so the kernel reads the compressed weights only, which is what decides the throughput of LLM decoding.
+ */
+class W4FCExecutor : public Executor {
+public:
+    W4FCExecutor(const FCAttrs& attrs,
+                 const PostOps& postOps,
+                 const MemoryArgs& memory,
+                 const ExecutorContext::CPtr context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    static bool acceptsShapes(const MemoryArgs& memory);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+private:
+    const FCAttrs& m_attrs;
+    const MemoryArgs& m_memoryArgs;
+    const ExecutorContext::CPtr m_context;
+    size_t M = 0, N = 0, K = 0;
+    size_t m_groupSize = 0;
+    MemoryCPtr m_packedWeights;
+    // [N / block][groups][block]
+    std::vector<float> m_scales;
+    std::vector<float> m_zeroPoints;
+    std::vector<float> m_lut;
+    std::vector<float> m_srcGroupSums;
+    int curNumaNode = -1;
+};
+
+using W4FCExecutorPtr = std::shared_ptr<W4FCExecutor>;
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -25,6 +25,10 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "nodes/executors/x64/sparse_fullyconnected.hpp"
+#endif
+
 using namespace dnnl;
 using namespace ov::element;
 
@@ -107,6 +111,8 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::gemm_sparse_avx512,
+        impl_desc_type::gemm_sparse_avx2,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgemm_avx512,
         impl_desc_type::brgemm_avx2,
@@ -197,13 +203,47 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
     return sparseRate >= minSparseRate;
 }
 
+// structured sparsity of float weights, which is used by AVX2 / AVX-512 kernels
+static SparseWeightsFormat sparseWeightsFormat(const NodePtr& weightsInput,
+                                               const ov::element::Type inputType,
+                                               const bool weightsNonTransposed,
+                                               const float sparseWeiDecompressionRate) {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (sparseWeiDecompressionRate == 1.f || inputType != f32)
+        return SparseWeightsFormat::None;
+
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2))
+        return SparseWeightsFormat::None;
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
+    if (!constNode)
+        return SparseWeightsFormat::None;
+
+    const auto weiMemory = constNode->getMemoryPtr();
+    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
+
+    if (weiMemory->getShape().getRank() != 2 || !one_of(weiMemory->getPrecision(), f32, f16, bf16))
+        return SparseWeightsFormat::None;
+
+    return SparseFCExecutor::selectWeightsFormat(weiMemory, weightsNonTransposed, sparseWeiDecompressionRate);
+#else
+    return SparseWeightsFormat::None;
+#endif
+}
+
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     attrs.withBias = getOriginalInputsNumber() == 3;
     attrs.dequantizationScales = getDQScales();
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS_ID)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA_ID),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
+    if (!attrs.sparseWeights)
+        attrs.sparseWeightsFormat = sparseWeightsFormat(getParentEdgeAt(WEIGHTS_ID)->getParent(),
+                                                        getOriginalInputPrecisionAtPort(DATA_ID),
+                                                        attrs.weightsNonTransposed,
+                                                        context->getConfig().fcSparseWeiDecompressionRate);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
+    attrs.preferredImplType = getImplPriority().front();
     postOps = getPostOps(fusedWith);
 
     const auto& srcTypes = getOriginalInputPrecisions();
@@ -0,0 +1,273 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+constexpr size_t channels = 3;
+
+// the same conversion as the ColorConvert node performs, rounded half to even like its JIT kernel
+template <bool round>
+inline float clipColor(float value) {
+    if (round)
+        value = (value + 12582912.f) - 12582912.f;  // 1.5 * 2^23 drops the fraction of |value| < 2^22
+    return std::min(std::max(value, 0.f), 255.f);
+}
+
+// rgb planes of two NV12 taps blended by the weights, written as a plain loop to let it be vectorized
+template <bool round>
+void yuvToRgbRow(const float* yuv, const float* weight, size_t size, float* dst_r, float* dst_g, float* dst_b) {
+    const float* y0 = yuv;
+    const float* u0 = y0 + size;
+    const float* v0 = u0 + size;
+    const float* y1 = v0 + size;
+    const float* u1 = y1 + size;
+    const float* v1 = u1 + size;
+    for (size_t i = 0; i < size; i++) {
+        const float w1 = weight[i];
+        const float w0 = 1.f - w1;
+        const float c0 = y0[i] - 16.f, d0 = u0[i] - 128.f, e0 = v0[i] - 128.f;
+        const float c1 = y1[i] - 16.f, d1 = u1[i] - 128.f, e1 = v1[i] - 128.f;
+        dst_r[i] = clipColor<round>(1.164f * c0 + 1.596f * e0) * w0 + clipColor<round>(1.164f * c1 + 1.596f * e1) * w1;
+        dst_g[i] = clipColor<round>(1.164f * c0 - 0.391f * d0 - 0.813f * e0) * w0 +
+                   clipColor<round>(1.164f * c1 - 0.391f * d1 - 0.813f * e1) * w1;
+        dst_b[i] = clipColor<round>(1.164f * c0 + 2.018f * d0) * w0 + clipColor<round>(1.164f * c1 + 2.018f * d1) * w1;
+    }
+}
+}  // namespace
+
+bool ImagePreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto node = ov::as_type_ptr<const ImagePreprocessNode>(op);
+        if (!node) {
+            errorMessage = "Only ImagePreprocess from CPU internal opset is supported";
+            return false;
+        }
+        for (size_t i = 0; i < node->get_input_size(); i++) {
+            const auto type = node->get_input_element_type(i);
+            if (type != ov::element::u8 && type != ov::element::f32) {
+                errorMessage = "Only U8 and FP32 images are supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+ImagePreprocess::ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    m_config = ov::as_type_ptr<const ImagePreprocessNode>(op)->get_config();
+}
+
+void ImagePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // floating point images may be enforced to the inference precision, the kernel reads them as f32
+    const auto precision =
+        getOriginalInputPrecisionAtPort(0) == ov::element::u8 ? ov::element::u8 : ov::element::f32;
+    std::vector<PortConfigurator> inPortConfigs;
+    for (size_t i = 0; i < getOriginalInputsNumber(); i++)
+        inPortConfigs.emplace_back(LayoutType::ncsp, precision);
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, ov::element::f32}}, ref_any);
+}
+
+bool ImagePreprocess::created() const {
+    return getType() == Type::ImagePreprocess;
+}
+
+bool ImagePreprocess::needPrepareParams() const {
+    return inputShapesModified();
+}
+
+void ImagePreprocess::prepareParams() {
+    const auto& image_dims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    m_batch = image_dims[0];
+    m_in_height = image_dims[1];
+    m_in_width = image_dims[2];
+    if (m_config.nv12 && getOriginalInputsNumber() == 1) {
+        // single plane NV12 image keeps the UV plane under the Y plane
+        m_in_height = m_in_height * 2 / 3;
+    }
+    if (m_in_height == 0 || m_in_width == 0) {
+        THROW_CPU_NODE_ERR("has incompatible image shape ", PartialShape(image_dims));
+    }
+
+    // half_pixel bilinear taps, the coordinates outside of the source are clamped to its edges
+    const auto fill = [](size_t in_size, size_t out_size, Taps& taps) {
+        const float scale = static_cast<float>(out_size) / static_cast<float>(in_size);
+        const float max_coord = static_cast<float>(in_size - 1);
+        taps.idx0.resize(out_size);
+        taps.idx1.resize(out_size);
+        taps.weight.resize(out_size);
+        for (size_t o = 0; o < out_size; o++) {
+            const float coord = std::min(std::max((static_cast<float>(o) + 0.5f) / scale - 0.5f, 0.f), max_coord);
+            taps.idx0[o] = static_cast<size_t>(coord);
+            taps.idx1[o] = std::min(taps.idx0[o] + 1, in_size - 1);
+            taps.weight[o] = coord - static_cast<float>(taps.idx0[o]);
+        }
+    };
+    fill(m_in_width, m_config.out_width, m_x_taps);
+    fill(m_in_height, m_config.out_height, m_y_taps);
+
+    m_scratch.resize(static_cast<size_t>(parallel_get_max_threads()) * (2 * channels + 6) * m_config.out_width);
+}
+
+template <typename T>
+void ImagePreprocess::interpolateRow(const T* src, size_t y, float* dst) const {
+    const size_t out_width = m_config.out_width;
+    const T* row = src + y * m_in_width * channels;
+    for (size_t ox = 0; ox < out_width; ox++) {
+        const T* p0 = row + m_x_taps.idx0[ox] * channels;
+        const T* p1 = row + m_x_taps.idx1[ox] * channels;
+        const float w1 = m_x_taps.weight[ox];
+        const float w0 = 1.f - w1;
+        for (size_t c = 0; c < channels; c++)
+            dst[c * out_width + ox] = static_cast<float>(p0[c]) * w0 + static_cast<float>(p1[c]) * w1;
+    }
+}
+
+template <typename T>
+void ImagePreprocess::interpolateRowNV12(const T* src_y, const T* src_uv, size_t y, float* dst, float* yuv) const {
+    const size_t out_width = m_config.out_width;
+    const T* row_y = src_y + y * m_in_width;
+    const T* row_uv = src_uv + (y / 2) * m_in_width;
+    // gather the taps first, the conversion loop is then free of indirect accesses
+    float* y0 = yuv;
+    float* u0 = y0 + out_width;
+    float* v0 = u0 + out_width;
+    float* y1 = v0 + out_width;
+    float* u1 = y1 + out_width;
+    float* v1 = u1 + out_width;
+    for (size_t ox = 0; ox < out_width; ox++) {
+        const size_t x0 = m_x_taps.idx0[ox];
+        const size_t x1 = m_x_taps.idx1[ox];
+        y0[ox] = static_cast<float>(row_y[x0]);
+        u0[ox] = static_cast<float>(row_uv[x0 / 2 * 2]);
+        v0[ox] = static_cast<float>(row_uv[x0 / 2 * 2 + 1]);
+        y1[ox] = static_cast<float>(row_y[x1]);
+        u1[ox] = static_cast<float>(row_uv[x1 / 2 * 2]);
+        v1[ox] = static_cast<float>(row_uv[x1 / 2 * 2 + 1]);
+    }
+
+    float* dst_r = dst + (m_config.nv12_bgr ? 2 : 0) * out_width;
+    float* dst_g = dst + out_width;
+    float* dst_b = dst + (m_config.nv12_bgr ? 0 : 2) * out_width;
+    if (m_config.nv12_round) {
+        yuvToRgbRow<true>(yuv, m_x_taps.weight.data(), out_width, dst_r, dst_g, dst_b);
+    } else {
+        yuvToRgbRow<false>(yuv, m_x_taps.weight.data(), out_width, dst_r, dst_g, dst_b);
+    }
+}
+
+template <typename T>
+void ImagePreprocess::executeImpl() {
+    const T* src = getSrcDataAtPortAs<const T>(0);
+    float* dst = getDstDataAtPortAs<float>(0);
+    const size_t out_height = m_config.out_height;
+    const size_t out_width = m_config.out_width;
+    const size_t row_size = channels * out_width;
+    const size_t plane_size = m_in_height * m_in_width;
+    const bool single_plane = getOriginalInputsNumber() == 1;
+    const T* src_uv = m_config.nv12 && !single_plane ? getSrcDataAtPortAs<const T>(1) : nullptr;
+
+    auto interpolate = [&](size_t n, size_t y, float* row, float* yuv) {
+        if (!m_config.nv12)
+            return interpolateRow(src + n * plane_size * channels, y, row);
+        if (single_plane) {
+            const T* image = src + n * plane_size * 3 / 2;
+            return interpolateRowNV12(image, image + plane_size, y, row, yuv);
+        }
+        return interpolateRowNV12(src + n * plane_size, src_uv + n * plane_size / 2, y, row, yuv);
+    };
+
+    const size_t rows_count = m_batch * out_height;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(rows_count, nthr, ithr, start, end);
+        float* row0 = m_scratch.data() + ithr * (2 * channels + 6) * out_width;
+        float* row1 = row0 + row_size;
+        float* yuv = row1 + row_size;
+        // the source rows held by row0 and row1, upscaled neighbour output rows share them
+        size_t held0 = std::numeric_limits<size_t>::max();
+        size_t held1 = std::numeric_limits<size_t>::max();
+
+        for (size_t r = start; r < end; r++) {
+            const size_t n = r / out_height;
+            const size_t oy = r % out_height;
+            const size_t y0 = m_y_taps.idx0[oy];
+            const size_t y1 = m_y_taps.idx1[oy];
+            const float w1 = m_y_taps.weight[oy];
+            const float w0 = 1.f - w1;
+            const size_t key0 = n * m_in_height + y0;
+            const size_t key1 = n * m_in_height + y1;
+            if (key0 == held1) {
+                std::swap(row0, row1);
+                std::swap(held0, held1);
+            }
+            if (key0 != held0) {
+                interpolate(n, y0, row0, yuv);
+                held0 = key0;
+            }
+            if (key1 != held1 && key1 != key0) {
+                interpolate(n, y1, row1, yuv);
+                held1 = key1;
+            }
+            const float* bottom = key1 == key0 ? row0 : row1;
+
+            for (size_t c = 0; c < channels; c++) {
+                const size_t plane = static_cast<size_t>(m_config.channel_order[c]) * out_width;
+                const float* t = row0 + plane;
+                const float* b = bottom + plane;
+                const float scale = m_config.scale[c];
+                const float shift = m_config.shift[c];
+                if (m_config.planar_output) {
+                    float* out = dst + ((n * channels + c) * out_height + oy) * out_width;
+                    for (size_t ox = 0; ox < out_width; ox++)
+                        out[ox] = (t[ox] * w0 + b[ox] * w1) * scale + shift;
+                } else {
+                    float* out = dst + (n * out_height + oy) * row_size + c;
+                    for (size_t ox = 0; ox < out_width; ox++)
+                        out[ox * channels] = (t[ox] * w0 + b[ox] * w1) * scale + shift;
+                }
+            }
+        }
+    });
+}
+
+void ImagePreprocess::execute(dnnl::stream strm) {
+    const auto precision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    switch (precision) {
+    case ov::element::u8:
+        return executeImpl<uint8_t>();
+    case ov::element::f32:
+        return executeImpl<float>();
+    default:
+        THROW_CPU_NODE_ERR("does not support input element type: ", precision);
+    }
+}
+
+void ImagePreprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class ImagePreprocess : public Node {
+public:
+    ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    bool created() const override;
+    bool needPrepareParams() const override;
+    void prepareParams() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // source taps and weights of the output coordinates along one axis
+    struct Taps {
+        std::vector<size_t> idx0;
+        std::vector<size_t> idx1;
+        std::vector<float> weight;
+    };
+
+    template <typename T>
+    void executeImpl();
+
+    // horizontally interpolated source row, one plane of out_width values per source channel
+    template <typename T>
+    void interpolateRow(const T* src, size_t y, float* dst) const;
+    // the same for NV12 source converted to RGB/BGR, yuv is a scratch for 6 * out_width values
+    template <typename T>
+    void interpolateRowNV12(const T* src_y, const T* src_uv, size_t y, float* dst, float* yuv) const;
+
+    ImagePreprocessNode::Config m_config;
+
+    size_t m_batch = 0;
+    size_t m_in_height = 0;
+    size_t m_in_width = 0;
+    Taps m_x_taps;
+    Taps m_y_taps;
+
+    // per thread scratch, two interpolated rows and NV12 values of their taps
+    std::vector<float> m_scratch;
+};
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
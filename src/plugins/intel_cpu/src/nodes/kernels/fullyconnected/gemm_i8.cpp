@@ -0,0 +1,436 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <immintrin.h>
+
+#include "gemm_i8.hpp"
+#include "unroll.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Every int32 lane of the packed weights holds 4 input channels of one output channel, so a broadcast of
+// 4 quantized activations multiplied by a weights vector gives the partial dot products of 16 output channels.
+// Without VNNI the signed x signed products go through maddubs (unsigned x signed):
+// the sign of the weights is moved to the activations, |w| <= 128 and |x| <= 127 never saturate the int16 pairs.
+#if defined(HAVE_AVX512F)
+using vec_t = __m512;
+using ivec_t = __m512i;
+static constexpr size_t vec_num = 1;
+static constexpr size_t m_block = 8;
+
+struct Wei {
+    __m512i abs;
+    __mmask64 neg;
+};
+
+static inline vec_t vec_zero() {
+    return _mm512_setzero_ps();
+}
+static inline vec_t vec_set1(float a) {
+    return _mm512_set1_ps(a);
+}
+static inline vec_t vec_loadu(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    _mm512_storeu_ps(p, a);
+}
+static inline vec_t vec_mul(vec_t a, vec_t b) {
+    return _mm512_mul_ps(a, b);
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+static inline vec_t vec_fnmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm512_fnmadd_ps(a, b, c);
+}
+static inline ivec_t ivec_zero() {
+    return _mm512_setzero_si512();
+}
+static inline vec_t ivec_to_float(ivec_t a) {
+    return _mm512_cvtepi32_ps(a);
+}
+static inline ivec_t x_set1(const uint8_t* x) {
+    int32_t x4;
+    std::memcpy(&x4, x, sizeof(x4));
+    return _mm512_set1_epi32(x4);
+}
+static inline ivec_t x_set1_s8(const uint8_t* x) {
+    return _mm512_xor_si512(x_set1(x), _mm512_set1_epi8(static_cast<char>(0x80)));
+}
+static inline void load_wei(const int8_t* p, Wei* w) {
+    const auto raw = _mm512_loadu_si512(p);
+    w[0].abs = _mm512_abs_epi8(raw);
+    w[0].neg = _mm512_movepi8_mask(raw);
+}
+static inline ivec_t dot(ivec_t acc, ivec_t x, const Wei& w) {
+    const auto xs = _mm512_mask_sub_epi8(x, w.neg, _mm512_setzero_si512(), x);
+    const auto pairs = _mm512_maddubs_epi16(w.abs, xs);
+    return _mm512_add_epi32(acc, _mm512_madd_epi16(pairs, _mm512_set1_epi16(1)));
+}
+#elif defined(HAVE_AVX2)
+using vec_t = __m256;
+using ivec_t = __m256i;
+static constexpr size_t vec_num = 2;
+static constexpr size_t m_block = 2;
+
+struct Wei {
+    __m256i abs;
+    __m256i raw;
+};
+
+static inline vec_t vec_zero() {
+    return _mm256_setzero_ps();
+}
+static inline vec_t vec_set1(float a) {
+    return _mm256_set1_ps(a);
+}
+static inline vec_t vec_loadu(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    _mm256_storeu_ps(p, a);
+}
+static inline vec_t vec_mul(vec_t a, vec_t b) {
+    return _mm256_mul_ps(a, b);
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+static inline vec_t vec_fnmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm256_fnmadd_ps(a, b, c);
+}
+static inline ivec_t ivec_zero() {
+    return _mm256_setzero_si256();
+}
+static inline vec_t ivec_to_float(ivec_t a) {
+    return _mm256_cvtepi32_ps(a);
+}
+static inline ivec_t x_set1_s8(const uint8_t* x) {
+    int32_t x4;
+    std::memcpy(&x4, x, sizeof(x4));
+    return _mm256_xor_si256(_mm256_set1_epi32(x4), _mm256_set1_epi8(static_cast<char>(0x80)));
+}
+static inline void load_wei(const int8_t* p, Wei* w) {
+    for (size_t v = 0; v < vec_num; v++) {
+        w[v].raw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + v * 32));
+        w[v].abs = _mm256_abs_epi8(w[v].raw);
+    }
+}
+static inline ivec_t dot(ivec_t acc, ivec_t x, const Wei& w) {
+    const auto pairs = _mm256_maddubs_epi16(w.abs, _mm256_sign_epi8(x, w.raw));
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(pairs, _mm256_set1_epi16(1)));
+}
+#endif
+
+static constexpr size_t vec_len = gemm_i8_n_block / vec_num;
+// bytes of packed weights per gemm_i8_k_pack input channels
+static constexpr size_t wei_k_stride = gemm_i8_n_block * gemm_i8_k_pack;
+
+struct GemmI8Args {
+    size_t K;
+    size_t group_size;
+    size_t groups;
+    const int8_t* wei;
+    const float* wei_scales;
+    const float* wei_zps;
+    const int32_t* wei_comp;
+    const float* bias;
+    size_t dst_stride;
+    size_t n_valid;
+};
+
+template <size_t M_BLK>
+static inline void init_acc(const GemmI8Args& args, vec_t (&acc)[M_BLK][vec_num]) {
+    unroll<vec_num>([&](size_t v) {
+        const auto bias = args.bias ? vec_loadu(args.bias + v * vec_len) : vec_zero();
+        unroll<M_BLK>([&](size_t m) {
+            acc[m][v] = bias;
+        });
+    });
+}
+
+// acc += src_scale * wei_scale * (sum - zp * src_sum)
+template <size_t M_BLK>
+static inline void dequantize_group(const GemmI8Args& args,
+                                    size_t g,
+                                    const float* src_scales,
+                                    const int32_t* src_sums,
+                                    const vec_t (&sums)[M_BLK][vec_num],
+                                    vec_t (&acc)[M_BLK][vec_num]) {
+    unroll<vec_num>([&](size_t v) {
+        const auto offset = g * gemm_i8_n_block + v * vec_len;
+        const auto scale = vec_loadu(args.wei_scales + offset);
+        const auto zp = args.wei_zps ? vec_loadu(args.wei_zps + offset) : vec_zero();
+        unroll<M_BLK>([&](size_t m) {
+            auto sum = sums[m][v];
+            if (args.wei_zps)
+                sum = vec_fnmadd(vec_set1(static_cast<float>(src_sums[m * args.groups + g])), zp, sum);
+            acc[m][v] = vec_fmadd(sum, vec_mul(scale, vec_set1(src_scales[m * args.groups + g])), acc[m][v]);
+        });
+    });
+}
+
+template <size_t M_BLK>
+static inline void store_acc(const GemmI8Args& args, const vec_t (&acc)[M_BLK][vec_num], float* dst) {
+    for (size_t m = 0; m < M_BLK; m++) {
+        float* out = dst + m * args.dst_stride;
+        if (args.n_valid == gemm_i8_n_block) {
+            for (size_t v = 0; v < vec_num; v++)
+                vec_storeu(out + v * vec_len, acc[m][v]);
+        } else {
+            float tmp[gemm_i8_n_block];
+            for (size_t v = 0; v < vec_num; v++)
+                vec_storeu(tmp + v * vec_len, acc[m][v]);
+            std::memcpy(out, tmp, args.n_valid * sizeof(float));
+        }
+    }
+}
+
+template <size_t M_BLK>
+static void gemm_i8_rows(const GemmI8Args& args,
+                         const uint8_t* src,
+                         const float* src_scales,
+                         const int32_t* src_sums,
+                         float* dst) {
+    vec_t acc[M_BLK][vec_num];
+    init_acc<M_BLK>(args, acc);
+
+    for (size_t g = 0, k = 0; g < args.groups; g++) {
+        ivec_t iacc[M_BLK][vec_num];
+        unroll<M_BLK>([&](size_t m) {
+            unroll<vec_num>([&](size_t v) {
+                iacc[m][v] = ivec_zero();
+            });
+        });
+
+        for (const size_t k_end = k + args.group_size; k < k_end; k += gemm_i8_k_pack) {
+            Wei w[vec_num];
+            load_wei(args.wei + k / gemm_i8_k_pack * wei_k_stride, w);
+            unroll<M_BLK>([&](size_t m) {
+                const auto x = x_set1_s8(src + m * args.K + k);
+                unroll<vec_num>([&](size_t v) {
+                    iacc[m][v] = dot(iacc[m][v], x, w[v]);
+                });
+            });
+        }
+
+        vec_t sums[M_BLK][vec_num];
+        unroll<M_BLK>([&](size_t m) {
+            unroll<vec_num>([&](size_t v) {
+                sums[m][v] = ivec_to_float(iacc[m][v]);
+            });
+        });
+        dequantize_group<M_BLK>(args, g, src_scales, src_sums, sums, acc);
+    }
+
+    store_acc<M_BLK>(args, acc, dst);
+}
+
+#if defined(HAVE_AVX512F)
+// vpdpbusd is not a part of the AVX-512 flags the file is built with, so the VNNI kernel gets its own target.
+// Lambdas called by unroll() would not be inlined into it, the rows are unrolled by template recursion instead.
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("avx512vnni"))), apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("avx512vnni")
+#    endif
+
+template <size_t M>
+struct VnniRows {
+    static inline void zero(__m512i* acc) {
+        VnniRows<M - 1>::zero(acc);
+        acc[M - 1] = _mm512_setzero_si512();
+    }
+    static inline void dot(__m512i* acc, const uint8_t* src, size_t src_stride, __m512i w) {
+        VnniRows<M - 1>::dot(acc, src, src_stride, w);
+        acc[M - 1] = _mm512_dpbusd_epi32(acc[M - 1], x_set1(src + (M - 1) * src_stride), w);
+    }
+    static inline void to_float(const __m512i* acc, __m512i comp, vec_t (*sums)[vec_num]) {
+        VnniRows<M - 1>::to_float(acc, comp, sums);
+        sums[M - 1][0] = _mm512_cvtepi32_ps(_mm512_sub_epi32(acc[M - 1], comp));
+    }
+};
+
+template <>
+struct VnniRows<0> {
+    static inline void zero(__m512i*) {}
+    static inline void dot(__m512i*, const uint8_t*, size_t, __m512i) {}
+    static inline void to_float(const __m512i*, __m512i, vec_t (*)[vec_num]) {}
+};
+
+// u8 x s8 products of the shifted activations, sum_k 128 * w[n, k] is subtracted per group
+template <size_t M_BLK>
+static void gemm_i8_rows_vnni(const GemmI8Args& args,
+                              const uint8_t* src,
+                              const float* src_scales,
+                              const int32_t* src_sums,
+                              float* dst) {
+    vec_t acc[M_BLK][vec_num];
+    init_acc<M_BLK>(args, acc);
+
+    for (size_t g = 0, k = 0; g < args.groups; g++) {
+        __m512i iacc[M_BLK];
+        VnniRows<M_BLK>::zero(iacc);
+
+        for (const size_t k_end = k + args.group_size; k < k_end; k += gemm_i8_k_pack) {
+            const auto w = _mm512_loadu_si512(args.wei + k / gemm_i8_k_pack * wei_k_stride);
+            VnniRows<M_BLK>::dot(iacc, src + k, args.K, w);
+        }
+
+        vec_t sums[M_BLK][vec_num];
+        VnniRows<M_BLK>::to_float(iacc, _mm512_loadu_si512(args.wei_comp + g * gemm_i8_n_block), sums);
+        dequantize_group<M_BLK>(args, g, src_scales, src_sums, sums, acc);
+    }
+
+    store_acc<M_BLK>(args, acc, dst);
+}
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+#endif
+
+template <size_t M_BLK>
+static void gemm_i8_block(const GemmI8Args& args,
+                          const uint8_t* src,
+                          const float* src_scales,
+                          const int32_t* src_sums,
+                          float* dst) {
+#if defined(HAVE_AVX512F)
+    if (args.wei_comp) {
+        gemm_i8_rows_vnni<M_BLK>(args, src, src_scales, src_sums, dst);
+        return;
+    }
+#endif
+    gemm_i8_rows<M_BLK>(args, src, src_scales, src_sums, dst);
+}
+
+template <size_t M_BLK>
+struct GemmI8Tail {
+    static void run(size_t m,
+                    const GemmI8Args& args,
+                    const uint8_t* src,
+                    const float* src_scales,
+                    const int32_t* src_sums,
+                    float* dst) {
+        if (m == M_BLK)
+            gemm_i8_block<M_BLK>(args, src, src_scales, src_sums, dst);
+        else
+            GemmI8Tail<M_BLK - 1>::run(m, args, src, src_scales, src_sums, dst);
+    }
+};
+
+template <>
+struct GemmI8Tail<0> {
+    static void run(size_t, const GemmI8Args&, const uint8_t*, const float*, const int32_t*, float*) {}
+};
+
+void quantize_u8(const float* src, size_t size, uint8_t* dst, float* scale, int32_t* sum) {
+    size_t i = 0;
+    float max_abs = 0.f;
+#if defined(HAVE_AVX512F)
+    auto vmax = _mm512_setzero_ps();
+    for (; i + 16 <= size; i += 16)
+        vmax = _mm512_max_ps(vmax, _mm512_abs_ps(_mm512_loadu_ps(src + i)));
+    max_abs = _mm512_reduce_max_ps(vmax);
+#elif defined(HAVE_AVX2)
+    const auto abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    auto vmax = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8)
+        vmax = _mm256_max_ps(vmax, _mm256_and_ps(_mm256_loadu_ps(src + i), abs_mask));
+    float lanes[8];
+    _mm256_storeu_ps(lanes, vmax);
+    max_abs = *std::max_element(lanes, lanes + 8);
+#endif
+    for (; i < size; i++)
+        max_abs = std::max(max_abs, std::abs(src[i]));
+
+    *scale = max_abs / 127.f;
+    const float inv_scale = max_abs > 0.f ? 127.f / max_abs : 0.f;
+
+    i = 0;
+    int32_t total = 0;
+#if defined(HAVE_AVX512F)
+    const auto vinv = _mm512_set1_ps(inv_scale);
+    const auto vshift = _mm512_set1_epi32(128);
+    auto vsum = _mm512_setzero_si512();
+    for (; i + 16 <= size; i += 16) {
+        const auto q = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_loadu_ps(src + i), vinv));
+        vsum = _mm512_add_epi32(vsum, q);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtepi32_epi8(_mm512_add_epi32(q, vshift)));
+    }
+    total = _mm512_reduce_add_epi32(vsum);
+#elif defined(HAVE_AVX2)
+    const auto vinv = _mm256_set1_ps(inv_scale);
+    const auto vshift = _mm256_set1_epi32(128);
+    auto vsum = _mm256_setzero_si256();
+    for (; i + 8 <= size; i += 8) {
+        const auto q = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i), vinv));
+        vsum = _mm256_add_epi32(vsum, q);
+        const auto u = _mm256_add_epi32(q, vshift);
+        const auto u16 = _mm_packs_epi32(_mm256_castsi256_si128(u), _mm256_extracti128_si256(u, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(u16, u16));
+    }
+    int32_t sums[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums), vsum);
+    for (size_t j = 0; j < 8; j++)
+        total += sums[j];
+#endif
+    for (; i < size; i++) {
+        const auto q = static_cast<int32_t>(std::nearbyint(src[i] * inv_scale));
+        dst[i] = static_cast<uint8_t>(q + 128);
+        total += q;
+    }
+    *sum = total;
+}
+
+void gemm_i8(const uint8_t* src,
+             size_t M,
+             size_t K,
+             const float* src_scales,
+             const int32_t* src_sums,
+             size_t group_size,
+             const int8_t* wei,
+             const float* wei_scales,
+             const float* wei_zps,
+             const int32_t* wei_comp,
+             const float* bias,
+             float* dst,
+             size_t dst_stride,
+             size_t n_valid) {
+    const size_t groups = K / group_size;
+    const GemmI8Args args{K, group_size, groups, wei, wei_scales, wei_zps, wei_comp, bias, dst_stride, n_valid};
+
+    size_t m = 0;
+    for (; m + m_block <= M; m += m_block) {
+        gemm_i8_block<m_block>(args,
+                               src + m * K,
+                               src_scales + m * groups,
+                               src_sums + m * groups,
+                               dst + m * dst_stride);
+    }
+    if (m < M) {
+        GemmI8Tail<m_block - 1>::run(M - m,
+                                     args,
+                                     src + m * K,
+                                     src_scales + m * groups,
+                                     src_sums + m * groups,
+                                     dst + m * dst_stride);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
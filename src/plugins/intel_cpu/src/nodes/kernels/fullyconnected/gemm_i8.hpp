@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// number of output channels in one block of packed int8 weights
+static constexpr size_t gemm_i8_n_block = 16;
+// number of consecutive input channels of one output channel packed together (one int32 lane)
+static constexpr size_t gemm_i8_k_pack = 4;
+
+/**
+ * Symmetric quantization of one group of activations:
+ * scale = max(|src|) / 127, q = round(src / scale), dst = q + 128, sum = sum(q)
+ * the activations are stored shifted to u8 as the VNNI dot products expect them
+ */
+void quantize_u8(const float* src, size_t size, uint8_t* dst, float* scale, int32_t* sum);
+
+/**
+ * dst[m, n] = bias[n] + sum_g src_scales[m, g] * wei_scales[g, n] * sum_{k in g} x[m, k] * (wei[n, k] - wei_zps[g, n])
+ * for one block of gemm_i8_n_block output channels, x = src - 128, the int8 products are accumulated in int32.
+ *
+ * src: [M, K] quantized activations (shifted by 128), src_scales / src_sums: [M, K / group_size] their scales and sums
+ * wei: [K / gemm_i8_k_pack, gemm_i8_n_block, gemm_i8_k_pack] int8 weights of the block
+ * wei_scales, wei_zps: [K / group_size, gemm_i8_n_block], wei_zps may be nullptr
+ * wei_comp: [K / group_size, gemm_i8_n_block] 128 * sum_{k in g} wei[n, k], enables u8 x s8 VNNI dot products
+ *           in the AVX-512 build, must be nullptr on hosts without avx512_vnni
+ * bias: gemm_i8_n_block values or nullptr
+ * only the first n_valid channels of the block are stored to dst
+ * the kernels are built for AVX2 and AVX-512 only, the executor requires AVX2
+ */
+void gemm_i8(const uint8_t* src,
+             size_t M,
+             size_t K,
+             const float* src_scales,
+             const int32_t* src_sums,
+             size_t group_size,
+             const int8_t* wei,
+             const float* wei_scales,
+             const float* wei_zps,
+             const int32_t* wei_comp,
+             const float* bias,
+             float* dst,
+             size_t dst_stride,
+             size_t n_valid);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
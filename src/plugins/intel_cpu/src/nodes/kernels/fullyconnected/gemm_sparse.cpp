@@ -0,0 +1,343 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <cstring>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "gemm_sparse.hpp"
+#include "unroll.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// Block sparse weights are a list of non zero weight vectors, every one of them is multiplied
+// by a broadcasted input channel, so the zero blocks are skipped without any extra work.
+// N:M sparse weights select the inputs from a group of 4 input channels by a per lane permutation,
+// which costs one shuffle per non zero weight vector: the format pays off for the memory bound cases.
+#if defined(HAVE_AVX512F)
+using vec_t = __m512;
+using idx_t = __m512i;
+using group_t = __m512;
+static constexpr size_t vec_num = 1;
+static constexpr size_t blocked_m_block = 8;
+static constexpr size_t blocked_k_lanes = 4;
+static constexpr size_t nm_m_block = 8;
+static constexpr size_t nm_k_lanes = 4;
+
+static inline vec_t vec_zero() {
+    return _mm512_setzero_ps();
+}
+static inline vec_t vec_set1(float a) {
+    return _mm512_set1_ps(a);
+}
+static inline vec_t vec_loadu(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    _mm512_storeu_ps(p, a);
+}
+static inline vec_t vec_add(vec_t a, vec_t b) {
+    return _mm512_add_ps(a, b);
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+static inline idx_t idx_load(const uint8_t* p) {
+    return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+}
+// 4 input channels repeated in every 128-bit lane
+static inline group_t group_load(const float* p) {
+    return _mm512_broadcast_f32x4(_mm_loadu_ps(p));
+}
+static inline vec_t group_select(group_t x, idx_t idx) {
+    return _mm512_permutexvar_ps(idx, x);
+}
+#elif defined(HAVE_AVX2)
+using vec_t = __m256;
+using idx_t = __m256i;
+using group_t = __m256;
+static constexpr size_t vec_num = 2;
+static constexpr size_t blocked_m_block = 4;
+static constexpr size_t blocked_k_lanes = 4;
+static constexpr size_t nm_m_block = 2;
+static constexpr size_t nm_k_lanes = 2;
+
+static inline vec_t vec_zero() {
+    return _mm256_setzero_ps();
+}
+static inline vec_t vec_set1(float a) {
+    return _mm256_set1_ps(a);
+}
+static inline vec_t vec_loadu(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    _mm256_storeu_ps(p, a);
+}
+static inline vec_t vec_add(vec_t a, vec_t b) {
+    return _mm256_add_ps(a, b);
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+static inline idx_t idx_load(const uint8_t* p) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+}
+static inline group_t group_load(const float* p) {
+    return _mm256_broadcast_ps(reinterpret_cast<const __m128*>(p));
+}
+// permutevar_ps selects inside of 128-bit lanes by 2 low bits of the index
+static inline vec_t group_select(group_t x, idx_t idx) {
+    return _mm256_permutevar_ps(x, idx);
+}
+#else
+using vec_t = float;
+using idx_t = uint8_t;
+using group_t = const float*;
+static constexpr size_t vec_num = gemm_sparse_n_block;
+static constexpr size_t blocked_m_block = 4;
+static constexpr size_t blocked_k_lanes = 1;
+static constexpr size_t nm_m_block = 4;
+static constexpr size_t nm_k_lanes = 1;
+
+static inline vec_t vec_zero() {
+    return 0.f;
+}
+static inline vec_t vec_set1(float a) {
+    return a;
+}
+static inline vec_t vec_loadu(const float* p) {
+    return *p;
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    *p = a;
+}
+static inline vec_t vec_add(vec_t a, vec_t b) {
+    return a + b;
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return a * b + c;
+}
+static inline idx_t idx_load(const uint8_t* p) {
+    return *p;
+}
+static inline group_t group_load(const float* p) {
+    return p;
+}
+static inline vec_t group_select(group_t x, idx_t idx) {
+    return x[idx];
+}
+#endif
+
+static constexpr size_t vec_len = gemm_sparse_n_block / vec_num;
+// N:M values and indices of one group
+static constexpr size_t nm_group_size = gemm_sparse_nm_nnz * gemm_sparse_n_block;
+
+struct GemmSparseArgs {
+    size_t src_stride;
+    size_t K;
+    const float* values;
+    const uint32_t* k_idx;
+    size_t nnz;
+    const uint8_t* idx;
+    const float* bias;
+    size_t dst_stride;
+    size_t n_valid;
+};
+
+template <size_t K_UNROLL, size_t M_BLK>
+using acc_t = vec_t[K_UNROLL][M_BLK][vec_num];
+
+template <size_t K_UNROLL, size_t M_BLK>
+static inline void init_acc(acc_t<K_UNROLL, M_BLK>& acc, const float* bias) {
+    unroll<vec_num>([&](size_t v) {
+        const auto b = bias ? vec_loadu(bias + v * vec_len) : vec_zero();
+        unroll<M_BLK>([&](size_t m) {
+            acc[0][m][v] = b;
+            unroll<K_UNROLL - 1>([&](size_t u) {
+                acc[u + 1][m][v] = vec_zero();
+            });
+        });
+    });
+}
+
+template <size_t K_UNROLL, size_t M_BLK>
+static inline void store_acc(acc_t<K_UNROLL, M_BLK>& acc, float* dst, size_t dst_stride, size_t n_valid) {
+    unroll<vec_num>([&](size_t v) {
+        unroll<M_BLK>([&](size_t m) {
+            for (size_t u = 1; u < K_UNROLL; u++)
+                acc[0][m][v] = vec_add(acc[0][m][v], acc[u][m][v]);
+        });
+    });
+    for (size_t m = 0; m < M_BLK; m++) {
+        float* out = dst + m * dst_stride;
+        if (n_valid == gemm_sparse_n_block) {
+            for (size_t v = 0; v < vec_num; v++)
+                vec_storeu(out + v * vec_len, acc[0][m][v]);
+        } else {
+            float tmp[gemm_sparse_n_block];
+            for (size_t v = 0; v < vec_num; v++)
+                vec_storeu(tmp + v * vec_len, acc[0][m][v]);
+            std::memcpy(out, tmp, n_valid * sizeof(float));
+        }
+    }
+}
+
+template <size_t M_BLK>
+static void gemm_sparse_blocked_rows(const GemmSparseArgs& args, const float* src, float* dst) {
+    constexpr size_t K_UNROLL = blocked_k_lanes > M_BLK ? blocked_k_lanes / M_BLK : 1;
+    acc_t<K_UNROLL, M_BLK> acc;
+    init_acc<K_UNROLL, M_BLK>(acc, args.bias);
+
+    auto step = [&](size_t u, size_t i) {
+        const float* w_ptr = args.values + i * gemm_sparse_n_block;
+        const float* x_ptr = src + args.k_idx[i];
+        vec_t w[vec_num];
+        unroll<vec_num>([&](size_t v) {
+            w[v] = vec_loadu(w_ptr + v * vec_len);
+        });
+        unroll<M_BLK>([&](size_t m) {
+            const auto x = vec_set1(x_ptr[m * args.src_stride]);
+            unroll<vec_num>([&](size_t v) {
+                acc[u][m][v] = vec_fmadd(x, w[v], acc[u][m][v]);
+            });
+        });
+    };
+
+    size_t i = 0;
+    for (; i + K_UNROLL <= args.nnz; i += K_UNROLL) {
+        unroll<K_UNROLL>([&](size_t u) {
+            step(u, i + u);
+        });
+    }
+    for (; i < args.nnz; i++)
+        step(0, i);
+
+    store_acc<K_UNROLL, M_BLK>(acc, dst, args.dst_stride, args.n_valid);
+}
+
+template <size_t M_BLK>
+static void gemm_sparse_nm_rows(const GemmSparseArgs& args, const float* src, float* dst) {
+    constexpr size_t K_UNROLL = nm_k_lanes > M_BLK ? nm_k_lanes / M_BLK : 1;
+    acc_t<K_UNROLL, M_BLK> acc;
+    init_acc<K_UNROLL, M_BLK>(acc, args.bias);
+
+    auto step = [&](size_t u, size_t g, const float* x_ptr, size_t x_stride) {
+        const float* w_ptr = args.values + g * nm_group_size;
+        const uint8_t* idx_ptr = args.idx + g * nm_group_size;
+        vec_t w[gemm_sparse_nm_nnz][vec_num];
+        idx_t idx[gemm_sparse_nm_nnz][vec_num];
+        unroll<gemm_sparse_nm_nnz>([&](size_t j) {
+            unroll<vec_num>([&](size_t v) {
+                w[j][v] = vec_loadu(w_ptr + j * gemm_sparse_n_block + v * vec_len);
+                idx[j][v] = idx_load(idx_ptr + j * gemm_sparse_n_block + v * vec_len);
+            });
+        });
+        unroll<M_BLK>([&](size_t m) {
+            const auto x = group_load(x_ptr + m * x_stride);
+            unroll<gemm_sparse_nm_nnz>([&](size_t j) {
+                unroll<vec_num>([&](size_t v) {
+                    acc[u][m][v] = vec_fmadd(group_select(x, idx[j][v]), w[j][v], acc[u][m][v]);
+                });
+            });
+        });
+    };
+
+    const size_t full_groups = args.K / gemm_sparse_nm_group;
+    size_t g = 0;
+    for (; g + K_UNROLL <= full_groups; g += K_UNROLL) {
+        unroll<K_UNROLL>([&](size_t u) {
+            step(u, g + u, src + (g + u) * gemm_sparse_nm_group, args.src_stride);
+        });
+    }
+    for (; g < full_groups; g++)
+        step(0, g, src + g * gemm_sparse_nm_group, args.src_stride);
+
+    // the last group is not complete, the inputs are copied to avoid reading out of the rows
+    const size_t tail = args.K - full_groups * gemm_sparse_nm_group;
+    if (tail) {
+        float x_tail[M_BLK][gemm_sparse_nm_group] = {};
+        for (size_t m = 0; m < M_BLK; m++)
+            std::memcpy(x_tail[m], src + m * args.src_stride + full_groups * gemm_sparse_nm_group, tail * sizeof(float));
+        step(0, full_groups, x_tail[0], gemm_sparse_nm_group);
+    }
+
+    store_acc<K_UNROLL, M_BLK>(acc, dst, args.dst_stride, args.n_valid);
+}
+
+// instantiates the kernels for every number of the tail rows
+template <size_t M_BLK, template <size_t> class Kernel>
+struct Tail {
+    static void run(size_t m, const GemmSparseArgs& args, const float* src, float* dst) {
+        if (m == M_BLK)
+            Kernel<M_BLK>::run(args, src, dst);
+        else
+            Tail<M_BLK - 1, Kernel>::run(m, args, src, dst);
+    }
+};
+
+template <template <size_t> class Kernel>
+struct Tail<0, Kernel> {
+    static void run(size_t, const GemmSparseArgs&, const float*, float*) {}
+};
+
+template <size_t M_BLK>
+struct BlockedKernel {
+    static void run(const GemmSparseArgs& args, const float* src, float* dst) {
+        gemm_sparse_blocked_rows<M_BLK>(args, src, dst);
+    }
+};
+
+template <size_t M_BLK>
+struct NMKernel {
+    static void run(const GemmSparseArgs& args, const float* src, float* dst) {
+        gemm_sparse_nm_rows<M_BLK>(args, src, dst);
+    }
+};
+
+template <size_t M_BLOCK, template <size_t> class Kernel>
+static void gemm_sparse(const GemmSparseArgs& args, const float* src, size_t M, float* dst) {
+    size_t m = 0;
+    for (; m + M_BLOCK <= M; m += M_BLOCK)
+        Kernel<M_BLOCK>::run(args, src + m * args.src_stride, dst + m * args.dst_stride);
+    if (m < M)
+        Tail<M_BLOCK - 1, Kernel>::run(M - m, args, src + m * args.src_stride, dst + m * args.dst_stride);
+}
+
+void gemm_sparse_blocked(const float* src,
+                         size_t src_stride,
+                         size_t M,
+                         const float* values,
+                         const uint32_t* k_idx,
+                         size_t nnz,
+                         const float* bias,
+                         float* dst,
+                         size_t dst_stride,
+                         size_t n_valid) {
+    const GemmSparseArgs args{src_stride, 0, values, k_idx, nnz, nullptr, bias, dst_stride, n_valid};
+    gemm_sparse<blocked_m_block, BlockedKernel>(args, src, M, dst);
+}
+
+void gemm_sparse_nm(const float* src,
+                    size_t src_stride,
+                    size_t M,
+                    size_t K,
+                    const float* values,
+                    const uint8_t* idx,
+                    const float* bias,
+                    float* dst,
+                    size_t dst_stride,
+                    size_t n_valid) {
+    const GemmSparseArgs args{src_stride, K, values, nullptr, 0, idx, bias, dst_stride, n_valid};
+    gemm_sparse<nm_m_block, NMKernel>(args, src, M, dst);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
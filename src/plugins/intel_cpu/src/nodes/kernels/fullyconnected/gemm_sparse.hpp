@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// number of output channels in one block of packed sparse weights
+static constexpr size_t gemm_sparse_n_block = 16;
+// N:M sparsity: at most gemm_sparse_nm_nnz non zero weights in every gemm_sparse_nm_group input channels
+static constexpr size_t gemm_sparse_nm_group = 4;
+static constexpr size_t gemm_sparse_nm_nnz = 2;
+// N:M weights need a shuffle per non zero weight vector, they win over dense weights for memory bound GEMV only
+static constexpr size_t gemm_sparse_nm_max_m = 4;
+
+/**
+ * dst[m, n] = bias[n] + sum_i src[m, k_idx[i]] * values[i, n]
+ * for one block of gemm_sparse_n_block output channels with block sparse weights:
+ * only non zero blocks of gemm_sparse_n_block output channels x 1 input channel are stored.
+ *
+ * values: [nnz, gemm_sparse_n_block] weights of the non zero blocks
+ * k_idx: [nnz] input channels of the non zero blocks
+ * bias: gemm_sparse_n_block values or nullptr
+ * only the first n_valid channels of the block are stored to dst
+ */
+void gemm_sparse_blocked(const float* src,
+                         size_t src_stride,
+                         size_t M,
+                         const float* values,
+                         const uint32_t* k_idx,
+                         size_t nnz,
+                         const float* bias,
+                         float* dst,
+                         size_t dst_stride,
+                         size_t n_valid);
+
+/**
+ * The same for one block of gemm_sparse_n_block output channels with N:M (2:4) sparse weights.
+ *
+ * values: [div_up(K, 4), 2, gemm_sparse_n_block] non zero weights of every group of 4 input channels
+ * idx: [div_up(K, 4), 2, gemm_sparse_n_block] positions [0, 4) of the values inside of the group,
+ *      the missing values are zeros
+ */
+void gemm_sparse_nm(const float* src,
+                    size_t src_stride,
+                    size_t M,
+                    size_t K,
+                    const float* values,
+                    const uint8_t* idx,
+                    const float* bias,
+                    float* dst,
+                    size_t dst_stride,
+                    size_t n_valid);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
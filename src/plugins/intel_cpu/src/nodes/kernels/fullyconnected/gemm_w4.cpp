@@ -0,0 +1,277 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <cstring>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "gemm_w4.hpp"
+#include "unroll.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// The weights are unpacked in registers: the 4-bit codes are used as indices of a permutation
+// of the 16 values lookup table, so u4, i4 and nf4 share the same code path.
+// m_block rows share every unpacked weight vector, k_lanes independent accumulation chains
+// are spread between the rows (for GEMV all of them accumulate a single row).
+#if defined(HAVE_AVX512F)
+using vec_t = __m512;
+static constexpr size_t vec_num = 1;
+static constexpr size_t m_block = 8;
+static constexpr size_t k_lanes = 4;
+
+struct Lut {
+    explicit Lut(const float* lut) : v(_mm512_loadu_ps(lut)) {}
+    __m512 v;
+};
+
+static inline vec_t vec_zero() {
+    return _mm512_setzero_ps();
+}
+static inline vec_t vec_set1(float a) {
+    return _mm512_set1_ps(a);
+}
+static inline vec_t vec_loadu(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    _mm512_storeu_ps(p, a);
+}
+static inline vec_t vec_add(vec_t a, vec_t b) {
+    return _mm512_add_ps(a, b);
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+static inline void unpack_w4(const uint8_t* wei, const Lut& lut, vec_t* w) {
+    const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(wei));
+    const auto mask = _mm_set1_epi8(0x0F);
+    const auto lo = _mm_and_si128(packed, mask);
+    const auto hi = _mm_and_si128(_mm_srli_epi16(packed, 4), mask);
+    w[0] = _mm512_permutexvar_ps(_mm512_cvtepu8_epi32(_mm_unpacklo_epi64(lo, hi)), lut.v);
+}
+#elif defined(HAVE_AVX2)
+using vec_t = __m256;
+static constexpr size_t vec_num = 2;
+static constexpr size_t m_block = 2;
+static constexpr size_t k_lanes = 2;
+
+struct Lut {
+    explicit Lut(const float* lut) : lo(_mm256_loadu_ps(lut)), hi(_mm256_loadu_ps(lut + 8)) {}
+    __m256 lo;
+    __m256 hi;
+};
+
+static inline vec_t vec_zero() {
+    return _mm256_setzero_ps();
+}
+static inline vec_t vec_set1(float a) {
+    return _mm256_set1_ps(a);
+}
+static inline vec_t vec_loadu(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    _mm256_storeu_ps(p, a);
+}
+static inline vec_t vec_add(vec_t a, vec_t b) {
+    return _mm256_add_ps(a, b);
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+static inline vec_t lookup(__m256i idx, const Lut& lut) {
+    // permutevar8x32 takes 3 low bits of the index, the 4th one selects the half of the table
+    const auto sel = _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28));
+    return _mm256_blendv_ps(_mm256_permutevar8x32_ps(lut.lo, idx), _mm256_permutevar8x32_ps(lut.hi, idx), sel);
+}
+static inline void unpack_w4(const uint8_t* wei, const Lut& lut, vec_t* w) {
+    const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(wei));
+    const auto mask = _mm_set1_epi8(0x0F);
+    w[0] = lookup(_mm256_cvtepu8_epi32(_mm_and_si128(packed, mask)), lut);
+    w[1] = lookup(_mm256_cvtepu8_epi32(_mm_and_si128(_mm_srli_epi16(packed, 4), mask)), lut);
+}
+#else
+using vec_t = float;
+static constexpr size_t vec_num = gemm_w4_n_block;
+static constexpr size_t m_block = 4;
+static constexpr size_t k_lanes = 1;
+
+struct Lut {
+    explicit Lut(const float* lut) : v(lut) {}
+    const float* v;
+};
+
+static inline vec_t vec_zero() {
+    return 0.f;
+}
+static inline vec_t vec_set1(float a) {
+    return a;
+}
+static inline vec_t vec_loadu(const float* p) {
+    return *p;
+}
+static inline void vec_storeu(float* p, vec_t a) {
+    *p = a;
+}
+static inline vec_t vec_add(vec_t a, vec_t b) {
+    return a + b;
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    return a * b + c;
+}
+static inline void unpack_w4(const uint8_t* wei, const Lut& lut, vec_t* w) {
+    for (size_t i = 0; i < gemm_w4_n_block / 2; i++) {
+        w[i] = lut.v[wei[i] & 0x0F];
+        w[i + gemm_w4_n_block / 2] = lut.v[wei[i] >> 4];
+    }
+}
+#endif
+
+static constexpr size_t vec_len = gemm_w4_n_block / vec_num;
+// bytes of packed weights per input channel
+static constexpr size_t wei_k_stride = gemm_w4_n_block / 2;
+
+struct GemmW4Args {
+    size_t src_stride;
+    size_t K;
+    const uint8_t* wei;
+    const float* lut;
+    const float* scales;
+    const float* zps;
+    size_t group_size;
+    size_t groups;
+    const float* bias;
+    size_t dst_stride;
+    size_t n_valid;
+};
+
+template <size_t M_BLK>
+static void gemm_w4_rows(const GemmW4Args& args, const float* src, const float* src_group_sums, float* dst) {
+    constexpr size_t K_UNROLL = k_lanes > M_BLK ? k_lanes / M_BLK : 1;
+    const Lut lut(args.lut);
+
+    vec_t acc[M_BLK][vec_num];
+    unroll<vec_num>([&](size_t v) {
+        const auto bias = args.bias ? vec_loadu(args.bias + v * vec_len) : vec_zero();
+        unroll<M_BLK>([&](size_t m) {
+            acc[m][v] = bias;
+        });
+    });
+
+    for (size_t g = 0, k = 0; g < args.groups; g++) {
+        vec_t group_acc[K_UNROLL][M_BLK][vec_num];
+        unroll<K_UNROLL>([&](size_t u) {
+            unroll<M_BLK>([&](size_t m) {
+                unroll<vec_num>([&](size_t v) {
+                    group_acc[u][m][v] = vec_zero();
+                });
+            });
+        });
+
+        auto step = [&](size_t u, size_t k) {
+            vec_t w[vec_num];
+            unpack_w4(args.wei + k * wei_k_stride, lut, w);
+            unroll<M_BLK>([&](size_t m) {
+                const auto x = vec_set1(src[m * args.src_stride + k]);
+                unroll<vec_num>([&](size_t v) {
+                    group_acc[u][m][v] = vec_fmadd(x, w[v], group_acc[u][m][v]);
+                });
+            });
+        };
+        const size_t k_end = k + args.group_size;
+        for (; k + K_UNROLL <= k_end; k += K_UNROLL) {
+            unroll<K_UNROLL>([&](size_t u) {
+                step(u, k + u);
+            });
+        }
+        for (; k < k_end; k++)
+            step(0, k);
+
+        unroll<vec_num>([&](size_t v) {
+            const auto offset = g * gemm_w4_n_block + v * vec_len;
+            const auto scale = vec_loadu(args.scales + offset);
+            const auto zp = args.zps ? vec_loadu(args.zps + offset) : vec_zero();
+            unroll<M_BLK>([&](size_t m) {
+                auto sum = group_acc[0][m][v];
+                for (size_t u = 1; u < K_UNROLL; u++)
+                    sum = vec_add(sum, group_acc[u][m][v]);
+                // sum_k x * (w - zp) = sum_k x * w - zp * sum_k x
+                if (args.zps)
+                    sum = vec_fmadd(vec_set1(-src_group_sums[m * args.groups + g]), zp, sum);
+                acc[m][v] = vec_fmadd(sum, scale, acc[m][v]);
+            });
+        });
+    }
+
+    for (size_t m = 0; m < M_BLK; m++) {
+        float* out = dst + m * args.dst_stride;
+        if (args.n_valid == gemm_w4_n_block) {
+            for (size_t v = 0; v < vec_num; v++)
+                vec_storeu(out + v * vec_len, acc[m][v]);
+        } else {
+            float tmp[gemm_w4_n_block];
+            for (size_t v = 0; v < vec_num; v++)
+                vec_storeu(tmp + v * vec_len, acc[m][v]);
+            std::memcpy(out, tmp, args.n_valid * sizeof(float));
+        }
+    }
+}
+
+template <size_t M_BLK>
+struct GemmW4Tail {
+    static void run(size_t m, const GemmW4Args& args, const float* src, const float* src_group_sums, float* dst) {
+        if (m == M_BLK)
+            gemm_w4_rows<M_BLK>(args, src, src_group_sums, dst);
+        else
+            GemmW4Tail<M_BLK - 1>::run(m, args, src, src_group_sums, dst);
+    }
+};
+
+template <>
+struct GemmW4Tail<0> {
+    static void run(size_t, const GemmW4Args&, const float*, const float*, float*) {}
+};
+
+void gemm_w4(const float* src,
+             size_t src_stride,
+             size_t M,
+             size_t K,
+             const uint8_t* wei,
+             const float* lut,
+             const float* scales,
+             const float* zps,
+             size_t group_size,
+             const float* src_group_sums,
+             const float* bias,
+             float* dst,
+             size_t dst_stride,
+             size_t n_valid) {
+    const size_t groups = K / group_size;
+    const GemmW4Args args{src_stride, K, wei, lut, scales, zps, group_size, groups, bias, dst_stride, n_valid};
+
+    size_t m = 0;
+    for (; m + m_block <= M; m += m_block) {
+        gemm_w4_rows<m_block>(args,
+                              src + m * src_stride,
+                              src_group_sums ? src_group_sums + m * groups : nullptr,
+                              dst + m * dst_stride);
+    }
+    if (m < M) {
+        GemmW4Tail<m_block - 1>::run(M - m,
+                                     args,
+                                     src + m * src_stride,
+                                     src_group_sums ? src_group_sums + m * groups : nullptr,
+                                     dst + m * dst_stride);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
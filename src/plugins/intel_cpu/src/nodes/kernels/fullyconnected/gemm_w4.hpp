@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// number of output channels in one block of packed 4-bit weights
+static constexpr size_t gemm_w4_n_block = 16;
+// max number of rows processed by one call
+static constexpr size_t gemm_w4_max_m = 16;
+
+/**
+ * dst[m, n] = bias[n] + sum_g scale[g, n] * sum_{k in g} src[m, k] * (lut[wei[n, k]] - zp[g, n])
+ * for one block of gemm_w4_n_block output channels.
+ *
+ * wei: K * 8 bytes, for every input channel the low nibbles hold the codes of channels [0, 8)
+ *      and the high nibbles the codes of channels [8, 16) of the block
+ * lut: 16 float values of the 4-bit codes (u4, i4 or nf4)
+ * scales, zps: [K / group_size, gemm_w4_n_block], zps may be nullptr
+ * src_group_sums: [M, K / group_size] sums of src over the groups, required with zps only
+ * bias: gemm_w4_n_block values or nullptr
+ * only the first n_valid channels of the block are stored to dst
+ */
+void gemm_w4(const float* src,
+             size_t src_stride,
+             size_t M,
+             size_t K,
+             const uint8_t* wei,
+             const float* lut,
+             const float* scales,
+             const float* zps,
+             size_t group_size,
+             const float* src_group_sums,
+             const float* bias,
+             float* dst,
+             size_t dst_stride,
+             size_t n_valid);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
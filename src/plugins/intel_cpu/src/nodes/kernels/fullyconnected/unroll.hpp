@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+
+// std::index_sequence is not available in C++11
+template <size_t... I>
+struct index_seq {};
+
+template <size_t N, size_t... I>
+struct make_index_seq : make_index_seq<N - 1, N - 1, I...> {};
+
+template <size_t... I>
+struct make_index_seq<0, I...> {
+    using type = index_seq<I...>;
+};
+
+template <typename F, size_t... I>
+inline void unroll_impl(F&& f, index_seq<I...>) {
+    (void)std::initializer_list<int>{0, (f(std::integral_constant<size_t, I>{}), 0)...};
+}
+
+// calls f(0), ..., f(N - 1) with compile time constants, so the arrays of accumulators indexed by them
+// can be kept in registers
+template <size_t N, typename F>
+inline void unroll(F&& f) {
+    unroll_impl(std::forward<F>(f), typename make_index_seq<N>::type{});
+}
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <float.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "sampling_kernel.hpp"
+#include "nodes/kernels/scaled_attn/softmax_kernel.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+static void scale_reduce_max(const float* src, float* dst, const float scale, const size_t size, float& max) {
+#if defined(HAVE_AVX512F)
+    auto v_max = _mm512_set1_ps(std::numeric_limits<float>::lowest());
+    auto v_scale = _mm512_set1_ps(scale);
+    size_t i = 0;
+    while (i + vec_len_f32_avx512 <= size) {
+        auto v_a = _mm512_mul_ps(_mm512_loadu_ps(src + i), v_scale);
+        v_max = _mm512_max_ps(v_max, v_a);
+        _mm512_storeu_ps(dst + i, v_a);
+        i += vec_len_f32_avx512;
+    }
+    if (i < size) {
+        __mmask16 mask = (1 << (size - i)) - 1;
+        auto v_a = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, src + i), v_scale);
+        v_max = _mm512_mask_max_ps(v_max, mask, v_a, v_max);
+        _mm512_mask_storeu_ps(dst + i, mask, v_a);
+    }
+    max = _mm512_reduce_max_ps(v_max);
+#elif defined(HAVE_AVX2)
+    auto v_max = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+    auto v_scale = _mm256_set1_ps(scale);
+    size_t i = 0;
+    while (i + vec_len_f32_avx2 <= size) {
+        auto v_a = _mm256_mul_ps(_mm256_loadu_ps(src + i), v_scale);
+        v_max = _mm256_max_ps(v_max, v_a);
+        _mm256_storeu_ps(dst + i, v_a);
+        i += vec_len_f32_avx2;
+    }
+    if (i < size) {
+        auto mask = get_mask(size - i);
+        auto v_a = _mm256_mul_ps(_mm256_maskload_ps(src + i, mask), v_scale);
+        v_a = _mm256_blendv_ps(v_max, v_a, _mm256_castsi256_ps(mask));
+        v_max = _mm256_max_ps(v_max, v_a);
+        _mm256_maskstore_ps(dst + i, mask, v_a);
+    }
+    hmax(v_max);
+    max = _mm256_cvtss_f32(v_max);
+#else
+    max = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = src[i] * scale;
+        max = dst[i] > max ? dst[i] : max;
+    }
+#endif
+}
+
+void sampling_exp(const float* src, float* dst, float scale, size_t size) {
+    float max = 0.f;
+    float sum = 0.f;
+    scale_reduce_max(src, dst, scale, size, max);
+    exp_reduce_sum(dst, max, size, sum);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
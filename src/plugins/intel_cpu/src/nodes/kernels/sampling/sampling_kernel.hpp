@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * Unnormalized softmax of one row of logits, dst[i] = exp(src[i] * scale - max(src * scale)).
+ * The caller normalizes by the last element of the prefix sum of dst, which it builds anyway.
+ */
+void sampling_exp(const float* src, float* dst, float scale, size_t size);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,231 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <float.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/core/parallel.hpp"
+#include "common.hpp"
+#include "attn_quant.hpp"
+#include "attn_rope.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using namespace ov;
+
+template <typename TA, typename TB>
+static void cvt_copy(TA* a, const TB* b, size_t n) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        auto vb = mm512_uni_loadu_ps(b + i);
+        mm512_uni_storeu_ps(a + i, vb);
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        auto vb = mm256_uni_loadu_ps(b + i);
+        mm256_uni_storeu_ps(a + i, vb);
+    }
+#endif
+    for (; i < n; i++) {
+        a[i] = b[i];
+    }
+}
+
+// dst[i]        = cos[i] * x[i] - sin[i] * x[i + half]
+// dst[i + half] = cos[i + half] * x[i + half] + sin[i + half] * x[i]
+// dst[rotary_dims:S] = x[rotary_dims:S]
+template <typename T>
+static void rotate_half(const T* src, const float* cos, const float* sin, float* dst, size_t rotary_dims, size_t S) {
+    auto half = rotary_dims / 2;
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    for (; i + vec_len_f32_avx512 <= half; i += vec_len_f32_avx512) {
+        auto x0 = mm512_uni_loadu_ps(src + i);
+        auto x1 = mm512_uni_loadu_ps(src + i + half);
+        auto y0 = _mm512_mul_ps(x0, _mm512_loadu_ps(cos + i));
+        auto y1 = _mm512_mul_ps(x1, _mm512_loadu_ps(cos + i + half));
+        y0 = _mm512_fnmadd_ps(x1, _mm512_loadu_ps(sin + i), y0);
+        y1 = _mm512_fmadd_ps(x0, _mm512_loadu_ps(sin + i + half), y1);
+        _mm512_storeu_ps(dst + i, y0);
+        _mm512_storeu_ps(dst + i + half, y1);
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + vec_len_f32_avx2 <= half; i += vec_len_f32_avx2) {
+        auto x0 = mm256_uni_loadu_ps(src + i);
+        auto x1 = mm256_uni_loadu_ps(src + i + half);
+        auto y0 = _mm256_mul_ps(x0, _mm256_loadu_ps(cos + i));
+        auto y1 = _mm256_mul_ps(x1, _mm256_loadu_ps(cos + i + half));
+        y0 = _mm256_fnmadd_ps(x1, _mm256_loadu_ps(sin + i), y0);
+        y1 = _mm256_fmadd_ps(x0, _mm256_loadu_ps(sin + i + half), y1);
+        _mm256_storeu_ps(dst + i, y0);
+        _mm256_storeu_ps(dst + i + half, y1);
+    }
+#endif
+    for (; i < half; i++) {
+        float x0 = src[i];
+        float x1 = src[i + half];
+        dst[i] = cos[i] * x0 - sin[i] * x1;
+        dst[i + half] = cos[i + half] * x1 + sin[i + half] * x0;
+    }
+    cvt_copy(dst + rotary_dims, src + rotary_dims, S - rotary_dims);
+}
+
+static size_t get_position(const ov::intel_cpu::PlainTensor& position_ids, size_t b, size_t h, size_t m) {
+    if (!position_ids)
+        return m;
+    if (position_ids.m_rank == 4)
+        return static_cast<size_t>(position_ids.at<int32_t>({b, h, m, 0}, true));
+    return static_cast<size_t>(position_ids.at<int32_t>({b, m}, true));
+}
+
+// rotates one row of src into dst, a float dst is written in place, other types go through tmp
+template <typename T, typename TDST>
+static void rope_row(const T* src, const float* cos, const float* sin, TDST* dst, float* tmp, size_t rotary_dims, size_t S) {
+    if (std::is_same<TDST, float>::value) {
+        rotate_half(src, cos, sin, reinterpret_cast<float*>(dst), rotary_dims, S);
+    } else {
+        rotate_half(src, cos, sin, tmp, rotary_dims, S);
+        cvt_copy(dst, tmp, S);
+    }
+}
+
+template <typename T, typename TDST>
+static void attn_rope_kernel(const ov::intel_cpu::PlainTensor& src,
+                             const ov::intel_cpu::PlainTensor& cos,
+                             const ov::intel_cpu::PlainTensor& sin,
+                             const ov::intel_cpu::PlainTensor& position_ids,
+                             size_t rotary_dims,
+                             const ov::intel_cpu::PlainTensor& dst) {
+    size_t B = src.m_dims[0], H = src.m_dims[1], L1 = src.m_dims[2], S = src.m_dims[3];
+    ov::intel_cpu::PlainTensor tmp;
+    tmp.resize<float>({static_cast<size_t>(parallel_get_max_threads()), S});
+    parallel_for3d(B, H, L1, [&](size_t b, size_t h, size_t m) {
+        auto pos = get_position(position_ids, b, h, m);
+        rope_row(src.ptr<T>(b, h, m),
+                 &cos.at<float>({b, h, pos, 0}, true),
+                 &sin.at<float>({b, h, pos, 0}, true),
+                 dst.ptr<TDST>(b, h, m),
+                 tmp.ptr<float>(parallel_get_thread_num()),
+                 rotary_dims,
+                 S);
+    });
+}
+
+template <typename T, typename TDST>
+static void attn_rope_concat_kernel(const ov::intel_cpu::PlainTensor& k_src,
+                                    const ov::intel_cpu::PlainTensor& v_src,
+                                    const ov::intel_cpu::PlainTensor& cos,
+                                    const ov::intel_cpu::PlainTensor& sin,
+                                    const ov::intel_cpu::PlainTensor& position_ids,
+                                    size_t rotary_dims,
+                                    const ov::intel_cpu::PlainTensor& past_k,
+                                    const ov::intel_cpu::PlainTensor& past_v) {
+    size_t B = k_src.m_dims[0], H = k_src.m_dims[1], L1 = k_src.m_dims[2], S = k_src.m_dims[3];
+    ov::intel_cpu::PlainTensor tmp;
+    tmp.resize<float>({static_cast<size_t>(parallel_get_max_threads()), S});
+    parallel_for3d(B, H, L1, [&](size_t b, size_t h, size_t m) {
+        auto pos = get_position(position_ids, b, h, m);
+        rope_row(k_src.ptr<T>(b, h, m),
+                 &cos.at<float>({b, h, pos, 0}, true),
+                 &sin.at<float>({b, h, pos, 0}, true),
+                 past_k.ptr<TDST>(b, h, m),
+                 tmp.ptr<float>(parallel_get_thread_num()),
+                 rotary_dims,
+                 S);
+        cvt_copy(past_v.ptr<TDST>(b, h, m), v_src.ptr<T>(b, h, m), S);
+    });
+}
+
+template <typename T>
+static void attn_rope_quant_kernel(const ov::intel_cpu::PlainTensor& k_src,
+                                   const ov::intel_cpu::PlainTensor& v_src,
+                                   const ov::intel_cpu::PlainTensor& cos,
+                                   const ov::intel_cpu::PlainTensor& sin,
+                                   const ov::intel_cpu::PlainTensor& position_ids,
+                                   size_t rotary_dims,
+                                   const ov::intel_cpu::PlainTensor& past_k,
+                                   const ov::intel_cpu::PlainTensor& past_v,
+                                   const ov::intel_cpu::PlainTensor& k_scale_zp,
+                                   const ov::intel_cpu::PlainTensor& v_scale_zp) {
+    size_t B = k_src.m_dims[0], H = k_src.m_dims[1], L1 = k_src.m_dims[2], S = k_src.m_dims[3];
+    ov::intel_cpu::PlainTensor tmp;
+    tmp.resize<float>({static_cast<size_t>(parallel_get_max_threads()), S});
+    parallel_for3d(B, H, L1, [&](size_t b, size_t h, size_t m) {
+        auto pos = get_position(position_ids, b, h, m);
+        auto* p_tmp = tmp.ptr<float>(parallel_get_thread_num());
+        auto* p_k = k_scale_zp.ptr<float>(b, h, m);
+        auto* p_v = v_scale_zp.ptr<float>(b, h, m);
+        rotate_half(k_src.ptr<T>(b, h, m),
+                    &cos.at<float>({b, h, pos, 0}, true),
+                    &sin.at<float>({b, h, pos, 0}, true),
+                    p_tmp,
+                    rotary_dims,
+                    S);
+        attn_quant_u8(p_tmp, past_k.ptr<uint8_t>(b, h, m), S, p_k[0], p_k[1]);
+        cvt_copy(p_tmp, v_src.ptr<T>(b, h, m), S);
+        attn_quant_u8(p_tmp, past_v.ptr<uint8_t>(b, h, m), S, p_v[0], p_v[1]);
+    });
+}
+
+void attn_rope(const ov::intel_cpu::PlainTensor& src,
+               const ov::intel_cpu::PlainTensor& cos,
+               const ov::intel_cpu::PlainTensor& sin,
+               const ov::intel_cpu::PlainTensor& position_ids,
+               size_t rotary_dims,
+               const ov::intel_cpu::PlainTensor& dst) {
+    if (src.get_precision() == ov::element::f32 && dst.get_precision() == ov::element::f32) {
+        attn_rope_kernel<float, float>(src, cos, sin, position_ids, rotary_dims, dst);
+    } else if (src.get_precision() == ov::element::bf16 && dst.get_precision() == ov::element::bf16) {
+        attn_rope_kernel<ov::bfloat16, ov::bfloat16>(src, cos, sin, position_ids, rotary_dims, dst);
+    } else {
+        OPENVINO_THROW("unsupport src type: ", src.get_precision(), ", dst type: ", dst.get_precision(), " in attn_rope");
+    }
+}
+
+void attn_rope_concat(const ov::intel_cpu::PlainTensor& k_src,
+                      const ov::intel_cpu::PlainTensor& v_src,
+                      const ov::intel_cpu::PlainTensor& cos,
+                      const ov::intel_cpu::PlainTensor& sin,
+                      const ov::intel_cpu::PlainTensor& position_ids,
+                      size_t rotary_dims,
+                      const ov::intel_cpu::PlainTensor& past_k,
+                      const ov::intel_cpu::PlainTensor& past_v,
+                      const ov::intel_cpu::PlainTensor& k_scale_zp,
+                      const ov::intel_cpu::PlainTensor& v_scale_zp) {
+    auto src_precision = k_src.get_precision();
+    auto dst_precision = past_k.get_precision();
+    if (src_precision == ov::element::f32 && dst_precision == ov::element::f32) {
+        attn_rope_concat_kernel<float, float>(k_src, v_src, cos, sin, position_ids, rotary_dims, past_k, past_v);
+    } else if (src_precision == ov::element::f32 && dst_precision == ov::element::f16) {
+        attn_rope_concat_kernel<float, ov::float16>(k_src, v_src, cos, sin, position_ids, rotary_dims, past_k, past_v);
+    } else if (src_precision == ov::element::f32 && dst_precision == ov::element::bf16) {
+        attn_rope_concat_kernel<float, ov::bfloat16>(k_src, v_src, cos, sin, position_ids, rotary_dims, past_k, past_v);
+    } else if (src_precision == ov::element::bf16 && dst_precision == ov::element::bf16) {
+        attn_rope_concat_kernel<ov::bfloat16, ov::bfloat16>(k_src, v_src, cos, sin, position_ids, rotary_dims, past_k, past_v);
+    } else if (src_precision == ov::element::f32 && dst_precision == ov::element::u8) {
+        attn_rope_quant_kernel<float>(k_src, v_src, cos, sin, position_ids, rotary_dims, past_k, past_v, k_scale_zp, v_scale_zp);
+    } else if (src_precision == ov::element::bf16 && dst_precision == ov::element::u8) {
+        attn_rope_quant_kernel<ov::bfloat16>(k_src, v_src, cos, sin, position_ids, rotary_dims, past_k, past_v, k_scale_zp, v_scale_zp);
+    } else {
+        OPENVINO_THROW("unsupport src type: ", src_precision, ", dst type: ", dst_precision, " in attn_rope_concat");
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
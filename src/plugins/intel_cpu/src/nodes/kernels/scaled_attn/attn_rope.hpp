@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "openvino/core/type/element_type.hpp"
+#include "utils/plain_tensor.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+// rotate-half RoPE, src/dst: [B, H, L1, S], cos/sin: [B|1, H|1, L, rotary_dims],
+// position_ids: [B, L1] or [B, H|1, L1, 1], may be empty which means the position of token m is m
+void attn_rope(const ov::intel_cpu::PlainTensor& src,
+               const ov::intel_cpu::PlainTensor& cos,
+               const ov::intel_cpu::PlainTensor& sin,
+               const ov::intel_cpu::PlainTensor& position_ids,
+               size_t rotary_dims,
+               const ov::intel_cpu::PlainTensor& dst);
+
+// rotate-half RoPE of k_src and append k_src/v_src to the kv cache in one pass: each row is read once,
+// rotated in registers and stored (converted or quantized to u8 with scale_zp) straight into past_k/past_v,
+// which are the [B, H, L1, S] slices of the cache for the new tokens
+void attn_rope_concat(const ov::intel_cpu::PlainTensor& k_src,
+                      const ov::intel_cpu::PlainTensor& v_src,
+                      const ov::intel_cpu::PlainTensor& cos,
+                      const ov::intel_cpu::PlainTensor& sin,
+                      const ov::intel_cpu::PlainTensor& position_ids,
+                      size_t rotary_dims,
+                      const ov::intel_cpu::PlainTensor& past_k,
+                      const ov::intel_cpu::PlainTensor& past_v,
+                      const ov::intel_cpu::PlainTensor& k_scale_zp,
+                      const ov::intel_cpu::PlainTensor& v_scale_zp);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
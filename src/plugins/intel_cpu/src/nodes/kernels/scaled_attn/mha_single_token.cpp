@@ -18,6 +18,7 @@
 #include "mha_single_token.hpp"
 #include "common.hpp"
 #include "softmax_kernel.hpp"
+#include "nodes/kernels/fullyconnected/unroll.hpp"
 
 namespace ov {
 namespace Extensions {
@@ -739,6 +740,220 @@ static void attn_reduce(T* dst, float* temp, size_t M, size_t S, size_t temp_str
     }
 }
 
+// GQA / MQA: all the query rows (query tokens x query heads) sharing one kv head are computed against
+// the same kv row, which is loaded and converted once for up to kv_group_rows of them.
+#if defined(HAVE_AVX512F)
+static constexpr size_t kv_group_rows = 8;
+#else
+static constexpr size_t kv_group_rows = 4;
+#endif
+
+template<typename T>
+static inline float kv_scale(float* scale) {
+    return 1.0f;
+}
+
+template<>
+inline float kv_scale<uint8_t>(float* scale) {
+    return *scale;
+}
+
+template<typename T>
+static inline float kv_zp(float* zp) {
+    return 0.0f;
+}
+
+template<>
+inline float kv_zp<uint8_t>(float* zp) {
+    return *zp;
+}
+
+template<typename T>
+static inline float kv_to_float(T* p, float zp) {
+    return static_cast<float>(*p);
+}
+
+static inline float kv_to_float(uint8_t* p, float zp) {
+    return *p - zp;
+}
+
+#if defined(HAVE_AVX512F)
+template<typename T>
+static inline __m512 kv_load_avx512(T* p, __m512 v_zp) {
+    return mm512_uni_loadu_ps(p);
+}
+
+static inline __m512 kv_load_avx512(uint8_t* p, __m512 v_zp) {
+    auto v = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(p))));
+    return _mm512_sub_ps(v, v_zp);
+}
+#elif defined(HAVE_AVX2)
+template<typename T>
+static inline __m256 kv_load_avx2(T* p, __m256 v_zp) {
+    return mm256_uni_loadu_ps(p);
+}
+
+static inline __m256 kv_load_avx2(uint8_t* p, __m256 v_zp) {
+    auto v = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i*>(p))));
+    return _mm256_sub_ps(v, v_zp);
+}
+#endif
+
+// out[r] = a[r] * b for ROWS query rows and one key row
+template<size_t ROWS, typename TA, typename TB>
+static void dot_product_rows(TA* const* a, TB* b, size_t n, float* scale, float* zp, float* out) {
+    const float zero_point = kv_zp<TB>(zp);
+    float sum[ROWS];
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    // two accumulators per row to hide the fma latency
+    __m512 vsum0[ROWS], vsum1[ROWS];
+    unroll<ROWS>([&](size_t r) {
+        vsum0[r] = _mm512_setzero_ps();
+        vsum1[r] = _mm512_setzero_ps();
+    });
+    auto v_zp = _mm512_set1_ps(zero_point);
+    for (; i + 2 * vec_len_f32_avx512 <= n; i += 2 * vec_len_f32_avx512) {
+        auto vb0 = kv_load_avx512(b + i, v_zp);
+        auto vb1 = kv_load_avx512(b + i + vec_len_f32_avx512, v_zp);
+        unroll<ROWS>([&](size_t r) {
+            vsum0[r] = _mm512_fmadd_ps(mm512_uni_loadu_ps(a[r] + i), vb0, vsum0[r]);
+            vsum1[r] = _mm512_fmadd_ps(mm512_uni_loadu_ps(a[r] + i + vec_len_f32_avx512), vb1, vsum1[r]);
+        });
+    }
+    if (i + vec_len_f32_avx512 <= n) {
+        auto vb0 = kv_load_avx512(b + i, v_zp);
+        unroll<ROWS>([&](size_t r) {
+            vsum0[r] = _mm512_fmadd_ps(mm512_uni_loadu_ps(a[r] + i), vb0, vsum0[r]);
+        });
+        i += vec_len_f32_avx512;
+    }
+    unroll<ROWS>([&](size_t r) {
+        sum[r] = _mm512_reduce_add_ps(_mm512_add_ps(vsum0[r], vsum1[r]));
+    });
+#elif defined(HAVE_AVX2)
+    __m256 vsum0[ROWS], vsum1[ROWS];
+    unroll<ROWS>([&](size_t r) {
+        vsum0[r] = _mm256_setzero_ps();
+        vsum1[r] = _mm256_setzero_ps();
+    });
+    auto v_zp = _mm256_set1_ps(zero_point);
+    for (; i + 2 * vec_len_f32_avx2 <= n; i += 2 * vec_len_f32_avx2) {
+        auto vb0 = kv_load_avx2(b + i, v_zp);
+        auto vb1 = kv_load_avx2(b + i + vec_len_f32_avx2, v_zp);
+        unroll<ROWS>([&](size_t r) {
+            vsum0[r] = _mm256_fmadd_ps(mm256_uni_loadu_ps(a[r] + i), vb0, vsum0[r]);
+            vsum1[r] = _mm256_fmadd_ps(mm256_uni_loadu_ps(a[r] + i + vec_len_f32_avx2), vb1, vsum1[r]);
+        });
+    }
+    if (i + vec_len_f32_avx2 <= n) {
+        auto vb0 = kv_load_avx2(b + i, v_zp);
+        unroll<ROWS>([&](size_t r) {
+            vsum0[r] = _mm256_fmadd_ps(mm256_uni_loadu_ps(a[r] + i), vb0, vsum0[r]);
+        });
+        i += vec_len_f32_avx2;
+    }
+    unroll<ROWS>([&](size_t r) {
+        auto v = _mm256_add_ps(vsum0[r], vsum1[r]);
+        hsum(v);
+        sum[r] = _mm256_cvtss_f32(v);
+    });
+#else
+    unroll<ROWS>([&](size_t r) {
+        sum[r] = 0.0f;
+    });
+#endif
+    for (; i < n; i++) {
+        auto vb = kv_to_float(b + i, zero_point);
+        unroll<ROWS>([&](size_t r) {
+            sum[r] += a[r][i] * vb;
+        });
+    }
+    const float s = kv_scale<TB>(scale);
+    unroll<ROWS>([&](size_t r) {
+        out[r] = sum[r] * s;
+    });
+}
+
+// out[r] += weight[r] * v for ROWS query rows and one value row
+template<size_t ROWS, typename T>
+static void attn_acc_value_rows(float* const* out, const float* weight, T* v, size_t S, float* scale, float* zp) {
+    const float zero_point = kv_zp<T>(zp);
+    const float s = kv_scale<T>(scale);
+    float* dst[ROWS];
+    float w[ROWS];
+    unroll<ROWS>([&](size_t r) {
+        dst[r] = out[r];
+        w[r] = weight[r] * s;
+    });
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    __m512 vw[ROWS];
+    unroll<ROWS>([&](size_t r) {
+        vw[r] = _mm512_set1_ps(w[r]);
+    });
+    auto v_zp = _mm512_set1_ps(zero_point);
+    for (; i + vec_len_f32_avx512 <= S; i += vec_len_f32_avx512) {
+        auto vv = kv_load_avx512(v + i, v_zp);
+        unroll<ROWS>([&](size_t r) {
+            _mm512_storeu_ps(dst[r] + i, _mm512_fmadd_ps(vw[r], vv, _mm512_loadu_ps(dst[r] + i)));
+        });
+    }
+#elif defined(HAVE_AVX2)
+    __m256 vw[ROWS];
+    unroll<ROWS>([&](size_t r) {
+        vw[r] = _mm256_set1_ps(w[r]);
+    });
+    auto v_zp = _mm256_set1_ps(zero_point);
+    for (; i + vec_len_f32_avx2 <= S; i += vec_len_f32_avx2) {
+        auto vv = kv_load_avx2(v + i, v_zp);
+        unroll<ROWS>([&](size_t r) {
+            _mm256_storeu_ps(dst[r] + i, _mm256_fmadd_ps(vw[r], vv, _mm256_loadu_ps(dst[r] + i)));
+        });
+    }
+#endif
+    for (; i < S; i++) {
+        auto vv = kv_to_float(v + i, zero_point);
+        unroll<ROWS>([&](size_t r) {
+            dst[r][i] += w[r] * vv;
+        });
+    }
+}
+
+template<typename TA, typename TB>
+static void dot_product_group(TA* const* a, TB* b, size_t n, float* scale, float* zp, float* out, size_t rows) {
+    size_t r = 0;
+    for (; r + kv_group_rows <= rows; r += kv_group_rows)
+        dot_product_rows<kv_group_rows>(a + r, b, n, scale, zp, out + r);
+    switch (rows - r) {
+    case 1: dot_product_rows<1>(a + r, b, n, scale, zp, out + r); break;
+    case 2: dot_product_rows<2>(a + r, b, n, scale, zp, out + r); break;
+    case 3: dot_product_rows<3>(a + r, b, n, scale, zp, out + r); break;
+    case 4: dot_product_rows<4>(a + r, b, n, scale, zp, out + r); break;
+    case 5: dot_product_rows<5>(a + r, b, n, scale, zp, out + r); break;
+    case 6: dot_product_rows<6>(a + r, b, n, scale, zp, out + r); break;
+    case 7: dot_product_rows<7>(a + r, b, n, scale, zp, out + r); break;
+    default: break;
+    }
+}
+
+template<typename T>
+static void attn_acc_value_group(float* const* out, const float* weight, T* v, size_t S, float* scale, float* zp, size_t rows) {
+    size_t r = 0;
+    for (; r + kv_group_rows <= rows; r += kv_group_rows)
+        attn_acc_value_rows<kv_group_rows>(out + r, weight + r, v, S, scale, zp);
+    switch (rows - r) {
+    case 1: attn_acc_value_rows<1>(out + r, weight + r, v, S, scale, zp); break;
+    case 2: attn_acc_value_rows<2>(out + r, weight + r, v, S, scale, zp); break;
+    case 3: attn_acc_value_rows<3>(out + r, weight + r, v, S, scale, zp); break;
+    case 4: attn_acc_value_rows<4>(out + r, weight + r, v, S, scale, zp); break;
+    case 5: attn_acc_value_rows<5>(out + r, weight + r, v, S, scale, zp); break;
+    case 6: attn_acc_value_rows<6>(out + r, weight + r, v, S, scale, zp); break;
+    case 7: attn_acc_value_rows<7>(out + r, weight + r, v, S, scale, zp); break;
+    default: break;
+    }
+}
+
 template <typename T, typename T2>
 static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                              const ov::intel_cpu::PlainTensor& present_key,
@@ -748,6 +963,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                              const ov::intel_cpu::PlainTensor& beams,
                              size_t max_context_len,
                              const ov::intel_cpu::PlainTensor& context_lens,
+                             const ov::intel_cpu::PlainTensor& subsequence_lens,
                              ov::intel_cpu::PlainTensor& output_emb,
                              ov::intel_cpu::PlainTensor& buf_attn_w,
                              ov::intel_cpu::PlainTensor& buf_attn_score,
@@ -796,6 +1012,10 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
 
     // TODO: refactor to seperate files
     if (is_pagedattn) {
+        // rows after the new tokens of a sequence are padding of a mixed step, their output is zeroed
+        auto valid_q_len = [&](size_t b) {
+            return subsequence_lens ? static_cast<size_t>(subsequence_lens.ptr<int32_t>()[b]) : q_len;
+        };
         // if present_key is true, it means q*k is already computed in the caller
         if (present_key) {
             parallel_for3d_dynamic(B, h_group_num, kv_len, [&](size_t b, size_t h_group, size_t pk) {
@@ -804,8 +1024,9 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                 if (pk < context_len) {
                     auto block_number = beams.ptr<int32_t>(b)[pk / block_size];
                     auto block_offset = pk % block_size;
+                    auto cur_q_len = valid_q_len(b);
 
-                    for (size_t pq = 0; pq < q_len; pq++) {
+                    for (size_t pq = 0; pq < cur_q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                             buf_attn_w.ptr<float>(b, h, pq)[pk] =
                                     dot_product(query.ptr<T>(b, h, pq), present_key.ptr<T2>(block_number, h_group, block_offset),
@@ -817,8 +1038,12 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
         }
 
         parallel_for3d_dynamic(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
+            auto cur_q_len = valid_q_len(b);
+            if (pq >= cur_q_len)
+                return;
             auto cur_kv_len = static_cast<size_t>(context_lens.ptr<int32_t>()[b]);
-            auto ncausal = cur_kv_len;
+            // the new tokens of a sequence are causal to each other
+            auto ncausal = subsequence_lens ? cur_kv_len - cur_q_len + pq + 1 : cur_kv_len;
             // apply attention mask & sofmax
             float* alibi_ptr = alibi_mask ? &alibi_mask.at<float>({b, h, pq, 0}, true) : nullptr;
             uint8_t* attn_mask_ptr = nullptr;
@@ -846,12 +1071,13 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             parallel_for2d_dynamic(B, h_group_num, [&](size_t b, size_t h_group) {
                 auto ithr = parallel_get_thread_num();
                 auto context_len = static_cast<size_t>(context_lens.ptr<int32_t>()[b]);
+                auto cur_q_len = valid_q_len(b);
                 memset(buf_attn_score.ptr<float>(ithr), 0, q_len * h_each_group_len * S * sizeof(float));
                 for (size_t pv = 0; pv < context_len; pv += block_size) {
                     size_t pv_in_blocks = pv / block_size;
                     auto block_number = beams.ptr<int32_t>(b)[pv_in_blocks];
                     auto* v = present_value.ptr<T2>(block_number, h_group);
-                    for (size_t pq = 0; pq < q_len; pq++) {
+                    for (size_t pq = 0; pq < cur_q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len; h++, group_idx++) {
                             attn_acc_value_block(buf_attn_score.ptr<float>(ithr, pq, group_idx),
                                                  buf_attn_w.ptr<float>(b, h, pq) + pv,
@@ -862,9 +1088,12 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                     }
                 }
                 // convert to dst
-                for (size_t pq = 0; pq < q_len; pq++)
+                for (size_t pq = 0; pq < cur_q_len; pq++)
                     for (size_t h = h_group * h_each_group_len, group_idx = 0; h < (h_group + 1) * h_each_group_len; h++, group_idx++)
                         cvt_copy(output_emb.ptr<T>(b, pq, h * S), buf_attn_score.ptr<float>(ithr, pq, group_idx), S);
+                // padded rows of a mixed step are not computed, their output is zero
+                for (size_t pq = cur_q_len; pq < q_len; pq++)
+                    memset(output_emb.ptr<T>(b, pq, h_group * h_each_group_len * S), 0, h_each_group_len * S * sizeof(T));
             });
             return;
         }
@@ -883,7 +1112,8 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
             if (pv < context_len) {
                 auto block_number = beams.ptr<int32_t>(b)[pv_in_blocks];
                 auto* v = present_value.ptr<T2>(block_number, h_group);
-                for (size_t pq = 0; pq < q_len; pq++) {
+                auto cur_q_len = valid_q_len(b);
+                for (size_t pq = 0; pq < cur_q_len; pq++) {
                     for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                         attn_acc_value_block(buf_attn_score.ptr<float>(ithr, b, pq, h),
                                              buf_attn_w.ptr<float>(b, h, pq) + pv,
@@ -926,16 +1156,29 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         }
                     }
                 } else {
+                    // rows of the group: [q_len, h_each_group_len]
+                    const size_t rows = q_len * h_each_group_len;
+                    std::vector<T*> q_rows(rows);
+                    std::vector<float*> w_rows(rows);
+                    std::vector<float> w(rows);
+                    size_t rows_b = B, rows_h_group = h_group_num;
                     for (size_t iwork = start; iwork < end; ++iwork) {
-                        auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
-                        for (size_t pq = 0; pq < q_len; pq++) {
-                            auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
-                            for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
-                                buf_attn_w.ptr<float>(b, h, pq)[pk] =
-                                        dot_product(query.ptr<T>(b, h, pq), present_key.ptr<T2>(b_kv, h_group, pk),
-                                            S, p, p + 1, head_sum.ptr<float>(b, h, pq));
+                        if (b != rows_b || h_group != rows_h_group) {
+                            for (size_t pq = 0, r = 0; pq < q_len; pq++) {
+                                for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++, r++) {
+                                    q_rows[r] = query.ptr<T>(b, h, pq);
+                                    w_rows[r] = buf_attn_w.ptr<float>(b, h, pq);
+                                }
                             }
+                            rows_b = b;
+                            rows_h_group = h_group;
                         }
+                        auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+                        auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
+                        auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                        dot_product_group(q_rows.data(), p_k, S, p, p + 1, w.data(), rows);
+                        for (size_t r = 0; r < rows; r++)
+                            w_rows[r][pk] = w[r];
                         parallel_it_step(b, B, h_group, h_group_num, pk, kv_len);
                     }
                 }
@@ -989,20 +1232,29 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         parallel_it_step(b, B, h_group, h_group_num, pv, kv_len);
                     }
                 } else {
+                    // rows of the group: [q_len, h_each_group_len]
+                    const size_t rows = q_len * h_each_group_len;
+                    std::vector<float*> out_rows(rows);
+                    std::vector<float*> w_rows(rows);
+                    std::vector<float> w(rows);
+                    size_t rows_b = B, rows_h_group = h_group_num;
                     for (size_t iwork = start; iwork < end; ++iwork) {
+                        if (b != rows_b || h_group != rows_h_group) {
+                            for (size_t pq = 0, r = 0; pq < q_len; pq++) {
+                                for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++, r++) {
+                                    out_rows[r] = buf_attn_score.ptr<float>(ithr, b, pq, h);
+                                    w_rows[r] = buf_attn_w.ptr<float>(b, h, pq);
+                                }
+                            }
+                            rows_b = b;
+                            rows_h_group = h_group;
+                        }
                         auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
                         auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
                         auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
-                        for (size_t pq = 0; pq < q_len; pq++) {
-                            for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
-                                attn_acc_value(buf_attn_score.ptr<float>(ithr, b, pq, h),
-                                            buf_attn_w.ptr<float>(b, h, pq)[pv],
-                                            v,
-                                            S,
-                                            p + 0,
-                                            p + 1);
-                            }
-                        }
+                        for (size_t r = 0; r < rows; r++)
+                            w[r] = w_rows[r][pv];
+                        attn_acc_value_group(out_rows.data(), w.data(), v, S, p + 0, p + 1, rows);
                         parallel_it_step(b, B, h_group, h_group_num, pv, kv_len);
                     }
                 }
@@ -1011,9 +1263,14 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     }
 
     parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
+        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, pq, h * S) : output_emb.ptr<T>(b, h, pq);
+        // padded rows of a mixed paged step are not computed, their output is zero
+        if (subsequence_lens && pq >= static_cast<size_t>(subsequence_lens.ptr<int32_t>()[b])) {
+            memset(dst, 0, S * sizeof(T));
+            return;
+        }
         auto* temp = buf_attn_score.ptr<float>(0, b, pq, h);
         size_t temp_stride = buf_attn_score.stride(0);
-        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, pq, h * S) : output_emb.ptr<T>(b, h, pq);
         attn_reduce(dst, temp, nthr, S, temp_stride);
     });
 }
@@ -1026,6 +1283,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       const ov::intel_cpu::PlainTensor& beams,
                       size_t max_context_len,
                       const ov::intel_cpu::PlainTensor& context_lens,
+                      const ov::intel_cpu::PlainTensor& subsequence_lens,
                       ov::intel_cpu::PlainTensor& output_emb,
                       ov::intel_cpu::PlainTensor& buf_attn_w,
                       ov::intel_cpu::PlainTensor& buf_attn_score,
@@ -1045,6 +1303,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                            beams,
                                                            max_context_len,
                                                            context_lens,
+                                                           subsequence_lens,
                                                            output_emb,
                                                            buf_attn_w,
                                                            buf_attn_score,
@@ -1063,6 +1322,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                                 beams,
                                                                 max_context_len,
                                                                 context_lens,
+                                                                subsequence_lens,
                                                                 output_emb,
                                                                 buf_attn_w,
                                                                 buf_attn_score,
@@ -1083,6 +1343,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                     beams,
                                                     max_context_len,
                                                     context_lens,
+                                                    subsequence_lens,
                                                     output_emb,
                                                     buf_attn_w,
                                                     buf_attn_score,
@@ -1101,6 +1362,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                         beams,
                                                         max_context_len,
                                                         context_lens,
+                                                        subsequence_lens,
                                                         output_emb,
                                                         buf_attn_w,
                                                         buf_attn_score,
@@ -1119,6 +1381,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                                                 beams,
                                                 max_context_len,
                                                 context_lens,
+                                                subsequence_lens,
                                                 output_emb,
                                                 buf_attn_w,
                                                 buf_attn_score,
@@ -23,6 +23,7 @@ void mha_single_token(const ov::intel_cpu::PlainTensor& query,
                       const ov::intel_cpu::PlainTensor& beams,
                       size_t max_context_len,
                       const ov::intel_cpu::PlainTensor& context_lens,
+                      const ov::intel_cpu::PlainTensor& subsequence_lens,
                       ov::intel_cpu::PlainTensor& output_emb,
                       ov::intel_cpu::PlainTensor& buf_attn_w,
                       ov::intel_cpu::PlainTensor& buf_attn_score,
@@ -37,6 +37,35 @@ void attn_softmax(float* a,
     attn_softmax_kernel(a, a_dst, scale, alibi, attn_mask, causal_mask, select_nfltmax_at_0, len, total_size, attn_mask_prec, dst_precision);
 }
 
+float attn_softmax_online(float* a,
+                          void* a_dst,
+                          float scale,
+                          float* alibi,
+                          void* attn_mask,
+                          uint8_t* causal_mask,
+                          bool select_nfltmax_at_0,
+                          size_t len,
+                          size_t total_size,
+                          float& max,
+                          float& sum,
+                          ov::element::Type attn_mask_prec,
+                          ov::element::Type dst_precision) {
+    return attn_softmax_online_kernel(a, a_dst, scale, alibi, attn_mask, causal_mask, select_nfltmax_at_0, len, total_size,
+                                      max, sum, attn_mask_prec, dst_precision);
+}
+
+void attn_acc_rescale(float* acc, const float* a, float rescale, size_t size) {
+    rescale_add(acc, a, rescale, size);
+}
+
+void attn_scale_store(float* a, void* a_dst, float scale, size_t size, ov::element::Type dst_precision) {
+    if (dst_precision == ov::element::f32) {
+        multiply_scalar(a, static_cast<float*>(a_dst), scale, size);
+    } else {
+        multiply_scalar(a, static_cast<ov::bfloat16*>(a_dst), scale, size);
+    }
+}
+
 }  // namespace XARCH
 }  // namespace Cpu
 }  // namespace Extensions
@@ -25,6 +25,29 @@ void attn_softmax(float* a,
                   size_t total_size,
                   ov::element::Type attn_mask_prec,
                   ov::element::Type dst_precision);
+
+// Online softmax over one block of the scores row for the blocked (flash) attention, `max` and `sum`
+// are the running statistics of the row. Stores exp(score - max) to a_dst and returns the factor
+// the output accumulated over the previous blocks must be rescaled with.
+float attn_softmax_online(float* a,
+                          void* a_dst,
+                          float scale,
+                          float* alibi,
+                          void* attn_mask,
+                          uint8_t* causal_mask,
+                          bool select_nfltmax_at_0,
+                          size_t len,
+                          size_t total_size,
+                          float& max,
+                          float& sum,
+                          ov::element::Type attn_mask_prec,
+                          ov::element::Type dst_precision);
+
+// acc = acc * rescale + a
+void attn_acc_rescale(float* acc, const float* a, float rescale, size_t size);
+
+// a_dst = a * scale in dst_precision (f32 or bf16)
+void attn_scale_store(float* a, void* a_dst, float scale, size_t size, ov::element::Type dst_precision);
 }  // namespace XARCH
 }  // namespace Cpu
 }  // namespace Extensions
@@ -6,7 +6,9 @@
 #include "common.hpp"
 #include "openvino/core/type/element_type.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -503,17 +505,15 @@ inline void multiply_scalar(float* a, ov::bfloat16* a_dst, const float val, cons
 #endif
 }
 
-inline void attn_softmax_kernel(float* a,
-                                void* a_dst,
-                                float scale,
-                                float* alibi,
-                                void* attn_mask,
-                                uint8_t* causal_mask,
-                                bool select_nfltmax_at_0,
-                                size_t len,
-                                size_t total_size,
-                                ov::element::Type attn_mask_prec,
-                                ov::element::Type dst_precision) {
+// scales the scores, applies alibi / attention mask / causal mask and returns the max of the result
+inline float attn_scale_mask_reduce_max(float* a,
+                                        float scale,
+                                        float* alibi,
+                                        void* attn_mask,
+                                        uint8_t* causal_mask,
+                                        bool select_nfltmax_at_0,
+                                        size_t len,
+                                        ov::element::Type attn_mask_prec) {
     using func_fp32_type = void (*)(float*, float, const float*, const float*, const uint8_t*, bool, size_t, float&);
     using func_bf16_type = void (*)(float*, float, const float*, const ov::bfloat16*, const uint8_t*, bool, size_t, float&);
     static func_fp32_type funcs_fp32[] = {
@@ -543,6 +543,21 @@ inline void attn_softmax_kernel(float* a,
     } else {
         funcs_bf16[dispatch](a, scale, alibi, static_cast<const ov::bfloat16*>(attn_mask), causal_mask, select_nfltmax_at_0, len, max);
     }
+    return max;
+}
+
+inline void attn_softmax_kernel(float* a,
+                                void* a_dst,
+                                float scale,
+                                float* alibi,
+                                void* attn_mask,
+                                uint8_t* causal_mask,
+                                bool select_nfltmax_at_0,
+                                size_t len,
+                                size_t total_size,
+                                ov::element::Type attn_mask_prec,
+                                ov::element::Type dst_precision) {
+    float max = attn_scale_mask_reduce_max(a, scale, alibi, attn_mask, causal_mask, select_nfltmax_at_0, len, attn_mask_prec);
 
     float sum = 0.0f;
     // exp sum
@@ -562,6 +577,82 @@ inline void attn_softmax_kernel(float* a,
     }
 }
 
+// acc = acc * rescale + a
+inline void rescale_add(float* acc, const float* a, const float rescale, const size_t size) {
+#if defined(HAVE_AVX512F)
+    auto v_rescale = _mm512_set1_ps(rescale);
+    size_t i = 0;
+    while (i + vec_len_f32_avx512 <= size) {
+        auto v_acc = _mm512_loadu_ps(acc + i);
+        v_acc = _mm512_fmadd_ps(v_acc, v_rescale, _mm512_loadu_ps(a + i));
+        _mm512_storeu_ps(acc + i, v_acc);
+        i += vec_len_f32_avx512;
+    }
+    if (i < size) {
+        __mmask16 mask = (1 << (size - i)) - 1;
+        auto v_acc = _mm512_maskz_loadu_ps(mask, acc + i);
+        v_acc = _mm512_fmadd_ps(v_acc, v_rescale, _mm512_maskz_loadu_ps(mask, a + i));
+        _mm512_mask_storeu_ps(acc + i, mask, v_acc);
+    }
+#elif defined(HAVE_AVX2)
+    auto v_rescale = _mm256_set1_ps(rescale);
+    size_t i = 0;
+    while (i + vec_len_f32_avx2 <= size) {
+        auto v_acc = _mm256_loadu_ps(acc + i);
+        v_acc = _mm256_fmadd_ps(v_acc, v_rescale, _mm256_loadu_ps(a + i));
+        _mm256_storeu_ps(acc + i, v_acc);
+        i += vec_len_f32_avx2;
+    }
+    if (i < size) {
+        auto mask = get_mask(size - i);
+        auto v_acc = _mm256_maskload_ps(acc + i, mask);
+        v_acc = _mm256_fmadd_ps(v_acc, v_rescale, _mm256_maskload_ps(a + i, mask));
+        _mm256_maskstore_ps(acc + i, mask, v_acc);
+    }
+#else
+    for (size_t i = 0; i < size; i++) {
+        acc[i] = acc[i] * rescale + a[i];
+    }
+#endif
+}
+
+// One step of the online softmax used by the blocked (flash) attention: the block of scores is
+// scaled and masked the same way as in attn_softmax_kernel, the running max / sum of the row are
+// updated and the unnormalized exp(score - max) are stored to a_dst. The output accumulated over the
+// previous blocks must be multiplied by the returned factor.
+inline float attn_softmax_online_kernel(float* a,
+                                        void* a_dst,
+                                        float scale,
+                                        float* alibi,
+                                        void* attn_mask,
+                                        uint8_t* causal_mask,
+                                        bool select_nfltmax_at_0,
+                                        size_t len,
+                                        size_t total_size,
+                                        float& max,
+                                        float& sum,
+                                        ov::element::Type attn_mask_prec,
+                                        ov::element::Type dst_precision) {
+    float blk_max = attn_scale_mask_reduce_max(a, scale, alibi, attn_mask, causal_mask, select_nfltmax_at_0, len, attn_mask_prec);
+    float new_max = std::max(max, blk_max);
+    float blk_sum = 0.0f;
+    exp_reduce_sum(a, new_max, len, blk_sum);
+    float rescale = std::exp(max - new_max);
+    max = new_max;
+    sum = sum * rescale + blk_sum;
+    if (dst_precision == ov::element::f32) {
+        if (a_dst != a)
+            memcpy(a_dst, a, sizeof(float) * len);
+        if (total_size > len)
+            memset(static_cast<float*>(a_dst) + len, 0, sizeof(float) * (total_size - len));
+    } else {
+        multiply_scalar(a, static_cast<ov::bfloat16*>(a_dst), 1.0f, len);
+        if (total_size > len)
+            memset(static_cast<ov::bfloat16*>(a_dst) + len, 0, sizeof(ov::bfloat16) * (total_size - len));
+    }
+    return rescale;
+}
+
 }  // namespace XARCH
 }  // namespace Cpu
 }  // namespace Extensions
@@ -579,14 +579,20 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                int max_out_box =
+                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
+                // only the top nms_top_k candidates are visited, so they are selected first and only they are sorted
+                auto greater = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
+                };
+                const auto top_end = sorted_boxes.begin() + max_out_box;
+                if (top_end != sorted_boxes.end()) {
+                    std::nth_element(sorted_boxes.begin(), top_end, sorted_boxes.end(), greater);
+                }
+                std::sort(sorted_boxes.begin(), top_end, greater);
                 int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
                 m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
                 for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
                     bool box_is_selected = true;
                     for (int idx = io_selection_size - 1; idx >= 0; idx--) {
@@ -17,12 +17,37 @@
 #include "openvino/op/non_max_suppression.hpp"
 #include "ov_ops/nms_ie_internal.hpp"
 
+#include <algorithm>
 #include <queue>
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+// The hard suppression visits the candidates in the order of decreasing score and usually stops after a small part of
+// them, so the candidates are ordered lazily: the next chunk is selected with nth_element and only it gets sorted.
+constexpr size_t NMS_MIN_SORT_CHUNK = 256lu;
+// Number of the selected boxes checked against a candidate before the suppression is tested.
+constexpr int NMS_IOU_BLOCK = 16;
+
+template <typename Candidate>
+bool greaterScore(const Candidate& l, const Candidate& r) {
+    return l.first > r.first || ((l.first == r.first) && (l.second < r.second));
+}
+
+template <typename Candidate>
+size_t sortNextCandidates(std::vector<Candidate>& candidates, size_t sorted_num, size_t chunk) {
+    const auto first = candidates.begin() + sorted_num;
+    const auto last = candidates.begin() + std::min(candidates.size(), sorted_num + chunk);
+    if (last != candidates.end()) {
+        std::nth_element(first, last, candidates.end(), greaterScore<Candidate>);
+    }
+    std::sort(first, last, greaterScore<Candidate>);
+    return last - candidates.begin();
+}
+}  // namespace
+
 bool NonMaxSuppression::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), op::v9::NonMaxSuppression::get_type_info_static(),
@@ -471,20 +496,19 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         int io_selection_size = 0;
         const size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0lu) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+            // no nested parallel sort: the outer loop already occupies the threads, and only the head is sorted
+            size_t sorted_num = sortNextCandidates(sorted_boxes, 0lu, std::max(4 * m_output_boxes_per_class, NMS_MIN_SORT_CHUNK));
             int offset = batch_idx * m_classes_num * m_output_boxes_per_class + class_idx * m_output_boxes_per_class;
             filtBoxes[offset + 0] = FilteredBox(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
             if (sortedBoxSize > 1lu) {
                 if (m_jit_kernel) {
 #if defined(OPENVINO_ARCH_X86_64)
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
+                    const size_t maxSelectedNum = std::min(sortedBoxSize, m_output_boxes_per_class);
+                    std::vector<float> boxCoord0(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord1(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord2(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord3(maxSelectedNum, 0.0f);
 
                     boxCoord0[0] = boxesPtr[sorted_boxes[0].second * m_coord_num];
                     boxCoord1[0] = boxesPtr[sorted_boxes[0].second * m_coord_num + 1];
@@ -502,6 +526,9 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
                     arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
 
                     for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                        if (candidate_idx == sorted_num) {
+                            sorted_num = sortNextCandidates(sorted_boxes, sorted_num, sorted_num);
+                        }
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         arg.selected_boxes_num = io_selection_size;
                         arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num]);
@@ -519,20 +546,44 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
                     }
 #endif // OPENVINO_ARCH_X86_64
                 } else {
+                    // The selected boxes are kept in corner form and structure of arrays layout, so the IoU of the candidate
+                    // against a block of them vectorizes. The result is the same as of intersectionOverUnion().
+                    const size_t maxSelectedNum = std::min(sortedBoxSize, m_output_boxes_per_class);
+                    std::vector<float> selYmin(maxSelectedNum), selXmin(maxSelectedNum), selYmax(maxSelectedNum),
+                                       selXmax(maxSelectedNum), selArea(maxSelectedNum);
+                    auto addSelected = [&](int selected_idx, int box_idx) {
+                        boxCorners(&boxesPtr[box_idx * m_coord_num], selYmin[selected_idx], selXmin[selected_idx],
+                                   selYmax[selected_idx], selXmax[selected_idx]);
+                        selArea[selected_idx] = (selYmax[selected_idx] - selYmin[selected_idx]) * (selXmax[selected_idx] - selXmin[selected_idx]);
+                    };
+                    addSelected(0, sorted_boxes[0].second);
+
                     for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num],
-                                    &boxesPtr[filtBoxes[offset + selected_idx].box_index * m_coord_num]);
-                            if (iou >= m_iou_threshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
+                        if (candidate_idx == sorted_num) {
+                            sorted_num = sortNextCandidates(sorted_boxes, sorted_num, sorted_num);
+                        }
+                        float ymin, xmin, ymax, xmax;
+                        boxCorners(&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num], ymin, xmin, ymax, xmax);
+                        const float area = (ymax - ymin) * (xmax - xmin);
+
+                        // a degenerate candidate has zero IoU with any box
+                        bool suppressed = area <= 0.f && 0.f >= m_iou_threshold;
+                        for (int block = 0; area > 0.f && block < io_selection_size && !suppressed; block += NMS_IOU_BLOCK) {
+                            const int block_end = std::min(io_selection_size, block + NMS_IOU_BLOCK);
+                            int hits = 0;
+                            for (int j = block; j < block_end; j++) {
+                                const float intersection = (std::max)((std::min)(ymax, selYmax[j]) - (std::max)(ymin, selYmin[j]), 0.f) *
+                                                           (std::max)((std::min)(xmax, selXmax[j]) - (std::max)(xmin, selXmin[j]), 0.f);
+                                const float iou = selArea[j] > 0.f ? intersection / (area + selArea[j] - intersection) : 0.f;
+                                hits += iou >= m_iou_threshold;
                             }
+                            suppressed = hits > 0;
                         }
 
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
+                        if (!suppressed) {
                             filtBoxes[offset + io_selection_size] =
                                 FilteredBox(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                            addSelected(io_selection_size, sorted_boxes[candidate_idx].second);
                             io_selection_size++;
                         }
                     }
@@ -800,10 +851,7 @@ void NonMaxSuppression::nmsRotated(const float* boxes, const float* scores, cons
             const size_t sorted_boxes_size = sorted_indices.size();
 
             if (sorted_boxes_size > 0lu) {
-                parallel_sort(sorted_indices.begin(), sorted_indices.end(),
-                            [](const std::pair<float, size_t>& l, const std::pair<float, size_t>& r) {
-                                return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                            });
+                size_t sorted_num = sortNextCandidates(sorted_indices, 0lu, std::max(4 * m_output_boxes_per_class, NMS_MIN_SORT_CHUNK));
                 auto sorted_indices_ptr = sorted_indices.data();
                 auto filtered_boxes_ptr = filtered_boxes.data()
                         + batch_idx * m_classes_num * m_output_boxes_per_class + class_idx * m_output_boxes_per_class;
@@ -815,6 +863,9 @@ void NonMaxSuppression::nmsRotated(const float* boxes, const float* scores, cons
 
                     for (size_t candidate_idx = 1lu; (candidate_idx < sorted_boxes_size) && (io_selection_size < m_output_boxes_per_class);
                             candidate_idx++, sorted_indices_ptr++) {
+                        if (candidate_idx == sorted_num) {
+                            sorted_num = sortNextCandidates(sorted_indices, sorted_num, sorted_num);
+                        }
                         candidate_status = NMSCandidateStatus::SELECTED;
                         auto box_0 = boxes_ptr + (*sorted_indices_ptr).second * m_coord_num;
                         const auto area_0 = box_0[2] * box_0[3]; // W x H
@@ -850,29 +901,26 @@ void NonMaxSuppression::nmsRotated(const float* boxes, const float* scores, cons
 
 /////////////// End of Rotated boxes ///////////////
 
-float NonMaxSuppression::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+void NonMaxSuppression::boxCorners(const float *box, float &ymin, float &xmin, float &ymax, float &xmax) const {
     if (boxEncodingType == NMSBoxEncodeType::CENTER) {
         //  box format: x_center, y_center, width, height
-        yminI = boxesI[1] - boxesI[3] / 2.f;
-        xminI = boxesI[0] - boxesI[2] / 2.f;
-        ymaxI = boxesI[1] + boxesI[3] / 2.f;
-        xmaxI = boxesI[0] + boxesI[2] / 2.f;
-        yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-        xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-        ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-        xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
+        ymin = box[1] - box[3] / 2.f;
+        xmin = box[0] - box[2] / 2.f;
+        ymax = box[1] + box[3] / 2.f;
+        xmax = box[0] + box[2] / 2.f;
     } else {
         //  box format: y1, x1, y2, x2
-        yminI = (std::min)(boxesI[0], boxesI[2]);
-        xminI = (std::min)(boxesI[1], boxesI[3]);
-        ymaxI = (std::max)(boxesI[0], boxesI[2]);
-        xmaxI = (std::max)(boxesI[1], boxesI[3]);
-        yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-        xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-        ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-        xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
+        ymin = (std::min)(box[0], box[2]);
+        xmin = (std::min)(box[1], box[3]);
+        ymax = (std::max)(box[0], box[2]);
+        xmax = (std::max)(box[1], box[3]);
     }
+}
+
+float NonMaxSuppression::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
+    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+    boxCorners(boxesI, yminI, xminI, ymaxI, xmaxI);
+    boxCorners(boxesJ, yminJ, xminJ, ymaxJ, xmaxJ);
 
     float areaI = (ymaxI - yminI) * (xmaxI - xminI);
     float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
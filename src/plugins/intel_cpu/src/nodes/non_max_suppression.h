@@ -93,6 +93,8 @@ private:
         NMS_VALID_OUTPUTS
     };
 
+    void boxCorners(const float *box, float &ymin, float &xmin, float &ymax, float &xmax) const;
+
     float intersectionOverUnion(const float *boxesI, const float *boxesJ);
 
     float rotatedIntersectionOverUnion(const Point2D (&vertices_0)[4], const float area_0, const float* box_1);
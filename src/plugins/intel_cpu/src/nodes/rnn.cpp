@@ -21,6 +21,7 @@
 #include "openvino/core/node.hpp"
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <algorithm>
 #include <string>
 #include <utility>
 
@@ -1114,69 +1115,76 @@ void RNN::prepareParams() {
     auto dataMemPtr = getSrcMemoryAtPort(0);
     const size_t B = dataMemPtr->getShape().getStaticDims()[0];
     const size_t SL = is_cell ? 1lu : dataMemPtr->getShape().getStaticDims()[1];
-    const Shape shapeS_4D{L, D, B, SC};
 
-    inDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, inDataTypes[xIdx], memory::format_tag::tnc);
-    outDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc);
+    auto cached = execByShape.find({B, SL});
+    if (cached != execByShape.end()) {
+        execPtr = cached->second;
+    } else {
+        const Shape shapeS_4D{L, D, B, SC};
 
-    inDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc);
-    outDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc);
+        inDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, inDataTypes[xIdx], memory::format_tag::tnc);
+        outDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc);
 
-    if (haveCellState(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc);
-        outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc);
-    } else if (haveAttention(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, 1}, inDataTypes[aIdx], memory::format_tag::tnc);
-    }
+        inDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc);
+        outDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc);
 
-    const auto attr = initPrimitiveAttr();
-    RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type, cell_act, direction, *attr };
-
-    auto engine = getEngine();
-    auto builder = [&engine](const RNNKey& key) -> executorPtr {
-        const auto descPtr = createPrimitiveDescriptor(engine,
-                                                       key.cellType,
-                                                       key.cellAct,
-                                                       key.direction,
-                                                       key.inDataDescs,
-                                                       key.outDataDescs,
-                                                       key.wDescs,
-                                                       key.attr);
-
-        return descPtr ? std::make_shared<RnnDnnlExecutor>(descPtr) : nullptr;
-    };
-
-    auto cache = context->getParamsCache();
-    auto result = cache->getOrCreate(key, builder);
-    auto prevExecPtr = execPtr;
-    execPtr = result.first;
-
-    if (!execPtr) {
-        OPENVINO_THROW("Primitive descriptor was not found for node ", getName(), ".");
-    }
+        if (haveCellState(cell_type)) {
+            inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc);
+            outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc);
+        } else if (haveAttention(cell_type)) {
+            inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, 1}, inDataTypes[aIdx], memory::format_tag::tnc);
+        }
 
-    if (!primArgs.count(DNNL_ARG_WEIGHTS_LAYER) || !prevExecPtr ||
-        !execPtr->getWeightDesc()->isCompatible(*(prevExecPtr->getWeightDesc()))) {
-        prepareMemory(execPtr->getWeightDesc(), 0);
-        primArgs[DNNL_ARG_WEIGHTS_LAYER] = internalBlobMemory[0]->getPrimitive();
-    }
+        const auto attr = initPrimitiveAttr();
+        RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type, cell_act, direction, *attr };
+
+        auto engine = getEngine();
+        auto builder = [&engine](const RNNKey& key) -> executorPtr {
+            const auto descPtr = createPrimitiveDescriptor(engine,
+                                                           key.cellType,
+                                                           key.cellAct,
+                                                           key.direction,
+                                                           key.inDataDescs,
+                                                           key.outDataDescs,
+                                                           key.wDescs,
+                                                           key.attr);
+
+            return descPtr ? std::make_shared<RnnDnnlExecutor>(descPtr) : nullptr;
+        };
+
+        auto cache = context->getParamsCache();
+        auto result = cache->getOrCreate(key, builder);
+        execPtr = result.first;
+
+        if (!execPtr) {
+            OPENVINO_THROW("Primitive descriptor was not found for node ", getName(), ".");
+        }
 
-    if (!primArgs.count(DNNL_ARG_WEIGHTS_ITER) || !prevExecPtr ||
-        !execPtr->getWeightIterDesc()->isCompatible(*(prevExecPtr->getWeightIterDesc()))) {
-        prepareMemory(execPtr->getWeightIterDesc(), 1);
-        primArgs[DNNL_ARG_WEIGHTS_ITER] = internalBlobMemory[1]->getPrimitive();
+        if (execByShape.size() >= maxCachedShapes)
+            execByShape.clear();
+        execByShape.emplace(std::make_pair(B, SL), execPtr);
     }
 
-    if (!primArgs.count(DNNL_ARG_BIAS) || !prevExecPtr ||
-        !execPtr->getBiasDesc()->isCompatible(*(prevExecPtr->getBiasDesc()))) {
-        prepareMemory(execPtr->getBiasDesc(), 2);
-        primArgs[DNNL_ARG_BIAS] = internalBlobMemory[2]->getPrimitive();
-    }
+    prepareWeightsMemory(execPtr->getWeightDesc(), 0, DNNL_ARG_WEIGHTS_LAYER);
+    prepareWeightsMemory(execPtr->getWeightIterDesc(), 1, DNNL_ARG_WEIGHTS_ITER);
+    prepareWeightsMemory(execPtr->getBiasDesc(), 2, DNNL_ARG_BIAS);
 
     auto scratchpadMem = getScratchPadMem(execPtr->getScratchPadDesc());
     primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
 }
 
+void RNN::prepareWeightsMemory(const DnnlMemoryDescPtr& desc, size_t idx, int arg) {
+    auto& prepared = reorderedWeights[idx];
+    auto found = std::find_if(prepared.begin(), prepared.end(), [&desc](const MemoryPtr& mem) {
+        return mem->getDesc().isCompatible(*desc);
+    });
+    if (found == prepared.end()) {
+        prepareMemory(desc, idx);
+        found = prepared.insert(prepared.end(), internalBlobMemory[idx]);
+    }
+    primArgs[arg] = (*found)->getPrimitive();
+}
+
 std::shared_ptr<MemoryDesc> RNN::getSrcMemDesc(const dnnl::primitive_desc& prim_desc, size_t idx) const {
     (void) prim_desc;
     return supportedPrimitiveDescriptors[0].getConfig().inConfs[idx].getMemDesc();
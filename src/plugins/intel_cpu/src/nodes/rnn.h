@@ -7,8 +7,11 @@
 #include <node.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
+#include <array>
+#include <map>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "common/dnnl_executor.h"
@@ -67,6 +70,7 @@ private:
     void fillBiases(const int* gate_map);
 
     void copyWeightsData();
+    void prepareWeightsMemory(const DnnlMemoryDescPtr& desc, size_t idx, int arg);
 
     class RnnDnnlExecutor : public DnnlExecutor {
         public:
@@ -88,6 +92,13 @@ private:
     using executorPtr = std::shared_ptr<RnnDnnlExecutor>;
     executorPtr execPtr = nullptr;
 
+    /** Streaming models run the node chunk by chunk with a few distinct sequence lengths. Executors of the seen
+     *  {batch, seq_len} pairs and the weights reordered for them are kept by the node, so switching between
+     *  chunk lengths neither rebuilds the primitive key nor rehashes and reorders the weights. */
+    std::map<std::pair<size_t, size_t>, executorPtr> execByShape;
+    std::array<std::vector<MemoryPtr>, 3> reorderedWeights;
+    static constexpr size_t maxCachedShapes = 16lu;
+
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
 
@@ -0,0 +1,222 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "kernels/sampling/sampling_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+// candidate a is ranked before b, ties are resolved to the lower index like in TopK
+inline bool rankedBefore(const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b) {
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+}  // namespace
+
+bool Sampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto node = ov::as_type_ptr<const SamplingNode>(op);
+        if (!node) {
+            errorMessage = "Only Sampling from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+Sampling::Sampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    m_config = ov::as_type_ptr<const SamplingNode>(op)->get_config();
+    // samples are random, the node must not be constant folded
+    constant = ConstantType::StrictNoConst;
+}
+
+void Sampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, ov::element::f32}},
+                         {{LayoutType::ncsp, m_config.output_type}},
+                         ref_any);
+}
+
+bool Sampling::created() const {
+    return getType() == Type::Sampling;
+}
+
+bool Sampling::isExecutable() const {
+    // an empty vocabulary is rejected in prepareParams, so only an empty batch is skipped
+    return !isOutputTensorAtPortEmpty(0);
+}
+
+bool Sampling::needPrepareParams() const {
+    return inputShapesModified();
+}
+
+void Sampling::prepareParams() {
+    const auto& logits_dims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    if (logits_dims.size() != 2) {
+        THROW_CPU_NODE_ERR("has incompatible 'logits' shape ", PartialShape(logits_dims), ". Only 2D tensors are allowed.");
+    }
+    if (logits_dims[1] == 0) {
+        THROW_CPU_NODE_ERR("has empty vocabulary in 'logits' shape ", PartialShape(logits_dims));
+    }
+    m_batches_count = logits_dims[0];
+    m_probs_count = logits_dims[1];
+    m_candidates_count = m_config.top_k ? std::min(m_config.top_k, m_probs_count) : m_probs_count;
+
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    m_weights.resize(nthr * m_candidates_count);
+    if (m_config.top_k) {
+        m_ids.resize(nthr * m_candidates_count);
+        m_heap.resize(nthr * m_candidates_count);
+    }
+    m_random_samples.resize(m_batches_count * m_config.num_samples);
+}
+
+size_t Sampling::selectTopK(const float* logits, float* weights, int32_t* ids, std::pair<float, int32_t>* heap) const {
+    const size_t k = m_candidates_count;
+    // a heap of the k best logits seen so far, the worst of them is on top
+    for (size_t i = 0; i < k; i++)
+        heap[i] = {logits[i], static_cast<int32_t>(i)};
+    std::make_heap(heap, heap + k, rankedBefore);
+    for (size_t i = k; i < m_probs_count; i++) {
+        if (logits[i] > heap[0].first) {
+            std::pop_heap(heap, heap + k, rankedBefore);
+            heap[k - 1] = {logits[i], static_cast<int32_t>(i)};
+            std::push_heap(heap, heap + k, rankedBefore);
+        }
+    }
+    std::sort_heap(heap, heap + k, rankedBefore);
+
+    const float max = heap[0].first;
+    float sum = 0.f;
+    for (size_t i = 0; i < k; i++) {
+        weights[i] = std::exp((heap[i].first - max) * m_config.inv_temperature);
+        ids[i] = heap[i].second;
+        sum += weights[i];
+    }
+    if (m_config.top_p >= 1.f)
+        return k;
+
+    // keep the candidates whose exclusive cumulative probability does not exceed (or is below) top_p
+    const float threshold = m_config.top_p * sum;
+    float cumsum = 0.f;
+    size_t count = 0;
+    if (m_config.top_p_strict) {
+        while (count < k && cumsum < threshold)
+            cumsum += weights[count++];
+    } else {
+        while (count < k && cumsum <= threshold)
+            cumsum += weights[count++];
+    }
+    return count;
+}
+
+template <typename O>
+void Sampling::executeImpl() {
+    const auto* logits = getSrcDataAtPortAs<const float>(0);
+    auto* output = getDstDataAtPortAs<O>(0);
+    const size_t samples_count = m_config.num_samples;
+
+    // the same random sequence as Multinomial generates for these seeds
+    std::mt19937 gen;
+    if (m_config.global_seed == 0 && m_config.op_seed == 0) {
+        gen.seed(std::time(NULL));
+    } else {
+        std::seed_seq seed{m_config.global_seed, m_config.op_seed};
+        gen.seed(seed);
+    }
+    const auto gen_max = static_cast<float>(gen.max());
+    std::generate(m_random_samples.begin(), m_random_samples.end(), [&]() {
+        return static_cast<float>(gen()) / gen_max;
+    });
+
+    const auto threads_count = std::min(static_cast<size_t>(parallel_get_max_threads()), m_batches_count);
+    parallel_nt(static_cast<int>(threads_count), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(m_batches_count, nthr, ithr, start, end);
+        float* cdf = m_weights.data() + ithr * m_candidates_count;
+        int32_t* ids = m_config.top_k ? m_ids.data() + ithr * m_candidates_count : nullptr;
+        auto* heap = m_config.top_k ? m_heap.data() + ithr * m_candidates_count : nullptr;
+
+        for (size_t b = start; b < end; b++) {
+            const float* row = logits + b * m_probs_count;
+            size_t count = m_probs_count;
+            if (m_config.top_k) {
+                count = selectTopK(row, cdf, ids, heap);
+            } else {
+                ov::Extensions::Cpu::XARCH::sampling_exp(row, cdf, m_config.inv_temperature, m_probs_count);
+            }
+            std::partial_sum(cdf, cdf + count, cdf);
+            const float total = std::max(cdf[count - 1], std::numeric_limits<float>::min());
+
+            const float* random = m_random_samples.data() + b * samples_count;
+            O* dst = output + b * samples_count;
+            auto store = [&](size_t pos) {
+                dst[0] = static_cast<O>(ids && m_config.topk_indices ? ids[pos] : pos);
+                dst++;
+            };
+            if (m_config.with_replacement) {
+                for (size_t s = 0; s < samples_count; s++) {
+                    const auto pos = std::lower_bound(cdf, cdf + count, random[s] * total) - cdf;
+                    store(std::min(static_cast<size_t>(pos), count - 1));
+                }
+            } else {
+                // normalized cdf adjusted after each sample drawn, as in Multinomial
+                for (size_t i = 0; i < count; i++)
+                    cdf[i] /= total;
+                for (size_t s = 0; s < samples_count; s++) {
+                    size_t selected = std::lower_bound(cdf, cdf + count, random[s]) - cdf;
+                    selected = std::min(selected, count - 1);
+                    store(selected);
+
+                    const float probability = selected ? cdf[selected] - cdf[selected - 1] : cdf[0];
+                    const float divisor = 1.f - probability;
+                    for (size_t i = 0; i < count; i++) {
+                        if (i >= selected)
+                            cdf[i] -= probability;
+                        cdf[i] /= divisor;
+                    }
+                }
+            }
+        }
+    });
+}
+
+void Sampling::execute(dnnl::stream strm) {
+    switch (m_config.output_type) {
+    case ov::element::i32:
+        return executeImpl<int32_t>();
+    case ov::element::i64:
+        return executeImpl<int64_t>();
+    default:
+        THROW_CPU_NODE_ERR("does not support output element type: ", m_config.output_type);
+    }
+}
+
+void Sampling::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class Sampling : public Node {
+public:
+    Sampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    bool created() const override;
+    bool isExecutable() const override;
+    bool needPrepareParams() const override;
+    void prepareParams() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename O>
+    void executeImpl();
+
+    // weights of the candidates of one row in descending order, returns the number of candidates left after top-p
+    size_t selectTopK(const float* logits, float* weights, int32_t* ids, std::pair<float, int32_t>* heap) const;
+
+    SamplingNode::Config m_config;
+
+    size_t m_batches_count = 0;
+    size_t m_probs_count = 0;
+    size_t m_candidates_count = 0;
+
+    // per thread scratch
+    std::vector<float> m_weights;
+    std::vector<int32_t> m_ids;
+    std::vector<std::pair<float, int32_t>> m_heap;
+    std::vector<float> m_random_samples;
+};
+
+}  // namespace node
+}  // namespace intel_cpu
+}  // namespace ov
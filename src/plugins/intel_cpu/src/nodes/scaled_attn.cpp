@@ -28,10 +28,12 @@
 #include "kernels/scaled_attn/mha_single_token.hpp"
 #include "kernels/scaled_attn/attn_memcpy.hpp"
 #include "kernels/scaled_attn/attn_quant.hpp"
+#include "kernels/scaled_attn/attn_rope.hpp"
 #include "kernels/x64/brgemm_kernel.hpp"
 #include "nodes/common/cpu_convert.h"
 
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -408,17 +410,7 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
         return dnnl_dims;
     }
 
-    void prepare_brgemm_prim(dnnl::stream strm, PlainTensor& query, PlainTensor& present_key, bool has_out_transpose) {
-        auto in_type = precision_of<T>::value;
-        auto qkv_dt = in_type == ov::element::f32 ? dt::f32 : dt::bf16;
-        auto B = query.size(0);
-        auto H = query.size(1);
-        auto q_len = query.size(2);
-        auto head_size = query.size(3);
-        auto kv_len = present_key.size(2);
-        auto Hk = present_key.size(1);
-        brgemmKey qk_key = {q_len, kv_len, head_size, query.stride(2), present_key.stride(2), kv_len, true, in_type};
-
+    std::shared_ptr<BrgemmKernel> get_brgemm(const brgemmKey& key) {
         auto builder = [](const brgemmKey& key) -> std::shared_ptr<BrgemmKernel> {
             return std::make_shared<BrgemmKernel>(key.M,
                                                   key.N,
@@ -431,12 +423,25 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
         };
 
         auto cache = this->context->getParamsCache();
-        auto qk_result = cache->getOrCreate(qk_key, builder);
-        if (!qk_result.first) {
+        return cache->getOrCreate(key, builder).first;
+    }
+
+    void prepare_brgemm_prim(dnnl::stream strm, PlainTensor& query, PlainTensor& present_key, bool has_out_transpose) {
+        auto in_type = precision_of<T>::value;
+        auto qkv_dt = in_type == ov::element::f32 ? dt::f32 : dt::bf16;
+        auto B = query.size(0);
+        auto H = query.size(1);
+        auto q_len = query.size(2);
+        auto head_size = query.size(3);
+        auto kv_len = present_key.size(2);
+        auto Hk = present_key.size(1);
+        brgemmKey qk_key = {q_len, kv_len, head_size, query.stride(2), present_key.stride(2), kv_len, true, in_type};
+
+        qk_gemm_ptr = get_brgemm(qk_key);
+        if (!qk_gemm_ptr) {
             OPENVINO_THROW("ScaledDotProductAttention 1st token qk gemm creation fails");
         }
 
-        qk_gemm_ptr = qk_result.first;
         dnnl::memory::desc attn_md(make_dnnl_dims({B, H, q_len, kv_len}), dt::f32, tag::abcd);
         weight_md = dnnl::memory::desc(make_dnnl_dims({B, H, q_len, kv_len}), qkv_dt, tag::abcd);
         if (has_out_transpose)
@@ -457,13 +462,11 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
                             false,
                             in_type};
 
-        auto wv_result = cache->getOrCreate(wv_key, builder);
-        if (!wv_result.first) {
+        wv_gemm_ptr = get_brgemm(wv_key);
+        if (!wv_gemm_ptr) {
             OPENVINO_THROW("ScaledDotProductAttention 1st token wv gemm creation fails");
         }
 
-        wv_gemm_ptr = wv_result.first;
-
         size_t nthr = static_cast<size_t>(parallel_get_max_threads());
 
         // wsp is used to compute beta when K is blocked
@@ -634,6 +637,217 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
         });
     }
 
+    // Blocked (flash) attention for long prompts: q x k is computed by [m_block, flash_kv_block] tiles which
+    // are folded into the output with the online softmax, so the [q_len, kv_len] scores are never materialized
+    // and the tiles stay in cache. The kv blocks above the causal diagonal are skipped.
+    static constexpr size_t flash_kv_block = 256;
+    static constexpr size_t flash_min_kv_len = 1024;
+    // gemms for the full and the tail kv block
+    std::shared_ptr<BrgemmKernel> flash_qk_gemm[2];
+    std::shared_ptr<BrgemmKernel> flash_wv_gemm[2];
+    PlainTensor flash_k_packed;  // [B, Hk, kv_blocks, packed block]
+    PlainTensor flash_v_packed;  // [B, Hk, kv_blocks, packed block], bf16 only
+    PlainTensor flash_scratch_a;
+    PlainTensor flash_score;     // f32[nthr, m_block, flash_kv_block]
+    PlainTensor flash_weight;    // T[nthr, m_block, flash_kv_block], bf16 only
+    PlainTensor flash_out;       // f32[nthr, m_block, S]
+    PlainTensor flash_acc;       // f32[nthr, m_block, S]
+    PlainTensor flash_stats;     // f32[nthr, 3, m_block]: running max, running sum, rescale factor
+
+    bool use_flash(const PlainTensor& present_key) const {
+        return present_key.size(2) >= flash_min_kv_len;
+    }
+
+    void prepare_flash_prim(PlainTensor& query, PlainTensor& present_key, PlainTensor& present_value) {
+        auto in_type = precision_of<T>::value;
+        auto B = query.size(0);
+        auto q_len = query.size(2);
+        auto head_size = query.size(3);
+        auto kv_len = present_key.size(2);
+        auto Hk = present_key.size(1);
+        auto kv_blocks = (kv_len + flash_kv_block - 1) / flash_kv_block;
+        size_t scratch_a_size = 0;
+        for (size_t i = 0; i < 2; i++) {
+            auto kv_cnt = i == 0 ? flash_kv_block : kv_len % flash_kv_block;
+            if (kv_cnt == 0) {
+                flash_qk_gemm[i] = nullptr;
+                flash_wv_gemm[i] = nullptr;
+                continue;
+            }
+            brgemmKey qk_key = {q_len, kv_cnt, head_size, query.stride(2), present_key.stride(2), flash_kv_block, true, in_type};
+            brgemmKey wv_key = {q_len, head_size, kv_cnt, flash_kv_block, present_value.stride(2), head_size, false, in_type};
+            flash_qk_gemm[i] = get_brgemm(qk_key);
+            flash_wv_gemm[i] = get_brgemm(wv_key);
+            if (!flash_qk_gemm[i] || !flash_wv_gemm[i]) {
+                OPENVINO_THROW("ScaledDotProductAttention 1st token flash attention gemm creation fails");
+            }
+            scratch_a_size = std::max(scratch_a_size, flash_qk_gemm[i]->get_scratch_a_size());
+            scratch_a_size = std::max(scratch_a_size, flash_wv_gemm[i]->get_scratch_a_size());
+        }
+
+        size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+        size_t m_block_size = flash_qk_gemm[0]->get_mblk_size();
+        wsp_size_per_thread = flash_wv_gemm[0]->get_wsp_size();
+        wsp.resize(nthr * wsp_size_per_thread);
+
+        // the full block needs the largest packed buffers, the tail block reuses the same layout
+        size_t data_size = sizeof(T);
+        flash_scratch_a.resize<T>({nthr, scratch_a_size / data_size});
+        flash_k_packed.resize<T>({B, Hk, kv_blocks, flash_qk_gemm[0]->get_scratch_b_size() / data_size});
+        if (in_type == ov::element::bf16) {
+            flash_v_packed.resize<T>({B, Hk, kv_blocks, flash_wv_gemm[0]->get_scratch_b_size() / data_size});
+            flash_weight.resize<T>({nthr, m_block_size, flash_kv_block});
+        }
+        flash_score.resize<float>({nthr, m_block_size, flash_kv_block});
+        flash_out.resize<float>({nthr, m_block_size, head_size});
+        flash_acc.resize<float>({nthr, m_block_size, head_size});
+        flash_stats.resize<float>({nthr, 3, m_block_size});
+    }
+
+    void execute_flash(PlainTensor& query,
+                       PlainTensor& present_key,
+                       PlainTensor& present_value,
+                       const PlainTensor& alibi_mask,
+                       const PlainTensor& attention_mask,
+                       PlainTensor& output_emb,
+                       bool has_out_transpose,
+                       bool auto_causal,
+                       float d_scale,
+                       size_t sliding_window) {
+        const auto B = query.size(0);
+        const auto H = query.size(1);
+        const auto q_len = query.size(2);
+        const auto head_size = query.size(3);
+        const auto Hk = present_key.size(1);
+        const auto kv_len = present_key.size(2);
+        size_t h_each_group_len = H / Hk;
+        const size_t kv_blocks = (kv_len + flash_kv_block - 1) / flash_kv_block;
+        const size_t m_block_size = flash_qk_gemm[0]->get_mblk_size();
+        auto m_blocks = (q_len + m_block_size - 1) / m_block_size;
+        bool is_bf16 = precision_of<T>::value == ov::element::bf16;
+        // packed k, v
+        parallel_for3d(B, Hk, kv_blocks, [&](size_t b, size_t h, size_t kv_blk) {
+            auto kv_start = kv_blk * flash_kv_block;
+            auto gemm_idx = kv_start + flash_kv_block > kv_len ? 1 : 0;
+            flash_qk_gemm[gemm_idx]->copy_buffer_b(&present_key.at<T>({b, h, kv_start, 0}),
+                                                   &flash_k_packed.at<T>({b, h, kv_blk, 0}));
+            if (is_bf16)
+                flash_wv_gemm[gemm_idx]->copy_buffer_b(&present_value.at<T>({b, h, kv_start, 0}),
+                                                       &flash_v_packed.at<T>({b, h, kv_blk, 0}));
+        });
+
+        // visible kv range [lo, hi) of the query row m
+        auto visible_range = [&](size_t m, size_t& lo, size_t& hi) {
+            hi = auto_causal ? (kv_len - q_len + m + 1) : kv_len;
+            lo = (sliding_window && hi > sliding_window) ? hi - sliding_window : 0;
+        };
+
+        // attention
+        parallel_for3d(B, H, m_blocks, [&](size_t b, size_t h, size_t m_blk) {
+            auto m_start = m_blk * m_block_size;
+            auto m_end = std::min(m_start + m_block_size, q_len);
+            auto m_cnt = m_end - m_start;
+            size_t tid = parallel_get_thread_num();
+            auto hk = h / h_each_group_len;
+            T* q_ptr = &query.at<T>({b, h, m_start, 0});
+            float* score = &flash_score.at<float>({tid, 0, 0});
+            // f32 weights are computed in place
+            T* weight = is_bf16 ? &flash_weight.at<T>({tid, 0, 0}) : reinterpret_cast<T*>(score);
+            float* out = &flash_out.at<float>({tid, 0, 0});
+            float* acc = &flash_acc.at<float>({tid, 0, 0});
+            float* row_max = &flash_stats.at<float>({tid, 0, 0});
+            float* row_sum = &flash_stats.at<float>({tid, 1, 0});
+            float* row_rescale = &flash_stats.at<float>({tid, 2, 0});
+            void* wsp_ptr = wsp.data() + tid * wsp_size_per_thread;
+            T* scratch_a = flash_scratch_a ? &flash_scratch_a.at<T>({tid, 0}) : nullptr;
+            std::fill(acc, acc + m_cnt * head_size, 0.0f);
+            std::fill(row_max, row_max + m_cnt, std::numeric_limits<float>::lowest());
+            std::fill(row_sum, row_sum + m_cnt, 0.0f);
+
+            float* alibi_ptr = nullptr;
+            auto alibi_stride = 0;
+            if (alibi_mask) {
+                alibi_ptr = &alibi_mask.at<float>({b, h, 0, 0}, true);
+                if (alibi_mask.size(2) > 1)
+                    alibi_stride = alibi_mask.stride(2);
+            }
+            uint8_t* attn_mask_ptr = nullptr;
+            auto attn_mask_stride = 0;
+            if (attention_mask) {
+                attn_mask_ptr = reinterpret_cast<uint8_t*>(&attention_mask.at<T>({b, h, 0, 0}, true));
+                if (attention_mask.size(2) > 1)
+                    attn_mask_stride = attention_mask.stride(2) * sizeof(T);
+            }
+            uint8_t* cmask_ptr = nullptr;
+            auto cmask_stride = 0;
+            if (causal_mask) {
+                cmask_ptr = &causal_mask.at<uint8_t>({b, h, 0, 0}, true);
+                if (causal_mask.size(2) > 1)
+                    cmask_stride = causal_mask.stride(2);
+            }
+
+            // the rows of the block see the kv range [kv_lo, kv_hi), the blocks outside of it are skipped
+            size_t kv_lo, kv_hi, unused;
+            visible_range(m_start, kv_lo, unused);
+            visible_range(m_end - 1, unused, kv_hi);
+            for (size_t kv_blk = kv_lo / flash_kv_block; kv_blk * flash_kv_block < kv_hi; kv_blk++) {
+                auto kv_start = kv_blk * flash_kv_block;
+                size_t kv_cnt = kv_len - kv_start < flash_kv_block ? kv_len - kv_start : flash_kv_block;
+                auto gemm_idx = kv_cnt < flash_kv_block ? 1 : 0;
+                flash_qk_gemm[gemm_idx]->executeGemm(m_cnt < m_block_size,
+                                                     q_ptr,
+                                                     &flash_k_packed.at<T>({b, hk, kv_blk, 0}),
+                                                     score,
+                                                     wsp_ptr,
+                                                     scratch_a);
+                for (size_t m = m_start; m < m_end; m++) {
+                    auto i = m - m_start;
+                    T* w = weight + i * flash_kv_block;
+                    size_t lo, hi;
+                    visible_range(m, lo, hi);
+                    // part of the block visible to the row
+                    size_t blk_lo = lo > kv_start ? std::min(lo - kv_start, kv_cnt) : 0;
+                    size_t blk_hi = hi > kv_start ? std::min(hi - kv_start, kv_cnt) : 0;
+                    if (blk_lo >= blk_hi) {
+                        memset(w, 0, sizeof(T) * kv_cnt);
+                        row_rescale[i] = 1.0f;
+                        continue;
+                    }
+                    memset(w, 0, sizeof(T) * blk_lo);
+                    auto kv_pos = kv_start + blk_lo;
+                    float* alibi = alibi_ptr ? alibi_ptr + m * alibi_stride + kv_pos : nullptr;
+                    uint8_t* attn_mask = attn_mask_ptr ? attn_mask_ptr + m * attn_mask_stride + kv_pos * sizeof(T) : nullptr;
+                    uint8_t* cmask = cmask_ptr ? cmask_ptr + m * cmask_stride + kv_pos : nullptr;
+                    row_rescale[i] = attn_softmax_online(score + i * flash_kv_block + blk_lo,
+                                                         w + blk_lo,
+                                                         d_scale,
+                                                         alibi,
+                                                         attn_mask,
+                                                         cmask,
+                                                         select_nfltmax_at_0,
+                                                         blk_hi - blk_lo,
+                                                         kv_cnt - blk_lo,
+                                                         row_max[i],
+                                                         row_sum[i],
+                                                         precision_of<T>::value,
+                                                         precision_of<T>::value);
+                }
+                T* v_ptr = is_bf16 ? &flash_v_packed.at<T>({b, hk, kv_blk, 0})
+                                   : &present_value.at<T>({b, hk, kv_start, 0});
+                flash_wv_gemm[gemm_idx]->executeGemm(m_cnt < m_block_size, weight, v_ptr, out, wsp_ptr, scratch_a);
+                for (size_t i = 0; i < m_cnt; i++) {
+                    attn_acc_rescale(acc + i * head_size, out + i * head_size, row_rescale[i], head_size);
+                }
+            }
+
+            for (size_t m = m_start; m < m_end; m++) {
+                auto i = m - m_start;
+                T* dst = has_out_transpose ? &output_emb.at<T>({b, m, h * head_size}) : &output_emb.at<T>({b, h, m, 0});
+                attn_scale_store(acc + i * head_size, dst, 1.0f / row_sum[i], head_size, precision_of<T>::value);
+            }
+        });
+    }
+
     PlainTensor causal_mask;
     bool select_nfltmax_at_0 = false;  // set attn_score to -FLT_MAX when causal_mask[...] equal to this
     void set_causal_mask(PlainTensor mask, bool _select_nfltmax_at_0) {
@@ -663,6 +877,20 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
         if (d_scale == 0.0f)
             d_scale = 1.0f / sqrt(head_size);
 
+        if (use_flash(present_key)) {
+            prepare_flash_prim(query, present_key, present_value);
+            execute_flash(query,
+                          present_key,
+                          present_value,
+                          alibi_mask,
+                          attention_mask,
+                          output_emb,
+                          has_out_transpose,
+                          auto_causal,
+                          d_scale,
+                          sliding_window);
+            return;
+        }
         prepare_brgemm_prim(strm, query, present_key, has_out_transpose);
         execute_brgemm(query,
                        present_key,
@@ -876,6 +1104,7 @@ struct MHASingleToken {
     // alibi
     // attention_mask [B, 1, q_len, kv_len]
     // output_emb    [B, L1, H, S]
+    // subsequence_lens [B], paged attention only: number of valid new tokens of each sequence
     void operator()(PlainTensor& query,
                     PlainTensor& present_key,
                     PlainTensor& present_value,
@@ -885,6 +1114,7 @@ struct MHASingleToken {
                     const PlainTensor& beams,
                     size_t max_context_len,
                     const PlainTensor& context_lens,
+                    const PlainTensor& subsequence_lens,
                     bool has_out_transpose,
                     bool auto_causal,
                     float d_scale,
@@ -966,7 +1196,7 @@ struct MHASingleToken {
             m_attn_w.resize<float>({B, H, q_len, kv_len});
         }
         mha_single_token(query, fastpath_valid ? PlainTensor() : present_key, present_value, alibi_mask, attention_mask, beams, max_context_len,
-            context_lens, output_emb, m_attn_w, m_temp, has_out_transpose, auto_causal, d_scale, k_scale_zp, v_scale_zp, m_head_sum);
+            context_lens, subsequence_lens, output_emb, m_attn_w, m_temp, has_out_transpose, auto_causal, d_scale, k_scale_zp, v_scale_zp, m_head_sum);
     }
 };
 
@@ -974,6 +1204,7 @@ template <ScaledDotProductAttention::KernelTypes KType, typename T>
 struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAttention::Executor {
     GraphContext::CPtr context;
     PlainTensor attn_buf;          // f32[[B|1],[H|1], L1|1, L0+L1]
+    PlainTensor subsequence_lens;  // i32[B], paged attention with mixed query lengths
 
     MHAKernel<KType, T> kernel;
     MHASingleToken kernel_single_token;
@@ -1043,6 +1274,25 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             if (!is_prompt) {
                 context_lens.assert_dims({B});
                 beam_table.assert_dims({B, 0}, true);
+                if (L1 > 1) {
+                    // continuous batching: prompts (or prompt chunks) and single decode tokens of different
+                    //  sequences share one step, each sequence is right padded to L1 and its padding is marked
+                    //  by negative slots. The new tokens are already in the cache and attend causally.
+                    PlainTensor slot_mapping;
+                    slot_mapping.reset(inputs[ID_SLOT_MAPPING]);
+                    slot_mapping.assert_dims({B, L1});
+                    subsequence_lens.resize<int32_t>({B});
+                    for (size_t b = 0; b < B; b++) {
+                        auto* slots = slot_mapping.ptr<int32_t>(b);
+                        int32_t q_len = 0;
+                        while (static_cast<size_t>(q_len) < L1 && slots[q_len] >= 0)
+                            q_len++;
+                        OPENVINO_ASSERT(q_len <= context_lens.ptr<int32_t>()[b],
+                                        "PagedAttention sequence ", b, " has ", q_len, " new tokens but context length ",
+                                        context_lens.ptr<int32_t>()[b]);
+                        subsequence_lens.ptr<int32_t>()[b] = q_len;
+                    }
+                }
             } else {
                 sliding_window = static_cast<size_t>(*inputs[ID_SLIDING_WINDOW]->getDataAs<int32_t>());
             }
@@ -1081,10 +1331,12 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             L1 = q_input.size(2);
             S = q_input.size(3);
             L0 = present_key.size(2) - L1;
-            auto Hk = k_input.size(1);
+            auto Hk = present_key.size(1);
 
             if (fuse_concat) {
-                k_input.assert_dims({B, Hk, L1, S});
+                // with fused RoPE k_input may still be the source of RoPE, only the cache is used then
+                if (!config.config.fuse_rope)
+                    k_input.assert_dims({B, Hk, L1, S});
                 v_input.assert_dims({B, Hk, L1, S});
             } else {
                 k_input.assert_dims({B, Hk, L0 + L1, S});
@@ -1142,7 +1394,8 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             //  2, using float will save the repack cost which typically is required for bf16/int8 opt
             //  3, using dot product can leverage the SIMD while easily adapt to indirect kv cache
             kernel_single_token(q_input, present_key, present_value, {}, use_attn_mask ? attn_mask : PlainTensor(),
-                output_emb, beam_table, max_context_len, context_lens, has_out_transpose, auto_causal, scale_input, k_scale_zp, v_scale_zp);
+                output_emb, beam_table, max_context_len, context_lens, (is_pagedattn && L1 > 1) ? subsequence_lens : PlainTensor(),
+                has_out_transpose, auto_causal, scale_input, k_scale_zp, v_scale_zp);
         }
     }
 };
@@ -1173,7 +1426,9 @@ void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
     auto rtPrecision = getRuntimePrecision();
-    auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0);
+    auto ropeInputNumber = m_config.config.rope_input_number();
+    auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0) - ropeInputNumber;
+    auto beamIdxPort = orginSDPInputNumber + ropeInputNumber;
 
     NodeConfig config;
     auto& creatorsMap = BlockedDescCreator::getCommonCreators();
@@ -1235,25 +1490,38 @@ void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
                 ov::element::f32, getInputShapeAtPort(nextPortIdx)));
         }
 
+        if (m_config.config.fuse_rope) {
+            // cos, sin
+            config.inConfs[orginSDPInputNumber + 0].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
+                ov::element::f32, getInputShapeAtPort(orginSDPInputNumber + 0)));
+            config.inConfs[orginSDPInputNumber + 1].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
+                ov::element::f32, getInputShapeAtPort(orginSDPInputNumber + 1)));
+            if (m_config.config.rope_gather_position) {
+                // position_ids
+                config.inConfs[orginSDPInputNumber + 2].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
+                    ov::element::i32, getInputShapeAtPort(orginSDPInputNumber + 2)));
+            }
+        }
+
         if (m_config.config.fuse_concat) {
             // beam_idx
-            config.inConfs[orginSDPInputNumber + 0].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
-                ov::element::i32, getInputShapeAtPort(orginSDPInputNumber + 0)));
+            config.inConfs[beamIdxPort + 0].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
+                ov::element::i32, getInputShapeAtPort(beamIdxPort + 0)));
 
             // Since the InputMemory nodes are simple proxy for the state memory as well as the init subgraph memory,
             // it doesn't make sense to set the real KV cache precision, since we don't need any precision conversions
             // provided by the common graph logic. We set precisions equal to the precisions of the state nodes to avoid
             // reorder insertion in between MemoryInputSDPA and SDPA nodes.
 
-            auto past_k_input_mem_precision = getParentEdgeAt(orginSDPInputNumber + 1)->getParent()->getOriginalOutputPrecisionAtPort(0);
+            auto past_k_input_mem_precision = getParentEdgeAt(beamIdxPort + 1)->getParent()->getOriginalOutputPrecisionAtPort(0);
             // pastk
-            config.inConfs[orginSDPInputNumber + 1].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
-                past_k_input_mem_precision, getInputShapeAtPort(orginSDPInputNumber + 1)));
+            config.inConfs[beamIdxPort + 1].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
+                past_k_input_mem_precision, getInputShapeAtPort(beamIdxPort + 1)));
 
-            auto past_v_input_mem_precision = getParentEdgeAt(orginSDPInputNumber + 2)->getParent()->getOriginalOutputPrecisionAtPort(0);
+            auto past_v_input_mem_precision = getParentEdgeAt(beamIdxPort + 2)->getParent()->getOriginalOutputPrecisionAtPort(0);
             // pastv
-            config.inConfs[orginSDPInputNumber + 2].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
-                past_v_input_mem_precision, getInputShapeAtPort(orginSDPInputNumber + 2)));
+            config.inConfs[beamIdxPort + 2].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
+                past_v_input_mem_precision, getInputShapeAtPort(beamIdxPort + 2)));
 
             config.outConfs[1].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(
                 past_k_input_mem_precision, getOutputShapeAtPort(1)));
@@ -1311,7 +1579,8 @@ void ScaledDotProductAttention::createPrimitive() {
 }
 
 void ScaledDotProductAttention::execute(dnnl::stream strm) {
-    auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0);
+    auto ropeInputNumber = m_config.config.rope_input_number();
+    auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0) - ropeInputNumber;
     std::vector<MemoryPtr> inputs(orginSDPInputNumber);
     auto output = getDstMemoryAtPort(0);
     MemoryPtr presentk_input, presentv_input, beam_input;
@@ -1328,8 +1597,16 @@ void ScaledDotProductAttention::execute(dnnl::stream strm) {
     } else {
         if (m_config.config.fuse_concat) {
             CPU_NODE_ASSERT(m_k_state && m_v_state, "has null input states");
+            PlainTensor cur_k(inputs[1]);
+            PlainTensor cur_v(inputs[2]);
+            if (!m_config.config.permute_axes.empty()) {
+                cur_k = cur_k.permute(m_config.config.permute_axes);
+                cur_v = cur_v.permute(m_config.config.permute_axes);
+            }
+            if (m_config.config.fuse_rope)
+                prepareRoPE(inputs, cur_k);
             // initialization will be also completed in this func
-            gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
+            gatherConcatPastkv(cur_k, cur_v, getSrcMemoryAtPort(orginSDPInputNumber + ropeInputNumber));
 
             presentk_input = m_k_state->internal_state_mem();
             presentv_input = m_v_state->internal_state_mem();
@@ -1366,6 +1643,7 @@ bool ScaledDotProductAttention::isSupportedOperation(const std::shared_ptr<const
             if (node->get_config().fuse_concat) {
                 orgSDPAInput -= 3;
             }
+            orgSDPAInput -= static_cast<int>(node->get_config().rope_input_number());
         }
         if (orgSDPAInput > 3) {
             inRank = op->get_input_partial_shape(3).size();
@@ -1397,7 +1675,7 @@ void ScaledDotProductAttention::assignState(const std::shared_ptr<VariableStateK
     }
 }
 
-void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx) {
+void ScaledDotProductAttention::resetBeamTablePastkv(const PlainTensor& cur_k, const PlainTensor& cur_v, const MemoryPtr& mem_beam_idx) {
     std::vector<size_t> order = {0, 1, 2, 3};
     if (!m_config.config.permute_axes.empty()) {
         order = m_config.config.permute_axes;
@@ -1412,12 +1690,6 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
     auto B_state = v_dims.at(order[0]);
     old_beam_table_k.reset(old_hidden_state_k);
 
-    PlainTensor cur_k;
-    PlainTensor cur_v;
-    cur_k.reset(mem_cur_k);
-    cur_v.reset(mem_cur_v);
-    cur_k = cur_k.permute(order);
-    cur_v = cur_v.permute(order);
     auto B = cur_k.size(0);
     auto H = cur_k.size(1);
     auto L1 = cur_k.size(2);
@@ -1503,13 +1775,7 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             mem_desc->getStrides());
         new_internal_mem_k->redefineDesc(mem_desc);
         new_internal_mem_v->redefineDesc(mem_desc);
-        if (kvcache_precision == ov::element::u8) {
-            attn_quantkv(cur_k, cur_v,
-                new_pastk.slice(2, L0, L0 + L1), new_pastv.slice(2, L0, L0 + L1),
-                m_k_state->get_scale_zp().slice(2, L0, L0 + L1), m_v_state->get_scale_zp().slice(2, L0, L0 + L1));
-        } else {
-            attn_memcpy(cur_k, cur_v, new_pastk.slice(2, L0, L0 + L1), new_pastv.slice(2, L0, L0 + L1));
-        }
+        appendPastkv(cur_k, cur_v, new_pastk, new_pastv, L0);
 
         m_k_state->assign_internal_state(new_internal_mem_k);
         m_v_state->assign_internal_state(new_internal_mem_v);
@@ -1576,14 +1842,11 @@ void ScaledDotProductAttention::gatherConcatPastkvForPagedAttn(const std::vector
     // TODO: add u8 kvcache support
 }
 
-void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx) {
-    PlainTensor cur_k;
-    cur_k.reset(mem_cur_k);
+void ScaledDotProductAttention::gatherConcatPastkv(const PlainTensor& cur_k, const PlainTensor& cur_v, const MemoryPtr& mem_beam_idx) {
     auto inputNumber = getOriginalInputsNumber();
     auto&& v_dims = getParentEdgeAt(inputNumber - 1)->getMemory().getStaticDims();
     size_t B_state;
     if (!m_config.config.permute_axes.empty()) {
-        cur_k = cur_k.permute(m_config.config.permute_axes);
         B_state = v_dims.at(m_config.config.permute_axes[0]);
     } else {
         B_state = v_dims.at(0);
@@ -1592,12 +1855,12 @@ void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k, c
     auto B = cur_k.size(0);
     auto L1 = cur_k.size(2);
     if (B != B_state) {
-        resetBeamTablePastkv(mem_cur_k, mem_cur_v, mem_beam_idx);
+        resetBeamTablePastkv(cur_k, cur_v, mem_beam_idx);
         return;
     }
 
     updateBeamTable(mem_beam_idx, L1);
-    updatePastkv(mem_cur_k, mem_cur_v);
+    updatePastkv(cur_k, cur_v);
 }
 
 // Update beam table using beam_idx. For first token, beam table is like [[0, 0, 0, ...], [1, 1, 1, ...], ...],
@@ -1731,17 +1994,12 @@ void ScaledDotProductAttention::updateBeamTable(const MemoryPtr& mem_beam_idx, s
 }
 
 // Update pastkv using cur_k, cur_v, simply append cur_k, cur_v to the end of pastkv in the state.
-void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v) {
+void ScaledDotProductAttention::updatePastkv(const PlainTensor& cur_k, const PlainTensor& cur_v) {
     std::vector<size_t> order = {0, 1, 2, 3};
     if (!m_config.config.permute_axes.empty()) {
         order = m_config.config.permute_axes;
     }
-    PlainTensor cur_k, past_k;
-    PlainTensor cur_v, past_v;
-    cur_k.reset(mem_cur_k);
-    cur_v.reset(mem_cur_v);
-    cur_k = cur_k.permute(order);
-    cur_v = cur_v.permute(order);
+    PlainTensor past_k, past_v;
     auto B = cur_k.size(0);
     auto H = cur_k.size(1);
     auto L1 = cur_k.size(2);
@@ -1886,15 +2144,82 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
         }
     }
 
-    if (kvcache_precision == ov::element::u8) {
-        attn_quantkv(cur_k, cur_v,
-            past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1),
-            m_k_state->get_scale_zp().slice(2, L0, L0 + L1), m_v_state->get_scale_zp().slice(2, L0, L0 + L1));
+    appendPastkv(cur_k, cur_v, past_k, past_v, L0);
+}
+
+// Write cur_k, cur_v to [L0, L0 + L1) of pastkv, when RoPE is fused k is rotated on the fly.
+void ScaledDotProductAttention::appendPastkv(const PlainTensor& cur_k,
+                                             const PlainTensor& cur_v,
+                                             const PlainTensor& past_k,
+                                             const PlainTensor& past_v,
+                                             size_t L0) {
+    auto L1 = cur_k.size(2);
+    PlainTensor k_scale_zp, v_scale_zp;
+    if (past_k.get_precision() == ov::element::u8) {
+        k_scale_zp = m_k_state->get_scale_zp().slice(2, L0, L0 + L1);
+        v_scale_zp = m_v_state->get_scale_zp().slice(2, L0, L0 + L1);
+    }
+    if (m_config.config.fuse_rope && m_rope_k_in_cache) {
+        attn_rope_concat(cur_k, cur_v, m_rope_cos, m_rope_sin, m_rope_position, m_config.config.rope_rotary_ndims,
+            past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1), k_scale_zp, v_scale_zp);
+    } else if (past_k.get_precision() == ov::element::u8) {
+        attn_quantkv(cur_k, cur_v, past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1), k_scale_zp, v_scale_zp);
     } else {
         attn_memcpy(cur_k, cur_v, past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1));
     }
 }
 
+// Rotate q into m_rope_q and prepare the [B, H, L1, S] view of k for the cache append. The multi-token
+// kernel reads the current k directly, in that case k is rotated into m_rope_k in advance.
+void ScaledDotProductAttention::prepareRoPE(std::vector<MemoryPtr>& inputs, PlainTensor& cur_k) {
+    const auto& config = m_config.config;
+    auto ropePort = getOriginalInputsNumber() - 3 - config.rope_input_number();
+    m_rope_cos.reset(getSrcMemoryAtPort(ropePort));
+    m_rope_sin.reset(getSrcMemoryAtPort(ropePort + 1));
+    if (m_rope_cos.m_rank == 2) {
+        m_rope_cos = m_rope_cos.reshape({1, 1, m_rope_cos.size(0), m_rope_cos.size(1)});
+    }
+    if (m_rope_sin.m_rank == 2) {
+        m_rope_sin = m_rope_sin.reshape({1, 1, m_rope_sin.size(0), m_rope_sin.size(1)});
+    }
+    m_rope_position = PlainTensor();
+    if (config.rope_gather_position) {
+        m_rope_position.reset(getSrcMemoryAtPort(ropePort + 2));
+    }
+
+    auto source_view = [&](const MemoryPtr& mem, const std::vector<size_t>& slice) {
+        PlainTensor t(mem);
+        if (!slice.empty()) {
+            t = t.slice(3, slice[0], slice[1]);
+        }
+        if (config.rope_input_trans0213) {
+            t = t.permute({0, 2, 1, 3});
+        }
+        return t;
+    };
+    auto rotate = [&](const PlainTensor& src, MemoryPtr& dst) {
+        auto desc = std::make_shared<CpuBlockedMemoryDesc>(getRuntimePrecision(), Shape(src.shape()));
+        if (!dst) {
+            dst = std::make_shared<Memory>(getEngine(), desc);
+        } else {
+            dst->redefineDesc(desc);
+        }
+        attn_rope(src, m_rope_cos, m_rope_sin, m_rope_position, config.rope_rotary_ndims, PlainTensor(dst));
+    };
+
+    rotate(source_view(inputs[0], config.rope_slice_q), m_rope_q);
+    inputs[0] = m_rope_q;
+
+    cur_k = source_view(inputs[1], config.rope_slice_k);
+    auto L0 = getParentEdgeAt(getOriginalInputsNumber() - 1)->getMemory().getStaticDims()[2];
+    m_rope_k_in_cache = cur_k.size(2) == 1 || L0 > 0;
+    if (!m_rope_k_in_cache) {
+        rotate(cur_k, m_rope_k);
+        inputs[1] = m_rope_k;
+        cur_k.reset(m_rope_k);
+    }
+}
+
 ov::element::Type ScaledDotProductAttention::getKVCachePrecision() {
     ov::element::Type kvcache_precision;
     auto rtPrecision = getRuntimePrecision();
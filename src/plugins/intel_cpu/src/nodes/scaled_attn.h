@@ -47,12 +47,15 @@ public:
     ov::element::Type getKVCachePrecision();
 
 private:
-    void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
+    // cur_k, cur_v: [B, H, L1, S] views of the current k/v
+    void gatherConcatPastkv(const PlainTensor& cur_k, const PlainTensor& cur_v, const MemoryPtr& mem_beam_idx);
     void gatherConcatPastkvForPagedAttn(const std::vector<MemoryPtr>& inputs);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t new_q_len);
-    void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
+    void updatePastkv(const PlainTensor& cur_k, const PlainTensor& cur_v);
+    void appendPastkv(const PlainTensor& cur_k, const PlainTensor& cur_v, const PlainTensor& past_k, const PlainTensor& past_v, size_t L0);
     ov::element::Type getRuntimePrecision() const override;
-    void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
+    void resetBeamTablePastkv(const PlainTensor& cur_k, const PlainTensor& cur_v, const MemoryPtr& mem_beam_idx);
+    void prepareRoPE(std::vector<MemoryPtr>& inputs, PlainTensor& cur_k);
 
     struct Config {
         ScaledDotProductAttentionWithKVCache::Config config;
@@ -74,6 +77,15 @@ private:
     std::shared_ptr<VariableStateKVcache> m_k_state;
     std::shared_ptr<VariableStateKVcache> m_v_state;
 
+    // fused RoPE: q is rotated into m_rope_q, k is rotated while it's appended to the cache unless the
+    // multi-token kernel needs it as an input, then it's rotated into m_rope_k first
+    MemoryPtr m_rope_q;
+    MemoryPtr m_rope_k;
+    PlainTensor m_rope_cos;
+    PlainTensor m_rope_sin;
+    PlainTensor m_rope_position;
+    bool m_rope_k_in_cache = false;
+
     // PagedAttention input index
     static const size_t ID_Q = 0;
     static const size_t ID_K = 1;
@@ -14,7 +14,10 @@
 #include "selective_build.h"
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using namespace dnnl;
@@ -386,8 +389,180 @@ private:
                 OV_CASE(ScatterUpdate::Reduction::MEAN, DT_MEAN));
     }
 };
+
+// The reduction is split along the axis when the rest of the shape is too narrow to give every thread a cache line
+// of its own, e.g. a segment sum of many rows into a few columns.
+constexpr size_t byAxisMinColumnsPerThread = 16lu;
+constexpr size_t byAxisMinUpdatesPerThread = 4096lu;
+
+struct UpdateEntry {
+    uint32_t column;
+    uint32_t idx;
+};
 };   // namespace scatter_elements_update
 
+// Two strategies are used depending on the collision rate of the indices:
+// - many updates per destination: every thread reduces its range of the axis into a private copy of the destination,
+//   then the copies are merged in parallel over the destination;
+// - few updates per destination: the updates are counting-sorted by the thread owning the destination row, and every
+//   thread applies its bucket. The buckets keep the order along the axis, so the result matches the serial one.
+template <typename DataType, typename KernelType>
+bool ScatterUpdate::scatterElementsReduceByAxis(const MemoryPtr& mem_data, const MemoryPtr& mem_indices,
+                                                const MemoryPtr& mem_updates, int axis, const KernelType& kernel) {
+    using namespace scatter_elements_update;
+    constexpr bool isMean = std::is_same<KernelType, ReduceMean>::value;
+
+    const auto& data_shape = mem_data->getStaticDims();
+    const auto& indices_shape = mem_indices->getStaticDims();
+    if (axis < 0)
+        axis += indices_shape.size();
+
+    VectorDims squashed_indices_shape(indices_shape);
+    squashed_indices_shape[axis] = 1;
+    const size_t columns = shape_size(squashed_indices_shape);
+    const size_t index_dim_size = indices_shape[axis];
+    const size_t updates_size = columns * index_dim_size;
+    const int nthr = parallel_get_max_threads();
+    if (nthr == 1 || columns >= nthr * byAxisMinColumnsPerThread || index_dim_size < static_cast<size_t>(nthr) ||
+        updates_size < nthr * byAxisMinUpdatesPerThread || columns > std::numeric_limits<uint32_t>::max() ||
+        index_dim_size > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    DataType *dataPtr = mem_data->getDataAs<DataType>();
+    DataType *updatePtr = mem_updates->getDataAs<DataType>();
+    uint8_t *indicesPtr = mem_indices->getDataAs<uint8_t>();
+    const int64_t data_dim_size = static_cast<int64_t>(data_shape[axis]);
+    const std::vector<size_t> dataBlockND = getBlockND(data_shape);
+    const std::vector<size_t> indicesBlockND = getBlockND(indices_shape);
+    const size_t dataBlock_axisplus1 = dataBlockND[axis + 1];
+    const size_t indicesBlock_axisplus1 = indicesBlockND[axis + 1];
+    const auto neutral = reduction_neutral_value<DataType>(reduction_type);
+
+    // offsets of every column at idx = 0
+    std::vector<size_t> dst_offsets(columns), indices_offsets(columns);
+    TensorIterator tensorItr(squashed_indices_shape, axis);
+    auto offsets = tensorItr.startover(0, dataBlockND, indicesBlockND);
+    for (size_t c = 0; c < columns; c++) {
+        dst_offsets[c] = offsets[0];
+        indices_offsets[c] = offsets[1];
+        tensorItr.increment(offsets, dataBlockND, indicesBlockND);
+    }
+    auto getIdxValue = [&](size_t indices_offset) {
+        int64_t idxValue = getIndicesValue(indicesPtr, indices_offset);
+        if (idxValue < 0) idxValue += data_dim_size;
+        assert(idxValue < data_dim_size && idxValue >= 0);
+        return static_cast<size_t>(idxValue);
+    };
+
+    const size_t dst_size = data_dim_size * columns;
+    if (dst_size * nthr <= updates_size) {
+        std::vector<DataType> partial(dst_size * nthr);
+        std::vector<int32_t> counters(dst_size * nthr);
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            DataType* thrPartial = partial.data() + ithr * dst_size;
+            int32_t* thrCounters = counters.data() + ithr * dst_size;
+            std::fill(thrPartial, thrPartial + dst_size, neutral);
+            std::fill(thrCounters, thrCounters + dst_size, 0);
+
+            size_t start = 0, end = 0;
+            splitter(index_dim_size, nthr, ithr, start, end);
+            for (size_t idx = start; idx < end; idx++) {
+                for (size_t c = 0; c < columns; c++) {
+                    const auto indices_offset = indices_offsets[c] + idx * indicesBlock_axisplus1;
+                    const auto dst = getIdxValue(indices_offset) * columns + c;
+                    kernel(&thrPartial[dst], &updatePtr[indices_offset]);
+                    thrCounters[dst]++;
+                }
+            }
+        });
+        parallel_for(dst_size, [&](size_t i) {
+            int64_t N = 0;
+            for (int t = 0; t < nthr; t++)
+                N += counters[t * dst_size + i];
+            if (N == 0)
+                return;
+            auto& dst = dataPtr[dst_offsets[i % columns] + (i / columns) * dataBlock_axisplus1];
+            DataType value = use_init_val ? dst : neutral;
+            for (int t = 0; t < nthr; t++) {
+                if (counters[t * dst_size + i])
+                    kernel(&value, &partial[t * dst_size + i]);
+            }
+            if (isMean)
+                value = static_cast<DataType>(static_cast<double>(value) / (N + static_cast<int32_t>(use_init_val)));
+            dst = value;
+        });
+        return true;
+    }
+
+    // bucket [owner][ithr] holds the updates of the axis range of ithr which hit the rows of owner
+    const size_t rows_per_owner = div_up(static_cast<size_t>(data_dim_size), static_cast<size_t>(nthr));
+    std::vector<size_t> buckets(nthr * nthr + 1, 0);
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        std::vector<size_t> thrCounts(nthr, 0);
+        size_t start = 0, end = 0;
+        splitter(index_dim_size, nthr, ithr, start, end);
+        for (size_t idx = start; idx < end; idx++) {
+            for (size_t c = 0; c < columns; c++)
+                thrCounts[getIdxValue(indices_offsets[c] + idx * indicesBlock_axisplus1) / rows_per_owner]++;
+        }
+        for (int owner = 0; owner < nthr; owner++)
+            buckets[owner * nthr + ithr + 1] = thrCounts[owner];
+    });
+    std::partial_sum(buckets.begin(), buckets.end(), buckets.begin());
+
+    std::vector<UpdateEntry> entries(updates_size);
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        std::vector<size_t> pos(nthr);
+        for (int owner = 0; owner < nthr; owner++)
+            pos[owner] = buckets[owner * nthr + ithr];
+        size_t start = 0, end = 0;
+        splitter(index_dim_size, nthr, ithr, start, end);
+        for (size_t idx = start; idx < end; idx++) {
+            for (size_t c = 0; c < columns; c++) {
+                const auto owner = getIdxValue(indices_offsets[c] + idx * indicesBlock_axisplus1) / rows_per_owner;
+                entries[pos[owner]++] = {static_cast<uint32_t>(c), static_cast<uint32_t>(idx)};
+            }
+        }
+    });
+
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        const UpdateEntry* first = entries.data() + buckets[ithr * nthr];
+        const UpdateEntry* last = entries.data() + buckets[(ithr + 1) * nthr];
+        auto dstAt = [&](const UpdateEntry& e, size_t& indices_offset) {
+            indices_offset = indices_offsets[e.column] + e.idx * indicesBlock_axisplus1;
+            return getIdxValue(indices_offset);
+        };
+        size_t indices_offset = 0;
+        if (!use_init_val) {
+            for (auto e = first; e != last; e++) {
+                const auto idxValue = dstAt(*e, indices_offset);
+                dataPtr[dst_offsets[e->column] + idxValue * dataBlock_axisplus1] = neutral;
+            }
+        }
+        const size_t row_begin = ithr * rows_per_owner;
+        std::vector<int32_t> counters(isMean ? rows_per_owner * columns : 0lu, 0);
+        for (auto e = first; e != last; e++) {
+            const auto idxValue = dstAt(*e, indices_offset);
+            kernel(&dataPtr[dst_offsets[e->column] + idxValue * dataBlock_axisplus1], &updatePtr[indices_offset]);
+            if (isMean)
+                counters[(idxValue - row_begin) * columns + e->column]++;
+        }
+        if (isMean) {
+            const size_t row_end = std::min(row_begin + rows_per_owner, static_cast<size_t>(data_dim_size));
+            for (size_t row = row_begin; row < row_end; row++) {
+                for (size_t c = 0; c < columns; c++) {
+                    const auto N = counters[(row - row_begin) * columns + c];
+                    if (N == 0)
+                        continue;
+                    auto& dst = dataPtr[dst_offsets[c] + row * dataBlock_axisplus1];
+                    dst = static_cast<DataType>(static_cast<double>(dst) / (N + static_cast<int32_t>(use_init_val)));
+                }
+            }
+        }
+    });
+    return true;
+}
+
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
 // output[i][indices[i][j][k]][k] = updates[i][j][k] if axis = 1,
 // output[i][j][indices[i][j][k]] = updates[i][j][k] if axis = 2.
@@ -395,6 +570,10 @@ template <typename DataType, typename KernelType>
 void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const MemoryPtr& mem_indices, const MemoryPtr& mem_updates,
                             int axis, const KernelType& kernel) {
     using namespace scatter_elements_update;
+    if (reduction_type != ScatterUpdate::Reduction::NONE &&
+        scatterElementsReduceByAxis<DataType>(mem_data, mem_indices, mem_updates, axis, kernel))
+        return;
+
     DataType *dataPtr = mem_data->getDataAs<DataType>();
     DataType *updatePtr = mem_updates->getDataAs<DataType>();
     uint8_t *indicesPtr = mem_indices->getDataAs<uint8_t>();
@@ -508,6 +687,9 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
                                           int axis, const scatter_elements_update::ReduceMean& kernel) {
     using namespace scatter_elements_update;
     OPENVINO_ASSERT(reduction_type == ScatterUpdate::Reduction::MEAN, "The reduction type should be MEAN here.");
+    if (scatterElementsReduceByAxis<DataType>(mem_data, mem_indices, mem_updates, axis, kernel))
+        return;
+
     DataType *dataPtr = mem_data->getDataAs<DataType>();
     DataType *updatePtr = mem_updates->getDataAs<DataType>();
     uint8_t *indicesPtr = mem_indices->getDataAs<uint8_t>();
@@ -561,9 +743,8 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
         // in the outer loop.
         auto offsets = tensorItr.startover(start, dataBlockND, indicesBlockND);
         if (axis == static_cast<int>(updates_rank - 1)) {
+            std::vector<int32_t> mean_reduction_counters(data_dim_size, 0);  // num_sums per idxValue for current row
             for (size_t worker = start; worker < end; worker++) {
-                std::unordered_map<size_t, int64_t> mean_reduction_counters;  // (idxValue, num_sums) for current worker
-
                 auto indices_offset = offsets[1];
                 for (size_t idx = 0; idx < index_dim_size; idx++) {
                     int64_t idxValue =  getIndicesValue(indicesPtr, indices_offset);
@@ -577,11 +758,18 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
                     mean_reduction_counters[idxValue] += 1;
                 }
 
-                // average
-                for (const auto& counter : mean_reduction_counters) {
-                    auto dst = &dataPtr[offsets[0] + counter.first * dataBlock_axisplus1];
-                    const auto N = counter.second + static_cast<int32_t>(use_init_val);
+                // average, the counters are reset on the way to be reused by the next row
+                indices_offset = offsets[1];
+                for (size_t idx = 0; idx < index_dim_size; idx++) {
+                    int64_t idxValue =  getIndicesValue(indicesPtr, indices_offset);
+                    if (idxValue < 0) idxValue += data_dim_size;
+                    indices_offset += indicesBlock_axisplus1;
+                    if (mean_reduction_counters[idxValue] == 0)
+                        continue;
+                    auto dst = &dataPtr[offsets[0] + idxValue * dataBlock_axisplus1];
+                    const auto N = mean_reduction_counters[idxValue] + static_cast<int32_t>(use_init_val);
                     *dst = static_cast<DataType>(static_cast<double>(*dst) / N);
+                    mean_reduction_counters[idxValue] = 0;
                 }
 
                 // increment
@@ -590,7 +778,9 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
         } else {
             // For better performance, the offsets of dst and indices are cached in the first iteration of outer loop, and reused
             // in the remaining iterations.
-            std::unordered_map<DataType*, int64_t> mean_reduction_counters;     // (dst_addr, num_sums) for all workers
+            // (idxValue, worker) pair of every reduced element, the number of equal pairs is num_sums
+            std::vector<std::pair<int64_t, size_t>> mean_reduction_targets;
+            mean_reduction_targets.reserve((end - start) * index_dim_size);
 
             std::vector<size_t> dst_offsets(end-start+1, offsets[0]);  // one extra to avoid overflow at the last iteration of inner loop
             std::vector<size_t> indices_offsets(end-start+1, offsets[1]);
@@ -604,7 +794,7 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
                 auto src = &updatePtr[ptr_indices_offset[0]];
                 kernel(dst, src);
 
-                mean_reduction_counters[dst] += 1;
+                mean_reduction_targets.emplace_back(idxValue, worker - start);
 
                 // increment once for all
                 tensorItr.increment(offsets, dataBlockND, indicesBlockND);
@@ -622,17 +812,23 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
                     auto dst = &dataPtr[ptr_dst_offset[0] + idxValue * dataBlock_axisplus1];
                     auto src = &updatePtr[indices_offset];
                     kernel(dst, src);
-                    mean_reduction_counters[dst] += 1;
+                    mean_reduction_targets.emplace_back(idxValue, worker - start);
                     ptr_indices_offset++;
                     ptr_dst_offset++;
                 }
             }
 
-            // average
-            for (const auto& counter : mean_reduction_counters) {
-                auto dst = counter.first;
-                const auto N = counter.second + static_cast<int32_t>(use_init_val);
+            // average, equal pairs are grouped by sorting, so only the touched elements are visited
+            std::sort(mean_reduction_targets.begin(), mean_reduction_targets.end());
+            for (auto it = mean_reduction_targets.begin(); it != mean_reduction_targets.end();) {
+                const auto target = *it;
+                auto next = std::find_if(it, mean_reduction_targets.end(), [&](const std::pair<int64_t, size_t>& t) {
+                    return t != target;
+                });
+                auto dst = &dataPtr[dst_offsets[target.second] + target.first * dataBlock_axisplus1];
+                const auto N = static_cast<int32_t>(next - it) + static_cast<int32_t>(use_init_val);
                 *dst = static_cast<DataType>(static_cast<double>(*dst) / N);
+                it = next;
             }
         }
     });
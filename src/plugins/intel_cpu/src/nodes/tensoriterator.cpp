@@ -226,7 +226,7 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
     elem_size = DnnlExtensionUtils::sizeOfDataType(from->getDataType());
 }
 
-void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
+void DynamicBuffer::execute(const Node* node, const int iter) {
     if (from->getStaticDims()[map_rule.axis] != static_cast<size_t>(std::abs(map_rule.stride)))
         OPENVINO_THROW("TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. ",
                        std::abs(map_rule.stride),
@@ -234,13 +234,14 @@ void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
                        from->getStaticDims()[map_rule.axis]);
 
     if (iter == 0) {
-        init(eng);
+        init(node);
     }
 
-    // if chunk_offset_in_byte out of range of buffer holder, reallocate a larger chunk
-    if (check_buffer()) {
-        auto new_buffer = create_buffer(eng);
-        move_buffer(new_buffer);
+    if (!write_to_output && (chunks.empty() || chunks.back().execs == chunks.back().capacity)) {
+        // the buffer is full: keep the filled chunks in place and continue in a new one,
+        // which is as large as all the previous ones to keep the number of chunks logarithmic
+        const auto capacity = max_iter_count != -1 ? std::max(max_iter_count - num_execs, 1) : std::max(num_execs, 1);
+        add_chunk(node->getEngine(), capacity);
     }
 
     move_data();
@@ -250,101 +251,86 @@ void DynamicBuffer::reset(int max_iter_count_) {
     max_iter_count = max_iter_count_;
 }
 
-void DynamicBuffer::init(const dnnl::engine& eng) {
+void DynamicBuffer::init(const Node* node) {
     const auto stride = map_rule.stride;
     const auto abs_stride = std::abs(stride);
 
     // We have no idea of "from" node memory dims until the sub_graph has been executed.
     const auto& src_mem = from->getPrimitive();
     const auto& src_desc = src_mem.get_desc();
-    const auto& dims = src_desc.get_dims();
+    auto dims = src_desc.get_dims();
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, size_t(1), std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
     chunk_unit_in_byte = abs_stride * len;
+    num_execs = 0;
 
-    if (!mem_holder_buffer) { // else reuse buffer holder of last inference
-        // preallocate a large chunk of memory to hold intermediate concated outputs of all iterations.
-        mem_holder_buffer = create_buffer(eng);
+    // When the iterations are concatenated along the outermost non-trivial axis in forward order, the output
+    // of n iterations is a prefix of the output of max_iter_count iterations. So with a known upper bound
+    // the output memory is sized for max_iter_count and each iteration is stored right to its final place.
+    write_to_output = max_iter_count > 0 && stride > 0 && count == 1lu;
+    if (write_to_output) {
+        dims[map_rule.axis] = abs_stride * max_iter_count;
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
+                DnnlExtensionUtils::convertToVectorDims(dims));
+        redefineToMemories(to, desc);
+        chunks.clear();
+        return;
     }
 
-    // reset chunk_offset_in_byte since the first execution
-    chunk_stride_in_byte = mem_holder_buffer->getSize() / count;
-    chunk_offset_in_byte = stride > 0 ? 0 : (chunk_stride_in_byte - chunk_unit_in_byte);
-    num_execs = 0;
-}
-
-bool DynamicBuffer::check_buffer() {
-    if (map_rule.stride > 0) {
-        if (static_cast<ptrdiff_t>(chunk_offset_in_byte + chunk_unit_in_byte) > chunk_stride_in_byte) return true;
+    // reuse the first chunk of the last inference if it is large enough, the rest is released.
+    // With no upper bound the new chunk is sized for the iterations number of the last inference.
+    const auto last_num_execs = std::accumulate(chunks.begin(), chunks.end(), 0, [](int sum, const Chunk& chunk) {
+        return sum + chunk.execs;
+    });
+    const auto capacity = max_iter_count != -1 ? max_iter_count : std::max(last_num_execs, 1);
+    const auto required_size = static_cast<size_t>(capacity) * count * chunk_unit_in_byte;
+    if (!chunks.empty() && chunks.front().mem->getSize() >= required_size) {
+        chunks.resize(1);
+        chunks.front().capacity = static_cast<int>(chunks.front().mem->getSize() / (count * chunk_unit_in_byte));
+        chunks.front().execs = 0;
     } else {
-        if (chunk_offset_in_byte < 0) return true;
+        chunks.clear();
+        add_chunk(node->getEngine(), capacity);
     }
-    return false;
 }
 
-MemoryPtr DynamicBuffer::create_buffer(const dnnl::engine& eng) {
+void DynamicBuffer::add_chunk(const dnnl::engine& eng, int capacity) {
     const auto abs_stride = std::abs(map_rule.stride);
 
-    const auto estimate_iters = [&] () {
-        if (max_iter_count != -1) return max_iter_count;
-
-        // in case of no idea of memory upper boundary
-        return (num_execs == 0) ? 1 : 2 * num_execs; // growth factor 2
-    };
-    const auto estimated_iters = estimate_iters();
-    const Shape _shape = Shape({count, static_cast<size_t>(abs_stride * estimated_iters), len/elem_size});
+    const Shape _shape = Shape({count, static_cast<size_t>(abs_stride * capacity), len/elem_size});
     auto _descCreator = BlockedDescCreator::getCommonCreators().at(LayoutType::ncsp);
     auto new_buffer_desc = _descCreator->createSharedDesc(from->getDesc().getPrecision(), _shape);
 
-    auto _ptr = std::make_shared<Memory>(eng, new_buffer_desc);
-    return _ptr;
+    Chunk chunk;
+    chunk.mem = std::make_shared<Memory>(eng, new_buffer_desc);
+    chunk.capacity = capacity;
+    chunks.push_back(chunk);
 }
 
-void DynamicBuffer::move_buffer(const MemoryPtr& new_buffer) {
-    const auto stride = map_rule.stride;
-
-    // copy data from old buffer to new buffer
-    const auto src_stride = chunk_stride_in_byte;
-    const auto dst_stride = new_buffer->getStaticDims()[1] * len;
-
-    const auto valid_size = chunk_unit_in_byte * num_execs;
-    const auto src_offset_in_byte = stride > 0 ? 0 : (src_stride - valid_size);
-    chunk_offset_in_byte = stride > 0 ? 0 : (dst_stride - valid_size);  // reset chunk_offset_in_byte
-
-    copy(mem_holder_buffer->getDataAs<uint8_t>() + src_offset_in_byte,
-        new_buffer->getDataAs<uint8_t>() + chunk_offset_in_byte,
-        src_stride, dst_stride, count, valid_size);
-
-    // assign mem_holder_buffer
-    mem_holder_buffer = new_buffer;
-    chunk_stride_in_byte = mem_holder_buffer->getSize() / count;
-
-    // adjust for next execution
-    if (stride > 0) {
-        chunk_offset_in_byte += valid_size;
-    } else {
-        chunk_offset_in_byte -= chunk_unit_in_byte;
+void DynamicBuffer::move_data() {
+    if (write_to_output) {
+        // count == 1, so the iteration output is contiguous in both memories
+        cpu_memcpy(to.front()->getDataAs<uint8_t>() + num_execs * chunk_unit_in_byte,
+                   from->getDataAs<const uint8_t>(), chunk_unit_in_byte);
+        num_execs++;
+        return;
     }
-}
 
-void DynamicBuffer::move_data() {
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = chunk_stride_in_byte;
+    auto& chunk = chunks.back();
+    const auto src_stride = chunk_unit_in_byte;
+    const auto dst_stride = chunk.capacity * chunk_unit_in_byte;
+    const auto pos = map_rule.stride > 0 ? chunk.execs : chunk.capacity - chunk.execs - 1;
 
-    copy(from->getDataAs<const uint8_t>(), mem_holder_buffer->getDataAs<uint8_t>() + chunk_offset_in_byte,
+    copy(from->getDataAs<const uint8_t>(), chunk.mem->getDataAs<uint8_t>() + pos * chunk_unit_in_byte,
          src_stride, dst_stride, count, chunk_unit_in_byte);
 
     // adjust for next execution
+    chunk.execs++;
     num_execs++;
-    if (map_rule.stride > 0) {
-        chunk_offset_in_byte += chunk_unit_in_byte;
-    } else {
-        chunk_offset_in_byte -= chunk_unit_in_byte;
-    }
 }
 
 void DynamicBuffer::transfer(const Node* node) {
-    if (mem_holder_buffer && num_execs > 0) {
+    if (num_execs > 0) {
         const auto axis = map_rule.axis;
         const auto stride = map_rule.stride;
         const auto abs_stride = std::abs(stride);
@@ -356,16 +342,25 @@ void DynamicBuffer::transfer(const Node* node) {
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
                 DnnlExtensionUtils::convertToVectorDims(dims));
 
+        // shrinking of the memory keeps its content, so the directly written output needs no copy
         redefineToMemories(to, desc);
+        if (write_to_output)
+            return;
 
-        const auto src_stride = chunk_stride_in_byte;
         const auto dst_stride = to.front()->getStaticDims()[axis] * len;
-        const auto valid_size = chunk_unit_in_byte * num_execs;
-        const auto src_offset_in_byte = stride > 0 ? 0 : (src_stride - valid_size);
-
-        copy(mem_holder_buffer->getDataAs<uint8_t>() + src_offset_in_byte,
-             to.front()->getDataAs<uint8_t>(),
-             src_stride, dst_stride, count, dst_stride);
+        int stored_execs = 0;
+        for (const auto& chunk : chunks) {
+            const auto src_stride = chunk.capacity * chunk_unit_in_byte;
+            const auto valid_size = chunk.execs * chunk_unit_in_byte;
+            const auto src_offset_in_byte = stride > 0 ? 0 : (src_stride - valid_size);
+            // the chunks go in the backward order in the output for the negative stride
+            const auto dst_offset_in_byte = (stride > 0 ? stored_execs : num_execs - stored_execs - chunk.execs) * chunk_unit_in_byte;
+
+            copy(chunk.mem->getDataAs<uint8_t>() + src_offset_in_byte,
+                 to.front()->getDataAs<uint8_t>() + dst_offset_in_byte,
+                 src_stride, dst_stride, count, valid_size);
+            stored_execs += chunk.execs;
+        }
     } else {
         VectorDims newDims = to.front()->getShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -603,7 +598,6 @@ void TensorIterator::execute(dnnl::stream strm) {
 }
 
 void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
-    const auto &eng = getEngine();
     sub_graph.ResetInferCount();
 
     bool continue_cond = initial_cond_check->getStatus();
@@ -625,7 +619,7 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
         continue_cond = continue_cond_check->getStatus();
 
         for (auto& buffer : buffers)
-            buffer->execute(eng, i);
+            buffer->execute(this, i);
 
         // on the last iteration we shouldn't reshape body inputs and init back edges
         if ((i + 1 != max_num_iter) && continue_cond)
@@ -675,15 +669,21 @@ void TensorIterator::prepareBackEdges() {
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
-    back_mappers.clear();
-    for (auto map_rule : backEdges) {
+    // the mappers are called on each iteration, so they are recreated only when the body shapes have changed
+    if (back_mappers.size() != backEdges.size()) {
+        back_mappers.clear();
+        back_mappers.resize(backEdges.size());
+    }
+    for (size_t i = 0; i < backEdges.size(); i++) {
+        const auto& map_rule = backEdges[i];
         auto from_mem = output_mem[map_rule.from];
-        auto to_mems = input_mems[map_rule.to];
+        auto &to_mems = input_mems[map_rule.to];
 
         redefineToMemories(to_mems, from_mem->getDescPtr());
 
         // first memory is enough to get common memory ptr
-        back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front()));
+        if (!back_mappers[i] || !back_mappers[i]->isBoundTo(from_mem, to_mems.front()))
+            back_mappers[i] = std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front());
     }
 }
 
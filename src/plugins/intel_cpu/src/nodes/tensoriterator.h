@@ -37,6 +37,10 @@ class PortMapHelper {
 public:
     virtual ~PortMapHelper() = default;
     virtual void execute(dnnl::stream strm, int n_iter = -1) = 0;
+    // the mapper stays valid while both memories keep the primitives it was created for
+    bool isBoundTo(const MemoryPtr& from, const MemoryPtr& to) const {
+        return mem_holder_src == from->getPrimitive() && mem_holder_dst == to->getPrimitive();
+    }
 protected:
     dnnl::primitive reorder;
     dnnl::memory mem_holder_src;
@@ -66,31 +70,38 @@ class DynamicBuffer {
 public:
     DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_);
 
-    void execute(const dnnl::engine& eng, const int iter);
+    void execute(const Node* node, const int iter);
     void transfer(const Node* node);
 
     void reset(int max_iter_count_);   // reset local
 
 private:
-    void init(const dnnl::engine& eng);
+    void init(const Node* node);
 
-    /* methods for resize and refill buffer */
-    bool check_buffer();
-    MemoryPtr create_buffer(const dnnl::engine& eng);
-    void move_buffer(const MemoryPtr& new_buffer);
+    /* methods for allocation and refill of buffer chunks */
+    void add_chunk(const dnnl::engine& eng, int capacity);
     void move_data();
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
 
+    /**
+     * Part of the buffer of shape [count, abs(stride) * capacity, len] holding the outputs of
+     * 'execs' consecutive iterations. Filled from the beginning for positive stride and from the end otherwise.
+     */
+    struct Chunk {
+        MemoryPtr mem;
+        int capacity = 0;
+        int execs = 0;
+    };
+
     /* variable states */
     size_t len = 1lu;
     size_t count = 1lu;
 
-    ptrdiff_t chunk_stride_in_byte = 0;
-    ptrdiff_t chunk_offset_in_byte = 0;
     size_t chunk_unit_in_byte = 0lu;   // the amount of bytes copied per each count per each execution (iteration)
     int num_execs = 0lu;      // number of executions happened
     int max_iter_count = -1;   // estimated maximum iter count
+    bool write_to_output = false;   // iterations are written straight to the node output memory
 
     /* invariable states */
     MemoryPtr from;
@@ -98,7 +109,8 @@ private:
     PortMap map_rule;
     size_t elem_size = 0lu;
 
-    MemoryPtr mem_holder_buffer;
+    // a new chunk is appended when the last one is full, so the data of the previous iterations is never moved
+    std::vector<Chunk> chunks;
 };
 
 class TensorIterator : public Node {
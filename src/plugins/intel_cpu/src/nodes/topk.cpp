@@ -15,6 +15,9 @@
 #include "utils/ngraph_utils.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <numeric>
 #include <set>
 #include <string>
 #include <vector>
@@ -1787,6 +1790,243 @@ private:
 };
 #endif
 
+namespace {
+
+// radix select costs two passes over the axis whatever top_k is, on a single thread it overtakes the heap kernel
+// from a few hundreds of survivors. Unlike the kernels it also splits one line between threads, which pays off much
+// earlier when there are fewer lines than threads.
+constexpr size_t topk_radix_min_axis = 4096;
+constexpr int topk_radix_min_k = 128;
+constexpr int topk_radix_min_k_split = 32;
+constexpr size_t topk_radix_bins = 256;
+constexpr int topk_radix_digit = 8;
+constexpr size_t topk_radix_min_chunk = 1024;
+constexpr size_t topk_radix_sub_hists = 4;
+
+// Map each supported precision onto unsigned keys whose order matches the order of the values
+struct RadixKeyF32 {
+    using type = float;
+    static constexpr int bits = 32;
+    static uint32_t get(float v) {
+        uint32_t b;
+        std::memcpy(&b, &v, sizeof(b));
+        if ((b << 1) == 0)
+            b = 0;  // -0.0 and 0.0 compare equal
+        return b ^ (static_cast<uint32_t>(static_cast<int32_t>(b) >> 31) | 0x80000000u);
+    }
+};
+
+struct RadixKeyBF16 {
+    using type = uint16_t;
+    static constexpr int bits = 16;
+    static uint32_t get(uint16_t b) {
+        if ((b & 0x7FFFu) == 0)
+            b = 0;
+        return b ^ ((static_cast<uint32_t>(static_cast<int16_t>(b)) >> 16) | 0x8000u);
+    }
+};
+
+struct RadixKeyI32 {
+    using type = int32_t;
+    static constexpr int bits = 32;
+    static uint32_t get(int32_t v) {
+        return static_cast<uint32_t>(v) ^ 0x80000000u;
+    }
+};
+
+struct RadixKeyI8 {
+    using type = int8_t;
+    static constexpr int bits = 8;
+    static uint32_t get(int8_t v) {
+        return static_cast<uint8_t>(v) ^ 0x80u;
+    }
+};
+
+struct RadixKeyU8 {
+    using type = uint8_t;
+    static constexpr int bits = 8;
+    static uint32_t get(uint8_t v) {
+        return v;
+    }
+};
+
+struct RadixSelectScratch {
+    uint32_t* keys;   // the keys of the whole line
+    int32_t* cand;    // indices of the keys that still share the digits of the k-th one
+    int32_t* sel;     // k selected indices
+    std::vector<size_t> hist;
+    std::vector<size_t> gt_offset;
+    std::vector<size_t> eq_offset;
+};
+
+// number of lines processed at once, each one needs its own keys and candidates of the axis size
+size_t radixSelectSlots(size_t lines) {
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    return lines >= nthr ? nthr : 1;
+}
+
+// Select the k greatest keys of one sorting line into scratch.sel, unordered.
+// The first digit pass sees the whole line and is split between nthr threads: every key whose top digit is greater
+// than the one of the k-th key is selected right away, and only the keys sharing that digit stay candidates for the
+// next, serial passes. Among equal keys the lowest indices win, so the selection is stable.
+template <typename Key>
+void radixSelectLine(const typename Key::type* src, size_t stride, size_t n, size_t k, bool mode_max,
+                     RadixSelectScratch& s, int nthr) {
+    const uint32_t key_flip = mode_max ? 0u : static_cast<uint32_t>((static_cast<uint64_t>(1) << Key::bits) - 1);
+    constexpr uint32_t digit_mask = topk_radix_bins - 1;
+    uint32_t* keys = s.keys;
+    int32_t* cand = s.cand;
+    int32_t* sel = s.sel;
+    int shift = Key::bits - topk_radix_digit;
+
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(n, nthr, ithr, start, end);
+        // interleaved sub-histograms, so that runs of keys with the same digit do not serialize on one counter
+        std::array<size_t, topk_radix_sub_hists * topk_radix_bins> sub{};
+        size_t i = start;
+        for (; i + topk_radix_sub_hists <= end; i += topk_radix_sub_hists) {
+            for (size_t j = 0; j < topk_radix_sub_hists; j++) {
+                const uint32_t key = Key::get(src[(i + j) * stride]) ^ key_flip;
+                keys[i + j] = key;
+                sub[j * topk_radix_bins + (key >> shift)]++;
+            }
+        }
+        for (; i < end; i++) {
+            const uint32_t key = Key::get(src[i * stride]) ^ key_flip;
+            keys[i] = key;
+            sub[key >> shift]++;
+        }
+        size_t* hist = &s.hist[ithr * topk_radix_bins];
+        for (size_t d = 0; d < topk_radix_bins; d++) {
+            hist[d] = sub[d];
+            for (size_t j = 1; j < topk_radix_sub_hists; j++)
+                hist[d] += sub[j * topk_radix_bins + d];
+        }
+    });
+
+    // walks the digits from the greatest one, rank is turned into the rank inside the returned digit
+    auto find_digit = [](const size_t* hist, size_t& rank) {
+        uint32_t d = digit_mask;
+        for (; d > 0 && hist[d] < rank; d--)
+            rank -= hist[d];
+        return d;
+    };
+
+    std::array<size_t, topk_radix_bins> total{};
+    for (int t = 0; t < nthr; t++) {
+        for (size_t d = 0; d < topk_radix_bins; d++)
+            total[d] += s.hist[t * topk_radix_bins + d];
+    }
+    size_t rank = k;
+    uint32_t digit = find_digit(total.data(), rank);
+
+    size_t gt = 0, len = 0;
+    for (int t = 0; t < nthr; t++) {
+        const size_t* hist = &s.hist[t * topk_radix_bins];
+        s.gt_offset[t] = gt;
+        s.eq_offset[t] = len;
+        gt = std::accumulate(hist + digit + 1, hist + topk_radix_bins, gt);
+        len += hist[digit];
+    }
+    parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(n, nthr, ithr, start, end);
+        int32_t* gt_dst = sel + s.gt_offset[ithr];
+        int32_t* eq_dst = cand + s.eq_offset[ithr];
+        for (size_t i = start; i < end; i++) {
+            const uint32_t d = keys[i] >> shift;
+            if (d > digit)
+                *gt_dst++ = static_cast<int32_t>(i);
+            else if (d == digit)
+                *eq_dst++ = static_cast<int32_t>(i);
+        }
+    });
+
+    for (shift -= topk_radix_digit; shift >= 0; shift -= topk_radix_digit) {
+        total.fill(0);
+        for (size_t i = 0; i < len; i++)
+            total[(keys[cand[i]] >> shift) & digit_mask]++;
+        digit = find_digit(total.data(), rank);
+        size_t m = 0;
+        for (size_t i = 0; i < len; i++) {
+            const uint32_t d = (keys[cand[i]] >> shift) & digit_mask;
+            if (d > digit)
+                sel[gt++] = cand[i];
+            else if (d == digit)
+                cand[m++] = cand[i];
+        }
+        len = m;
+    }
+
+    // the candidates left are all equal to the k-th key and kept in index order
+    std::copy(cand, cand + rank, sel + gt);
+}
+
+template <typename Key>
+void radixSelectExec(const uint8_t* in_ptr, uint8_t* out_ptr, uint8_t* out_idx_ptr, uint32_t* keys_buf,
+                     int32_t* cand_buf, size_t O, size_t A, size_t I, size_t k, bool mode_max, bool sort_index) {
+    using T = typename Key::type;
+    const auto* src = reinterpret_cast<const T*>(in_ptr);
+    auto* dst = reinterpret_cast<T*>(out_ptr);
+    auto* dst_idx = reinterpret_cast<int32_t*>(out_idx_ptr);
+    const size_t lines = O * I;
+
+    auto make_scratch = [&](size_t slot, int nthr, std::vector<int32_t>& sel) {
+        RadixSelectScratch s;
+        s.keys = keys_buf + slot * A;
+        s.cand = cand_buf + slot * A;
+        s.sel = sel.data();
+        s.hist.resize(nthr * topk_radix_bins);
+        s.gt_offset.resize(nthr);
+        s.eq_offset.resize(nthr);
+        return s;
+    };
+
+    // only the k survivors are sorted, by value with ties in index order or by index
+    auto process_line = [&](size_t line, RadixSelectScratch& s, int nthr) {
+        const size_t o = line / I, i = line % I;
+        radixSelectLine<Key>(src + o * A * I + i, I, A, k, mode_max, s, nthr);
+        int32_t* sel = s.sel;
+        if (sort_index) {
+            std::sort(sel, sel + k);
+        } else {
+            const uint32_t* keys = s.keys;
+            std::sort(sel, sel + k, [keys](int32_t a, int32_t b) {
+                return keys[a] > keys[b] || (keys[a] == keys[b] && a < b);
+            });
+        }
+        for (size_t j = 0; j < k; j++) {
+            const size_t off = (o * k + j) * I + i;
+            dst[off] = src[(o * A + sel[j]) * I + i];
+            dst_idx[off] = sel[j];
+        }
+    };
+
+    if (radixSelectSlots(lines) > 1) {
+        parallel_nt(static_cast<int>(radixSelectSlots(lines)), [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(lines, nthr, ithr, start, end);
+            if (start == end)
+                return;
+            std::vector<int32_t> sel(k);
+            auto s = make_scratch(ithr, 1, sel);
+            for (size_t line = start; line < end; line++)
+                process_line(line, s, 1);
+        });
+    } else {
+        // a few long lines, e.g. the vocabulary logits of a single sequence, each one is split between the threads
+        const size_t max_nthr = static_cast<size_t>(parallel_get_max_threads());
+        const int nthr = static_cast<int>(std::max<size_t>(1, std::min(max_nthr, A / topk_radix_min_chunk)));
+        std::vector<int32_t> sel(k);
+        auto s = make_scratch(0, nthr, sel);
+        for (size_t line = 0; line < lines; line++)
+            process_line(line, s, nthr);
+    }
+}
+
+}  // namespace
+
 bool TopK::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(), ov::op::v1::TopK::get_type_info_static(),
@@ -2015,11 +2255,13 @@ void TopK::prepareParams() {
         // [case 1]: if 2 * (top_k + 1) + 2 <= count_xmm, thus top_k is small enough that the vector registers are sufficient
         //           to keep all necessary data for sorting, no need to load and store frequently, use inplace bubble sort;
         //           (horizotal sorting cases not included)
-        // [case 2]: if stable sorting is required, bubble sort(topk_bubble_vector/topk_bubble_BLK_on_channel_verti) will be
+        // [case 2]: if the sorting axis is long and top_k is large enough on planar(ncsp/nspc) layout, use radix select, it
+        //           costs two passes over the axis whatever top_k is, splits a line between threads and is stable;
+        // [case 3]: if stable sorting is required, bubble sort(topk_bubble_vector/topk_bubble_BLK_on_channel_verti) will be
         //           applied currently, because among the implemented sorting algorithms, these bubble sort implementations
         //           are the only stable ones;
-        // [case 3]: only when topk is imposed on innermost dimsension of planar(ncsp/nspc) layout, should heap sort be used;
-        // [case 4]: by default, use bitonic sort when alg_cost_bitonic < alg_cost_bubble, otherwise use bubble sort.
+        // [case 4]: only when topk is imposed on innermost dimsension of planar(ncsp/nspc) layout, should heap sort be used;
+        // [case 5]: by default, use bitonic sort when alg_cost_bitonic < alg_cost_bubble, otherwise use bubble sort.
         //           alg_cost_bitonic = (N / 4) * logN * (logN + 1)
         //           alg_cost_bubble = K * (K - 1) / 2 + (N - K) * K
         //           where, N = axis_dim, K = topk_k
@@ -2030,6 +2272,8 @@ void TopK::prepareParams() {
             if (static_cast<size_t>(top_k) <= count_xmm / 2 - 2) {
                 algorithm = TopKAlgorithm::topk_bubble_sort;
                 bubble_inplace = topk_innermost && top_k == 1 ? false : true;
+            } else if (can_use_radix_select()) {
+                algorithm = TopKAlgorithm::topk_radix_select;
             } else if (stable) {
                 algorithm = TopKAlgorithm::topk_bubble_sort;
                 bubble_inplace = false;
@@ -2046,6 +2290,9 @@ void TopK::prepareParams() {
                     bubble_inplace = false;
                 }
             }
+        } else if (topk_kernel) {
+            // the shape agnostic kernel keeps its own algorithm, radix select only takes over the long axes
+            algorithm = can_use_radix_select() ? TopKAlgorithm::topk_radix_select : topk_kernel->jcp_.algorithm;
         }
 
         prepare_original_idx();
@@ -2057,6 +2304,18 @@ void TopK::prepareParams() {
         }
         dim = static_cast<int>(src_dims[axis]);
         before_num = count(src_dims, 0, axis);
+
+        axis_dim = src_dims[axis];
+        O = before_num;
+        A = axis_dim;
+        I = count(src_dims, axis + 1);
+        algorithm = can_use_radix_select() ? TopKAlgorithm::topk_radix_select : TopKAlgorithm::topk_bubble_sort;
+    }
+
+    if (algorithm == TopKAlgorithm::topk_radix_select) {
+        const size_t radix_buf_size = radixSelectSlots(O * I) * A;
+        vec_radix_keys.resize(radix_buf_size);
+        vec_radix_cand.resize(radix_buf_size);
     }
 }
 
@@ -2115,7 +2374,9 @@ void TopK::createPrimitive() {
             }
         }
 #if defined(OPENVINO_ARCH_X86_64)
-        if (mayiuse(cpu::x64::avx512_core)) {
+        if (algorithm == TopKAlgorithm::topk_radix_select) {
+            // static shapes served by radix select need no kernel
+        } else if (mayiuse(cpu::x64::avx512_core)) {
             topk_kernel.reset(new jit_uni_topk_kernel_f32<cpu::x64::avx512_core>(jcp));
         } else if (mayiuse(cpu::x64::avx2)) {
             topk_kernel.reset(new jit_uni_topk_kernel_f32<cpu::x64::avx2>(jcp));
@@ -2142,7 +2403,9 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_data = dstMemPtr->getDataAs<uint8_t>();
     uint8_t *dst_idx = dstIndexesMemPtr->getDataAs<uint8_t>();
 
-    if (jit_mode) {
+    if (algorithm == TopKAlgorithm::topk_radix_select) {
+        topk_radix_select(src_data, dst_data, dst_idx);
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2373,6 +2636,41 @@ void TopK::topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx) {
         topk_ref_process(in_ptr, out_ptr, dst_idx, src_dims, [](float x, float y)->float { return x < y; });
 }
 
+void TopK::topk_radix_select(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    const auto precision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision();
+    const size_t k = static_cast<size_t>(top_k);
+    uint32_t* keys = vec_radix_keys.data();
+    int32_t* cand = vec_radix_cand.data();
+    switch (precision) {
+    case ov::element::f32:
+        radixSelectExec<RadixKeyF32>(in_ptr, out_ptr, out_idx_ptr, keys, cand, O, A, I, k, mode_max, sort_index);
+        break;
+    case ov::element::bf16:
+        radixSelectExec<RadixKeyBF16>(in_ptr, out_ptr, out_idx_ptr, keys, cand, O, A, I, k, mode_max, sort_index);
+        break;
+    case ov::element::i32:
+        radixSelectExec<RadixKeyI32>(in_ptr, out_ptr, out_idx_ptr, keys, cand, O, A, I, k, mode_max, sort_index);
+        break;
+    case ov::element::i8:
+        radixSelectExec<RadixKeyI8>(in_ptr, out_ptr, out_idx_ptr, keys, cand, O, A, I, k, mode_max, sort_index);
+        break;
+    case ov::element::u8:
+        radixSelectExec<RadixKeyU8>(in_ptr, out_ptr, out_idx_ptr, keys, cand, O, A, I, k, mode_max, sort_index);
+        break;
+    default:
+        OPENVINO_THROW(errorPrefix, " does not support radix select for ", precision, " precision.");
+    }
+}
+
+// Radix select does not depend on the ISA, so it also serves the long axes on the reference path. Blocked layouts
+// are left to the jit kernels.
+bool TopK::can_use_radix_select() const {
+    if (!one_of(layout, TopKLayoutType::topk_ncsp, TopKLayoutType::topk_nspc) || axis_dim < topk_radix_min_axis)
+        return false;
+    const bool split_lines = O * I < static_cast<size_t>(parallel_get_max_threads());
+    return top_k >= (split_lines ? topk_radix_min_k_split : topk_radix_min_k);
+}
+
 void TopK::topk_ref_process(const float* src_data, float* dst_data, int32_t* dst_idx, const VectorDims &in_dims,
                                std::function<float(float, float)> compare) const {
     int after_num = count(in_dims, axis + 1, in_dims.size());
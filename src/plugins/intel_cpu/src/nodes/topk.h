@@ -23,7 +23,8 @@ enum TopKLayoutType {
 enum TopKAlgorithm {
     topk_bubble_sort,
     topk_bitonic_sort,
-    topk_heap_sort
+    topk_heap_sort,
+    topk_radix_select   // not a jit kernel, histogram based selection for long axes
 };
 
 struct jit_topk_config_params {
@@ -100,6 +101,8 @@ public:
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
+    void topk_radix_select(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
+    bool can_use_radix_select() const;
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
     inline static int count(const VectorDims& dims, size_t start_ind, size_t end_ind);
@@ -143,6 +146,9 @@ private:
     std::vector<uint8_t> vec_process_ptr;
     std::vector<uint8_t> vec_process_idx_ptr;
 
+    std::vector<uint32_t> vec_radix_keys;
+    std::vector<int32_t> vec_radix_cand;
+
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel = nullptr;
 
     std::string errorPrefix;
@@ -4,6 +4,11 @@
 
 #include "unique.hpp"
 
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
 #include <openvino/op/unique.hpp>
 #include <openvino/op/constant.hpp>
 
@@ -106,16 +111,12 @@ void Unique::prepareParams() {
         THROW_ERROR(" has unidentified preferable primitive descriptor.");
     }
 
-    size_t srcLen = 1;
-    if (flattened) {
-        srcLen = getSrcMemoryAtPort(IN_DATA)->getSize() / dataTypeSize;
-    } else {
-        auto dstDataShape = getSrcMemoryAtPort(IN_DATA)->getStaticDims();
-        srcLen = dstDataShape[axis];
+    if (!flattened) {
+        const size_t srcLen = getSrcMemoryAtPort(IN_DATA)->getStaticDims()[axis];
+        firstUniTmp.resize(srcLen, 0);
+        inToOutTmp.resize(srcLen);
+        occurTmp.resize(srcLen);
     }
-    firstUniTmp.resize(srcLen, 0);
-    inToOutTmp.resize(srcLen);
-    occurTmp.resize(srcLen);
 }
 
 template<typename T>
@@ -164,120 +165,265 @@ void Unique::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+namespace {
+// Below this size per thread the partitioning costs more than it saves.
+constexpr size_t minChunkLen = 1024lu;
+
+int getChunksNum(size_t len) {
+    return static_cast<int>(std::max<size_t>(1lu, std::min<size_t>(parallel_get_max_threads(), len / minChunkLen)));
+}
+
+template <typename T>
+inline uint64_t keyBits(T val) {
+    // +0.0 and -0.0 are equal and have to land into the same slot.
+    if (val == T(0)) {
+        val = T(0);
+    }
+    uint32_t bits = 0;
+    std::memcpy(&bits, &val, sizeof(T));
+    return bits;
+}
+
+// Position of element d of the merge of the sorted ranges a[0..na) and b[0..nb) in a, the rest comes from b.
+template <typename Less>
+size_t mergeCoRank(size_t d, const int32_t* a, size_t na, const int32_t* b, size_t nb, const Less& less) {
+    size_t lo = d > nb ? d - nb : 0lu;
+    size_t hi = std::min(d, na);
+    while (lo < hi) {
+        const size_t i = (lo + hi) / 2;
+        if (less(a[i], b[d - i - 1])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+}  // namespace
+
 template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = getSrcDataAtPortAs<const T>(IN_DATA);
     const size_t inputLen = getSrcMemoryAtPort(IN_DATA)->getSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
+    if (sorted) {
+        flattenSortedExec(srcDataPtr, inputLen);
+    } else {
+        flattenHashedExec(srcDataPtr, inputLen);
     }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
+}
+
+template <typename T>
+void Unique::flattenSortedExec(const T* srcDataPtr, size_t inputLen) {
+    // The indices are sorted by value and then by position, so the first index of every run is its first occurrence.
+    const auto less = [srcDataPtr](int32_t a, int32_t b) {
+        return srcDataPtr[a] < srcDataPtr[b] || (!(srcDataPtr[b] < srcDataPtr[a]) && a < b);
+    };
+    const int nChunks = getChunksNum(inputLen);
+    std::vector<size_t> bounds(nChunks + 1, inputLen);
+    for (int c = 0; c < nChunks; c++) {
+        size_t end = 0lu;
+        splitter(inputLen, nChunks, c, bounds[c], end);
+    }
+
+    std::vector<int32_t> orderBuf(inputLen), mergeBuf(nChunks > 1 ? inputLen : 0lu);
+    int32_t* order = orderBuf.data();
+    int32_t* merged = mergeBuf.data();
+    parallel_for(nChunks, [&](int c) {
+        std::iota(order + bounds[c], order + bounds[c + 1], static_cast<int32_t>(bounds[c]));
+        std::sort(order + bounds[c], order + bounds[c + 1], less);
+    });
+    // Pairwise merges of the sorted chunks. Every merge is split by co-ranking into parts of equal output length,
+    // so all the threads stay busy on the last levels as well.
+    for (int width = 1; width < nChunks; width *= 2) {
+        const int pairs = (nChunks + 2 * width - 1) / (2 * width);
+        const int parts = std::max(1, nChunks / pairs);
+        parallel_for2d(pairs, parts, [&](int p, int part) {
+            const size_t lo = bounds[std::min(2 * p * width, nChunks)];
+            const size_t mid = bounds[std::min((2 * p + 1) * width, nChunks)];
+            const size_t hi = bounds[std::min((2 * p + 2) * width, nChunks)];
+            const size_t d0 = (hi - lo) * part / parts, d1 = (hi - lo) * (part + 1) / parts;
+            const size_t a0 = mergeCoRank(d0, order + lo, mid - lo, order + mid, hi - mid, less);
+            const size_t a1 = mergeCoRank(d1, order + lo, mid - lo, order + mid, hi - mid, less);
+            std::merge(order + lo + a0, order + lo + a1, order + mid + d0 - a0, order + mid + d1 - a1, merged + lo + d0, less);
+        });
+        std::swap(order, merged);
     }
-    uniqueLen = inputLen;
 
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
+    const auto isRunStart = [&](size_t k) {
+        return k == 0lu || srcDataPtr[order[k - 1]] < srcDataPtr[order[k]];
+    };
+    std::vector<size_t> chunkUniques(nChunks + 1, 0lu);
+    parallel_for(nChunks, [&](int c) {
+        for (size_t k = bounds[c]; k < bounds[c + 1]; k++) {
+            chunkUniques[c + 1] += isRunStart(k);
+        }
+    });
+    std::partial_sum(chunkUniques.begin(), chunkUniques.end(), chunkUniques.begin());
+    uniqueLen = chunkUniques[nChunks];
 
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
+    redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
+
+    T* uniDataPtr = definedOutputs[UNIQUE_DATA] ? getDstDataAtPortAs<T>(UNIQUE_DATA) : nullptr;
+    int* firstPtr = definedOutputs[FIRST_UNIQUE_IDX] ? getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX) : nullptr;
+    int* inToOutPtr = definedOutputs[INPUT_TO_UNIQ_IDX] ? getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX) : nullptr;
+    int* occurPtr = definedOutputs[OCCURRENCES_NUM] ? getDstDataAtPortAs<int>(OCCURRENCES_NUM) : nullptr;
+    // Positions of the runs in the sorted order, their differences are the occurrences.
+    std::vector<size_t> runStarts(occurPtr ? uniqueLen + 1 : 0lu, inputLen);
+
+    parallel_for(nChunks, [&](int c) {
+        // A run started in one of the previous chunks keeps its number.
+        int32_t u = static_cast<int32_t>(chunkUniques[c]) - 1;
+        for (size_t k = bounds[c]; k < bounds[c + 1]; k++) {
+            const int32_t idx = order[k];
+            if (isRunStart(k)) {
+                u++;
+                if (uniDataPtr) {
+                    uniDataPtr[u] = srcDataPtr[idx];
                 }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
+                if (firstPtr) {
+                    firstPtr[u] = idx;
                 }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
+                if (occurPtr) {
+                    runStarts[u] = k;
                 }
             }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
+            if (inToOutPtr) {
+                inToOutPtr[idx] = u;
             }
         }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
+    });
+    if (occurPtr) {
+        parallel_for(uniqueLen, [&](size_t u) {
+            occurPtr[u] = static_cast<int>(runStarts[u + 1] - runStarts[u]);
+        });
+    }
+}
+
+template <typename T>
+void Unique::flattenHashedExec(const T* srcDataPtr, size_t inputLen) {
+    // Open addressing table with at most 50% load. Every slot keeps the position of the element that claimed it
+    // and the smallest position of its value, which is the first occurrence.
+    int log2Size = 1;
+    while ((static_cast<size_t>(1) << log2Size) < 2 * inputLen) {
+        log2Size++;
+    }
+    const size_t tableSize = static_cast<size_t>(1) << log2Size;
+    const size_t slotMask = tableSize - 1;
+    const int hashShift = 64 - log2Size;
+    std::unique_ptr<std::atomic<int32_t>[]> slotKey(new std::atomic<int32_t>[tableSize]);
+    std::unique_ptr<std::atomic<int32_t>[]> slotFirst(new std::atomic<int32_t>[tableSize]);
+    std::vector<int32_t> slotOf(inputLen);
+    parallel_for(tableSize, [&](size_t s) {
+        slotKey[s].store(-1, std::memory_order_relaxed);
+        slotFirst[s].store(std::numeric_limits<int32_t>::max(), std::memory_order_relaxed);
+    });
+
+    // The source is read only, so relaxed ordering is enough for the slots, the join of parallel_for publishes them.
+    parallel_for(inputLen, [&](size_t i) {
+        const T val = srcDataPtr[i];
+        const int32_t idx = static_cast<int32_t>(i);
+        size_t slot = (keyBits(val) * static_cast<uint64_t>(0x9E3779B97F4A7C15ull)) >> hashShift;
+        while (true) {
+            int32_t key = slotKey[slot].load(std::memory_order_relaxed);
+            if (key < 0 && slotKey[slot].compare_exchange_strong(key, idx, std::memory_order_relaxed)) {
+                break;
+            }
+            if (srcDataPtr[key] == val) {
+                break;
+            }
+            slot = (slot + 1) & slotMask;
         }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
+        slotOf[i] = static_cast<int32_t>(slot);
+        int32_t first = slotFirst[slot].load(std::memory_order_relaxed);
+        while (idx < first && !slotFirst[slot].compare_exchange_weak(first, idx, std::memory_order_relaxed)) {
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
+    });
+
+    // The unique values are numbered in the order of their first occurrence.
+    const int nChunks = getChunksNum(inputLen);
+    std::vector<size_t> chunkUniques(nChunks + 1, 0lu);
+    parallel_for(nChunks, [&](int c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, nChunks, c, start, end);
+        for (size_t i = start; i < end; i++) {
+            chunkUniques[c + 1] += slotFirst[slotOf[i]].load(std::memory_order_relaxed) == static_cast<int32_t>(i);
         }
-        uniqueLen = 1;
-
-        for (size_t i = 1; i < inputLen; i++) {
-            bool found = false;
-            size_t j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
+    });
+    std::partial_sum(chunkUniques.begin(), chunkUniques.end(), chunkUniques.begin());
+    uniqueLen = chunkUniques[nChunks];
+
+    redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
+
+    T* uniDataPtr = definedOutputs[UNIQUE_DATA] ? getDstDataAtPortAs<T>(UNIQUE_DATA) : nullptr;
+    int* firstPtr = definedOutputs[FIRST_UNIQUE_IDX] ? getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX) : nullptr;
+    int* inToOutPtr = definedOutputs[INPUT_TO_UNIQ_IDX] ? getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX) : nullptr;
+    int* occurPtr = definedOutputs[OCCURRENCES_NUM] ? getDstDataAtPortAs<int>(OCCURRENCES_NUM) : nullptr;
+
+    std::unique_ptr<int32_t[]> slotRank(new int32_t[tableSize]);
+    parallel_for(nChunks, [&](int c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, nChunks, c, start, end);
+        int32_t u = static_cast<int32_t>(chunkUniques[c]);
+        for (size_t i = start; i < end; i++) {
+            const int32_t slot = slotOf[i];
+            if (slotFirst[slot].load(std::memory_order_relaxed) != static_cast<int32_t>(i)) {
+                continue;
             }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
+            slotRank[slot] = u;
+            if (uniDataPtr) {
+                uniDataPtr[u] = srcDataPtr[i];
             }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
+            if (firstPtr) {
+                firstPtr[u] = static_cast<int>(i);
             }
+            u++;
         }
+    });
+
+    if (!inToOutPtr && !occurPtr) {
+        return;
+    }
+    // Few unique values would make shared counters a contention point, so they are counted per thread then.
+    const bool localCounters = occurPtr && uniqueLen * nChunks <= inputLen;
+    std::vector<int32_t> chunkCounters(localCounters ? uniqueLen * nChunks : 0lu, 0);
+    std::unique_ptr<std::atomic<int32_t>[]> slotCount;
+    if (occurPtr && !localCounters) {
+        slotCount.reset(new std::atomic<int32_t>[tableSize]);
+        parallel_for(tableSize, [&](size_t s) {
+            slotCount[s].store(0, std::memory_order_relaxed);
+        });
     }
-
-    redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
-
-    T* uniDataPtr = getDstDataAtPortAs<T>(UNIQUE_DATA);
-    cpu_parallel_memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        int *firstPtr = getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX);
-        cpu_parallel_memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        auto inToOutPtr = getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX);
-        cpu_parallel_memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        auto occurPtr = getDstDataAtPortAs<int>(OCCURRENCES_NUM);
-        cpu_parallel_memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
+    parallel_for(nChunks, [&](int c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, nChunks, c, start, end);
+        int32_t* counters = localCounters ? chunkCounters.data() + c * uniqueLen : nullptr;
+        for (size_t i = start; i < end; i++) {
+            const int32_t slot = slotOf[i];
+            const int32_t u = slotRank[slot];
+            if (inToOutPtr) {
+                inToOutPtr[i] = u;
+            }
+            if (counters) {
+                counters[u]++;
+            } else if (slotCount) {
+                slotCount[slot].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+    if (localCounters) {
+        parallel_for(uniqueLen, [&](size_t u) {
+            int32_t count = 0;
+            for (int c = 0; c < nChunks; c++) {
+                count += chunkCounters[c * uniqueLen + u];
+            }
+            occurPtr[u] = count;
+        });
+    } else if (occurPtr) {
+        parallel_for(tableSize, [&](size_t s) {
+            if (slotKey[s].load(std::memory_order_relaxed) >= 0) {
+                occurPtr[slotRank[s]] = slotCount[s].load(std::memory_order_relaxed);
+            }
+        });
     }
 }
 
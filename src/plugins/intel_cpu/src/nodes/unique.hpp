@@ -30,6 +30,10 @@ private:
     template <typename T>
     void flattenTensorExec();
     template <typename T>
+    void flattenSortedExec(const T* srcDataPtr, size_t inputLen);
+    template <typename T>
+    void flattenHashedExec(const T* srcDataPtr, size_t inputLen);
+    template <typename T>
     void slicedTensorExec();
 
     template<typename T>
@@ -37,6 +41,7 @@ private:
     template<typename T>
     struct slicedExec;
 
+    // Scratch buffers of the sliced mode, the flattened mode writes the outputs directly.
     std::vector<int32_t> firstUniTmp;
     std::vector<int32_t> inToOutTmp;
     std::vector<int32_t> occurTmp;
@@ -97,6 +97,8 @@
 #include "nodes/transpose.h"
 #include "nodes/unique.hpp"
 #include "nodes/causal_mask_preprocess.h"
+#include "nodes/sampling.h"
+#include "nodes/image_preprocess.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -185,6 +187,8 @@ Node::NodesFactory::NodesFactory() : Factory("NodesFactory") {
     INTEL_CPU_NODE(Ngram, Type::Ngram);
     INTEL_CPU_NODE(RoPE, Type::RoPE);
     INTEL_CPU_NODE(CausalMaskPreprocess, Type::CausalMaskPreprocess);
+    INTEL_CPU_NODE(Sampling, Type::Sampling);
+    INTEL_CPU_NODE(ImagePreprocess, Type::ImagePreprocess);
     INTEL_CPU_NODE(Interpolate, Type::Interpolate);
     INTEL_CPU_NODE(Inverse, Type::Inverse);
     INTEL_CPU_NODE(RandomUniform, Type::RandomUniform);
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "paged_batch_scheduler.h"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+PagedBatchScheduler::PagedBatchScheduler(size_t num_blocks, size_t block_size, size_t max_prefill_chunk)
+    : m_block_size(block_size),
+      m_max_prefill_chunk(max_prefill_chunk) {
+    OPENVINO_ASSERT(num_blocks > 0 && block_size > 0, "PagedBatchScheduler expects non-empty KV cache");
+    // blocks are taken from the back, hand out the low numbers first
+    m_free_blocks.resize(num_blocks);
+    for (size_t i = 0; i < num_blocks; i++)
+        m_free_blocks[i] = static_cast<int32_t>(num_blocks - 1 - i);
+}
+
+void PagedBatchScheduler::add_sequence(uint64_t id, size_t prompt_len) {
+    OPENVINO_ASSERT(prompt_len > 0, "PagedBatchScheduler: sequence ", id, " has empty prompt");
+    OPENVINO_ASSERT(!has_sequence(id), "PagedBatchScheduler: sequence ", id, " is already added");
+    Sequence seq;
+    seq.prompt_len = prompt_len;
+    m_sequences.emplace(id, std::move(seq));
+    m_order.push_back(id);
+}
+
+void PagedBatchScheduler::remove_sequence(uint64_t id) {
+    auto it = m_sequences.find(id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedBatchScheduler: unknown sequence ", id);
+    auto& blocks = it->second.blocks;
+    m_free_blocks.insert(m_free_blocks.end(), blocks.rbegin(), blocks.rend());
+    m_sequences.erase(it);
+    m_order.erase(std::find(m_order.begin(), m_order.end(), id));
+}
+
+bool PagedBatchScheduler::has_sequence(uint64_t id) const {
+    return m_sequences.count(id) != 0;
+}
+
+size_t PagedBatchScheduler::next_tokens(const Sequence& seq) const {
+    if (seq.computed >= seq.prompt_len)
+        return 1;
+    auto left = seq.prompt_len - seq.computed;
+    return m_max_prefill_chunk ? std::min(left, m_max_prefill_chunk) : left;
+}
+
+PagedBatchStep PagedBatchScheduler::schedule() {
+    PagedBatchStep step;
+    size_t max_blocks = 0;
+    bool is_prompt = true;
+    for (auto id : m_order) {
+        auto& seq = m_sequences[id];
+        auto tokens = next_tokens(seq);
+        auto blocks_needed = (seq.computed + tokens + m_block_size - 1) / m_block_size;
+        if (blocks_needed > seq.blocks.size() + m_free_blocks.size()) {
+            seq.scheduled = 0;
+            continue;
+        }
+        while (seq.blocks.size() < blocks_needed) {
+            seq.blocks.push_back(m_free_blocks.back());
+            m_free_blocks.pop_back();
+        }
+        seq.scheduled = tokens;
+        step.sequence_ids.push_back(id);
+        step.past_lens.push_back(seq.computed);
+        step.query_lens.push_back(tokens);
+        step.max_query_len = std::max(step.max_query_len, tokens);
+        max_blocks = std::max(max_blocks, seq.blocks.size());
+        is_prompt = is_prompt && seq.computed == 0;
+    }
+
+    auto B = step.sequence_ids.size();
+    auto L1 = step.max_query_len;
+    step.is_prompt = ov::Tensor(ov::element::u8, ov::Shape{});
+    step.slot_mapping = ov::Tensor(ov::element::i32, ov::Shape{B, L1});
+    step.max_context_len = ov::Tensor(ov::element::i32, ov::Shape{});
+    step.context_lens = ov::Tensor(ov::element::i32, ov::Shape{B});
+    step.block_tables = ov::Tensor(ov::element::i32, ov::Shape{B, max_blocks});
+
+    *step.is_prompt.data<uint8_t>() = B > 0 && is_prompt ? 1 : 0;
+    auto* slots = step.slot_mapping.data<int32_t>();
+    auto* context_lens = step.context_lens.data<int32_t>();
+    auto* block_tables = step.block_tables.data<int32_t>();
+    int32_t max_context_len = 0;
+    for (size_t b = 0; b < B; b++) {
+        const auto& seq = m_sequences[step.sequence_ids[b]];
+        for (size_t m = 0; m < L1; m++) {
+            auto pos = seq.computed + m;
+            // padding past the scheduled tokens may run past the last block of the sequence
+            slots[b * L1 + m] =
+                m < seq.scheduled
+                    ? static_cast<int32_t>(seq.blocks[pos / m_block_size] * m_block_size + pos % m_block_size)
+                    : -1;
+        }
+        context_lens[b] = static_cast<int32_t>(seq.computed + seq.scheduled);
+        max_context_len = std::max(max_context_len, context_lens[b]);
+        std::fill(std::copy(seq.blocks.begin(), seq.blocks.end(), block_tables + b * max_blocks),
+                  block_tables + (b + 1) * max_blocks,
+                  0);
+    }
+    *step.max_context_len.data<int32_t>() = max_context_len;
+    return step;
+}
+
+void PagedBatchScheduler::step_done() {
+    for (auto& item : m_sequences) {
+        item.second.computed += item.second.scheduled;
+        item.second.scheduled = 0;
+    }
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
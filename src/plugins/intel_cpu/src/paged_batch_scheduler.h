@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+// Inputs of one PagedAttentionExtension step. Row b of the batch belongs to sequence_ids[b],
+// its query_lens[b] new tokens start at position past_lens[b] and the row is right padded to max_query_len.
+struct PagedBatchStep {
+    std::vector<uint64_t> sequence_ids;
+    std::vector<size_t> past_lens;
+    std::vector<size_t> query_lens;
+    size_t max_query_len = 0;
+
+    ov::Tensor is_prompt;        // u8 [], 1 if no row has computed tokens yet
+    ov::Tensor slot_mapping;     // i32 [B, max_query_len], -1 for padding
+    ov::Tensor max_context_len;  // i32 []
+    ov::Tensor context_lens;     // i32 [B], past_lens + query_lens
+    ov::Tensor block_tables;     // i32 [B, max_blocks_per_sequence]
+};
+
+// Iteration level (continuous) batching on top of the paged KV cache:
+// sequences join with add_sequence() and leave with remove_sequence() between any two steps,
+// schedule() batches the prompt (or a prompt chunk) of new sequences together with one decode
+// token of every running sequence and allocates the cache blocks the step writes to.
+// The KV cache itself is owned by the caller: num_blocks must match the first dimension of the
+// key/value cache tensors passed to the model.
+class PagedBatchScheduler {
+public:
+    // max_prefill_chunk limits the number of prompt tokens of a sequence processed in one step, 0 means no limit
+    PagedBatchScheduler(size_t num_blocks, size_t block_size, size_t max_prefill_chunk = 0);
+
+    void add_sequence(uint64_t id, size_t prompt_len);
+    // releases the cache blocks of the sequence
+    void remove_sequence(uint64_t id);
+    bool has_sequence(uint64_t id) const;
+
+    // sequences which do not get enough free blocks are left out of the step
+    PagedBatchStep schedule();
+    // marks the tokens of the last scheduled step as present in the cache
+    void step_done();
+
+    size_t get_free_blocks() const {
+        return m_free_blocks.size();
+    }
+    size_t get_block_size() const {
+        return m_block_size;
+    }
+
+private:
+    struct Sequence {
+        size_t prompt_len = 0;
+        size_t computed = 0;   // tokens already in the cache
+        size_t scheduled = 0;  // tokens of the pending step
+        std::vector<int32_t> blocks;
+    };
+
+    size_t next_tokens(const Sequence& seq) const;
+
+    size_t m_block_size;
+    size_t m_max_prefill_chunk;
+    std::vector<int32_t> m_free_blocks;
+    // arrival order, defines the row of the sequence in the step
+    std::vector<uint64_t> m_order;
+    std::unordered_map<uint64_t, Sequence> m_sequences;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -19,11 +19,19 @@ public:
 
     IShapeInfer::Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
                               const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
-        const auto& query_dims = input_shapes.front().get();
+        VectorDims query_dims = input_shapes.front().get();
         VectorDims present_kv_dims = input_shapes.back().get();
         const auto& beam_idx_dims = input_shapes.end()[-3].get();
         const auto& permute_axes = m_config.permute_axes;
 
+        if (m_config.fuse_rope) {
+            // source of RoPE -> [B, H, L, S]
+            if (!m_config.rope_slice_q.empty())
+                query_dims[3] = m_config.rope_slice_q[1] - m_config.rope_slice_q[0];
+            if (m_config.rope_input_trans0213)
+                std::swap(query_dims[1], query_dims[2]);
+        }
+
         if (permute_axes.empty()) {
             // [B, H, L, S]
             present_kv_dims[0] = beam_idx_dims[0];
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "image_preprocess.hpp"
+
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::ImagePreprocessNode::ImagePreprocessNode(const OutputVector& args, const Config& cfg)
+    : Op(args),
+      m_config(cfg) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::ImagePreprocessNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ImagePreprocessNode>(new_args, m_config);
+}
+
+void ov::intel_cpu::ImagePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 1 || (m_config.nv12 && get_input_size() == 2),
+                          "Unexpected number of inputs: ",
+                          get_input_size());
+    NODE_VALIDATION_CHECK(this,
+                          m_config.channel_order.size() == 3 && m_config.scale.size() == 3 &&
+                              m_config.shift.size() == 3,
+                          "Channel order, scale and shift must have 3 elements");
+    const auto& image_pshape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, image_pshape.rank().compatible(4), "Image input must be a 4D tensor, got: ", image_pshape);
+
+    const auto batch = image_pshape.rank().is_static() ? image_pshape[0] : ov::Dimension::dynamic();
+    const ov::Dimension channels(3), height(m_config.out_height), width(m_config.out_width);
+    const auto out_pshape = m_config.planar_output ? ov::PartialShape{batch, channels, height, width}
+                                                   : ov::PartialShape{batch, height, width, channels};
+    set_output_type(0, ov::element::f32, out_pshape);
+}
+
+bool ov::intel_cpu::ImagePreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("out_height", m_config.out_height);
+    visitor.on_attribute("out_width", m_config.out_width);
+    visitor.on_attribute("nv12", m_config.nv12);
+    visitor.on_attribute("nv12_bgr", m_config.nv12_bgr);
+    visitor.on_attribute("nv12_round", m_config.nv12_round);
+    visitor.on_attribute("channel_order", m_config.channel_order);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("shift", m_config.shift);
+    visitor.on_attribute("planar_output", m_config.planar_output);
+    visitor.finish_structure();
+    return true;
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The operation is the fused form of the image preprocessing chain produced by ov::preprocess:
+ *
+ *     [NV12 -> RGB/BGR] -> Convert -> [reverse channels] -> bilinear resize -> per channel (x - mean) / scale
+ *         -> [NHWC -> NCHW]
+ *
+ *  Every output pixel is interpolated from the 2x2 nearest source pixels (half_pixel coordinates, edges are
+ *  clamped), NV12 source pixels are converted to RGB on the fly, so the full resolution image is read once
+ *  and is never materialized in another color format or precision.
+ *
+ * Inputs:
+ *     1. Packed image of type T - shape [N, H, W, 3], or NV12 Y plane [N, H, W, 1],
+ *        or single plane NV12 image [N, H * 3 / 2, W, 1].
+ *     2. NV12 UV plane of type T - shape [N, H / 2, W / 2, 2], only for two planes NV12 input.
+ * Outputs:
+ *     1. Normalized image of type FP32 - shape [N, 3, out_height, out_width] when planar_output is true,
+ *        [N, out_height, out_width, 3] otherwise.
+ * Types:
+ *     T - U8 or FP32
+ */
+class ImagePreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("ImagePreprocess", "cpu_plugin_opset");
+
+    ImagePreprocessNode() = default;
+
+    struct Config {
+        size_t out_height = 0;
+        size_t out_width = 0;
+        bool nv12 = false;                               // inputs are NV12 planes instead of a packed image
+        bool nv12_bgr = false;                           // NV12 is converted to BGR, otherwise to RGB
+        bool nv12_round = false;                         // converted NV12 values are rounded like for U8 output
+        std::vector<int64_t> channel_order = {0, 1, 2};  // output channel c is the source channel channel_order[c]
+        std::vector<float> scale = {1.f, 1.f, 1.f};      // y[c] = x[c] * scale[c] + shift[c]
+        std::vector<float> shift = {0.f, 0.f, 0.f};
+        bool planar_output = false;                      // NCHW output, otherwise NHWC
+    };
+
+    ImagePreprocessNode(const OutputVector& args, const Config& cfg);
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "sampling.hpp"
+
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::SamplingNode::SamplingNode(const Output<Node>& logits, const Config& cfg)
+    : Op({logits}),
+      m_config(cfg) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::SamplingNode::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(SamplingNode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::SamplingNode>(new_args.at(0), m_config);
+}
+
+void ov::intel_cpu::SamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(SamplingNode_validate_and_infer_types);
+    const auto& logits_pshape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          logits_pshape.rank().compatible(2),
+                          "Logits input must be a 2D tensor, got: ",
+                          logits_pshape);
+    NODE_VALIDATION_CHECK(this,
+                          m_config.output_type == ov::element::i32 || m_config.output_type == ov::element::i64,
+                          "Output type must be i32 or i64, got: ",
+                          m_config.output_type);
+    NODE_VALIDATION_CHECK(this, m_config.num_samples > 0, "Number of samples must be positive");
+
+    auto batch = logits_pshape.rank().is_static() ? logits_pshape[0] : ov::Dimension::dynamic();
+    set_output_type(0, m_config.output_type, {batch, ov::Dimension(m_config.num_samples)});
+}
+
+bool ov::intel_cpu::SamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(SamplingNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("top_p", m_config.top_p);
+    visitor.on_attribute("top_p_strict", m_config.top_p_strict);
+    visitor.on_attribute("inv_temperature", m_config.inv_temperature);
+    visitor.on_attribute("topk_indices", m_config.topk_indices);
+    visitor.on_attribute("num_samples", m_config.num_samples);
+    visitor.on_attribute("with_replacement", m_config.with_replacement);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
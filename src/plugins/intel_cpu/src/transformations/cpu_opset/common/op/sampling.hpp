@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The operation draws tokens from the distribution defined by a row of logits, it is the fused form of the
+ * sampling tail of generative models:
+ *
+ *     logits * (1 / temperature) -> [TopK] -> Softmax -> [top-p mask] -> Multinomial -> [Gather of TopK indices]
+ *
+ *  top-k keeps the k largest logits (sorted descending), top-p keeps the prefix of the sorted candidates
+ *  whose exclusive cumulative probability does not exceed top_p (or is below top_p if top_p_strict is set).
+ *  Random numbers are generated exactly like in Multinomial, so for the same seeds the fused and the
+ *  unfused subgraphs draw the same samples.
+ *
+ * Inputs:
+ *     1. Logits tensor of type T1 - shape [batch, vocab_size].
+ * Outputs:
+ *     1. Samples tensor of type T2 - shape [batch, num_samples]. The samples are vocabulary ids unless
+ *        top-k is applied without mapping through top-k indices, then they are positions in the sorted top-k.
+ * Types:
+ *     T1 - FP32
+ *     T2 - I32 or I64
+ */
+class SamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("Sampling", "cpu_plugin_opset");
+
+    SamplingNode() = default;
+
+    struct Config {
+        size_t top_k = 0;             // 0 - top-k filtering is not applied
+        float top_p = 1.0f;           // top-p filtering is applied only together with top-k
+        bool top_p_strict = false;    // exclusive cumulative probability must be below top_p, not just not above
+        float inv_temperature = 1.0f; // logits scale
+        bool topk_indices = false;    // map samples to vocabulary ids through top-k indices
+        size_t num_samples = 1;
+        bool with_replacement = false;
+        uint64_t global_seed = 0;
+        uint64_t op_seed = 0;
+        ov::element::Type output_type = ov::element::i32;
+    };
+
+    SamplingNode(const Output<Node>& logits, const Config& cfg);
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -31,9 +31,20 @@ void ov::intel_cpu::ScaledDotProductAttentionWithKVCache::validate_and_infer_typ
     // [present_kv_batch_size]
     auto beam_idx_ps = get_input_partial_shape(input_num - 3);
 
-    auto output_logits = q_ps;
     NODE_VALIDATION_CHECK(this, m_config.output_BLHxS == false);
     NODE_VALIDATION_CHECK(this, q_ps.size() >= 3);
+    if (m_config.fuse_rope) {
+        NODE_VALIDATION_CHECK(this, m_config.permute_axes.empty() && q_ps.size() == 4);
+        // source of RoPE -> [B, H, L1, S]
+        if (!m_config.rope_slice_q.empty()) {
+            NODE_VALIDATION_CHECK(this, m_config.rope_slice_q.size() == 2);
+            q_ps[3] = static_cast<int64_t>(m_config.rope_slice_q[1] - m_config.rope_slice_q[0]);
+        }
+        if (m_config.rope_input_trans0213) {
+            std::swap(q_ps[1], q_ps[2]);
+        }
+    }
+    auto output_logits = q_ps;
     // permute_axes from original to [B, H, L, S]
     const auto& permute_axes = this->m_config.permute_axes;
     if (past_kv_ps.rank().is_static()) {
@@ -78,6 +89,12 @@ bool ov::intel_cpu::ScaledDotProductAttentionWithKVCache::visit_attributes(ov::A
     visitor.on_attribute("is_causal", m_config.is_causal);
     visitor.on_attribute("fuse_concat", m_config.fuse_concat);
     visitor.on_attribute("permute_axes", m_config.permute_axes);
+    visitor.on_attribute("fuse_rope", m_config.fuse_rope);
+    visitor.on_attribute("rope_rotary_ndims", m_config.rope_rotary_ndims);
+    visitor.on_attribute("rope_input_trans0213", m_config.rope_input_trans0213);
+    visitor.on_attribute("rope_slice_q", m_config.rope_slice_q);
+    visitor.on_attribute("rope_slice_k", m_config.rope_slice_k);
+    visitor.on_attribute("rope_gather_position", m_config.rope_gather_position);
     visitor.finish_structure();
     return true;
 }
\ No newline at end of file
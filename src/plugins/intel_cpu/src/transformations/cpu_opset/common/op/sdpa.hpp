@@ -28,6 +28,17 @@ public:
         bool fuse_concat = false;        // fuse (concat->sdp) ==> sdp
         std::vector<size_t> permute_axes; // not empty means input has transpose. output of permutation is [B,H,L,S]
                                          // e.g. [L,B,H,S] -> permute[1, 2, 0, 3] ->[B, H, L, S]
+        bool fuse_rope = false;          // fuse rotate-half (rope->sdp) of q & k, inputs 0/1 are the sources of RoPE
+                                         // and cos, sin[, position_ids] are inserted right before beam_idx
+        size_t rope_rotary_ndims = 0;
+        bool rope_input_trans0213 = false;  // q & k sources are [B, L, H, S]
+        std::vector<size_t> rope_slice_q;   // {start, stop} on the inner-most dimension of q source, empty if not sliced
+        std::vector<size_t> rope_slice_k;   // {start, stop} on the inner-most dimension of k source, empty if not sliced
+        bool rope_gather_position = false;  // position_ids input follows sin
+
+        size_t rope_input_number() const {
+            return fuse_rope ? (rope_gather_position ? 3 : 2) : 0;
+        }
     };
 
     ScaledDotProductAttentionWithKVCache(const OutputVector& args, const Config& cfg);
@@ -0,0 +1,236 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/add.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/convert.hpp>
+#include <openvino/op/divide.hpp>
+#include <openvino/op/interpolate.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/nv12_to_bgr.hpp>
+#include <openvino/op/nv12_to_rgb.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/subtract.hpp>
+#include <openvino/op/transpose.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+constexpr size_t imageRank = 4;
+constexpr size_t imageChannels = 3;
+
+bool hasSingleConsumer(const ov::Output<ov::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool isSource(const ov::Output<ov::Node>& output, bool is_nv12) {
+    const auto& pshape = output.get_partial_shape();
+    const auto type = output.get_element_type();
+    return ov::is_type<ov::op::v0::Parameter>(output.get_node()) && (type == ov::element::u8 || type == ov::element::f32) &&
+           pshape.rank().is_static() && pshape.size() == imageRank &&
+           (is_nv12 || pshape[imageRank - 1] == static_cast<int64_t>(imageChannels));
+}
+
+// ov::preprocess computes some of the indices with shape subgraphs (e.g. Range for reversed channels)
+bool getConstValues(const ov::Output<ov::Node>& output, std::vector<int64_t>& values) {
+    auto constant = ov::util::get_constant_from_source(output);
+    if (!constant)
+        return false;
+    values = constant->cast_vector<int64_t>();
+    return true;
+}
+
+// Constant which is either a scalar or has imageChannels values along the channel axis of a 4D image
+bool getPerChannelValues(const ov::Output<ov::Node>& output, size_t channel_axis, std::vector<float>& values) {
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || !constant->get_element_type().is_real())
+        return false;
+    const auto& shape = constant->get_shape();
+    if (shape.size() > imageRank)
+        return false;
+    const auto size = ov::shape_size(shape);
+    if (size == 1) {
+        values.assign(imageChannels, constant->cast_vector<float>()[0]);
+        return true;
+    }
+    for (size_t i = 0; i < shape.size(); i++) {
+        const auto axis = i + imageRank - shape.size();
+        if (shape[i] != (axis == channel_axis ? imageChannels : 1))
+            return false;
+    }
+    values = constant->cast_vector<float>();
+    return true;
+}
+
+bool isSupportedInterpolate(const std::shared_ptr<InterpolateBase>& interpolate) {
+    const auto& attrs = interpolate->get_attrs();
+    if ((attrs.mode != InterpolateBase::InterpolateMode::LINEAR &&
+         attrs.mode != InterpolateBase::InterpolateMode::LINEAR_ONNX) ||
+        attrs.shape_calculation_mode != InterpolateBase::ShapeCalcMode::SIZES ||
+        attrs.coordinate_transformation_mode != InterpolateBase::CoordinateTransformMode::HALF_PIXEL ||
+        attrs.antialias)
+        return false;
+    auto is_zero = [](size_t pad) {
+        return pad == 0;
+    };
+    if (!std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), is_zero) ||
+        !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), is_zero))
+        return false;
+
+    const auto& in_pshape = interpolate->get_input_partial_shape(0);
+    const auto& out_pshape = interpolate->get_output_partial_shape(0);
+    if (interpolate->get_input_element_type(0) != ov::element::f32 || in_pshape.rank().is_dynamic() ||
+        in_pshape.size() != imageRank || out_pshape[1].is_dynamic() || out_pshape[2].is_dynamic() ||
+        out_pshape[3] != static_cast<int64_t>(imageChannels))
+        return false;
+
+    // only the spatial axes of the NHWC image are resized
+    const size_t axes_idx = ov::is_type<ov::op::v4::Interpolate>(interpolate) ? 3 : 2;
+    if (interpolate->get_input_size() > axes_idx) {
+        std::vector<int64_t> axes;
+        if (!getConstValues(interpolate->input_value(axes_idx), axes) || axes.size() != 2)
+            return false;
+        for (auto& axis : axes)
+            axis = axis < 0 ? axis + static_cast<int64_t>(imageRank) : axis;
+        std::sort(axes.begin(), axes.end());
+        return axes == std::vector<int64_t>{1, 2};
+    }
+    return in_pshape[0].is_static() && in_pshape[0] == out_pshape[0] && in_pshape[3] == out_pshape[3];
+}
+
+}  // namespace
+
+ImagePreprocessFusion::ImagePreprocessFusion() {
+    MATCHER_SCOPE(ImagePreprocessFusion);
+    using namespace ov::pass::pattern;
+
+    auto interpolate_m = wrap_type<ov::op::v4::Interpolate, ov::op::v11::Interpolate>();
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        auto interpolate = ov::as_type_ptr<InterpolateBase>(m.get_match_root());
+        if (!interpolate || transformation_callback(interpolate) || !isSupportedInterpolate(interpolate))
+            return false;
+
+        ImagePreprocessNode::Config config;
+        const auto& out_pshape = interpolate->get_output_partial_shape(0);
+        config.out_height = static_cast<size_t>(out_pshape[1].get_length());
+        config.out_width = static_cast<size_t>(out_pshape[2].get_length());
+
+        // upward: color conversion, precision conversion and channels reordering
+        ov::NodeVector matched = {interpolate};
+        ov::OutputVector sources;
+        auto data = interpolate->input_value(0);
+        bool has_convert = false;
+        while (sources.empty()) {
+            const auto node = data.get_node_shared_ptr();
+            if (isSource(data, false)) {
+                sources.push_back(data);
+                break;
+            }
+            if (!hasSingleConsumer(data))
+                return false;
+
+            if (auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(node)) {
+                std::vector<int64_t> indices, axis;
+                if (gather->get_batch_dims() != 0 || !getConstValues(gather->input_value(2), axis) ||
+                    axis.size() != 1 || (axis[0] != 3 && axis[0] != -1) ||
+                    !getConstValues(gather->input_value(1), indices) || indices.size() != imageChannels)
+                    return false;
+                for (auto& idx : config.channel_order) {
+                    const auto src_idx = indices[idx];
+                    if (src_idx < 0 || src_idx >= static_cast<int64_t>(imageChannels))
+                        return false;
+                    idx = src_idx;
+                }
+            } else if (ov::is_type<ov::op::v0::Convert>(node) && !has_convert) {
+                const auto src_type = node->get_input_element_type(0);
+                if (src_type != ov::element::u8 && src_type != ov::element::f32)
+                    return false;
+                has_convert = true;
+            } else if (ov::is_type<ov::op::v8::NV12toRGB>(node) || ov::is_type<ov::op::v8::NV12toBGR>(node)) {
+                for (const auto& plane : node->input_values()) {
+                    if (!isSource(plane, true))
+                        return false;
+                    sources.push_back(plane);
+                }
+                config.nv12 = true;
+                config.nv12_bgr = ov::is_type<ov::op::v8::NV12toBGR>(node);
+                config.nv12_round = node->get_output_element_type(0).is_integral();
+            } else {
+                return false;
+            }
+            matched.push_back(node);
+            data = node->input_value(0);
+        }
+
+        // downward: per channel normalization and layout conversion
+        std::shared_ptr<ov::Node> root = interpolate;
+        size_t channel_axis = imageRank - 1;
+        while (hasSingleConsumer(root->output(0))) {
+            const auto consumer = root->get_output_target_inputs(0).begin()->get_node()->shared_from_this();
+            if (auto transpose = ov::as_type_ptr<ov::op::v1::Transpose>(consumer)) {
+                std::vector<int64_t> order;
+                if (config.planar_output || !getConstValues(transpose->input_value(1), order) || order != std::vector<int64_t>{0, 3, 1, 2})
+                    break;
+                config.planar_output = true;
+                channel_axis = 1;
+            } else if (ov::is_type<ov::op::v1::Subtract>(consumer) || ov::is_type<ov::op::v1::Add>(consumer) ||
+                       ov::is_type<ov::op::v1::Multiply>(consumer) || ov::is_type<ov::op::v1::Divide>(consumer)) {
+                const bool is_commutative = ov::is_type<ov::op::v1::Add>(consumer) || ov::is_type<ov::op::v1::Multiply>(consumer);
+                const size_t data_idx = consumer->input_value(0) == root->output(0) ? 0 : 1;
+                std::vector<float> values;
+                if ((data_idx != 0 && !is_commutative) || consumer->get_output_element_type(0) != ov::element::f32 ||
+                    consumer->get_output_partial_shape(0) != root->get_output_partial_shape(0) ||
+                    !getPerChannelValues(consumer->input_value(1 - data_idx), channel_axis, values))
+                    break;
+                if (ov::is_type<ov::op::v1::Divide>(consumer) &&
+                    std::any_of(values.begin(), values.end(), [](float value) { return value == 0.f; }))
+                    break;
+                for (size_t c = 0; c < imageChannels; c++) {
+                    if (ov::is_type<ov::op::v1::Subtract>(consumer)) {
+                        config.shift[c] -= values[c];
+                    } else if (ov::is_type<ov::op::v1::Add>(consumer)) {
+                        config.shift[c] += values[c];
+                    } else if (ov::is_type<ov::op::v1::Multiply>(consumer)) {
+                        config.scale[c] *= values[c];
+                        config.shift[c] *= values[c];
+                    } else {
+                        config.scale[c] /= values[c];
+                        config.shift[c] /= values[c];
+                    }
+                }
+            } else {
+                break;
+            }
+            matched.push_back(consumer);
+            root = consumer;
+        }
+
+        auto preprocess = std::make_shared<ImagePreprocessNode>(sources, config);
+        preprocess->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(matched, preprocess);
+        ov::replace_node(root, preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(interpolate_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
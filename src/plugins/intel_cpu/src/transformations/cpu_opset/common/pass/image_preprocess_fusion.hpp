@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fuses the image preprocessing chain applied to a model input into a single ImagePreprocess node:
+ *
+ *     Parameter(s) -> [NV12toRGB/BGR] -> [Convert] -> [Gather (reverse channels)] -> Interpolate (bilinear)
+ *         -> [per channel Subtract/Add/Multiply/Divide]* -> [Transpose NHWC -> NCHW]
+ *
+ * Must run before the common optimizations reshape the chain (eltwise decomposition, transposes sinking).
+ */
+class ImagePreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ImagePreprocessFusion", "0");
+    ImagePreprocessFusion();
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
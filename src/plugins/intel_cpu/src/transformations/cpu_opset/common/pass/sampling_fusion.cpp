@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling_fusion.hpp"
+
+#include <openvino/core/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/op/cum_sum.hpp>
+#include <openvino/op/divide.hpp>
+#include <openvino/op/gather.hpp>
+#include <openvino/op/gather_elements.hpp>
+#include <openvino/op/greater.hpp>
+#include <openvino/op/less.hpp>
+#include <openvino/op/multinomial.hpp>
+#include <openvino/op/multiply.hpp>
+#include <openvino/op/select.hpp>
+#include <openvino/op/softmax.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/op/util/topk_base.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "itt.hpp"
+#include "transformations/cpu_opset/common/op/sampling.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+bool getScalar(const ov::Output<ov::Node>& output, float& value) {
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    return constant && ov::op::util::get_single_value(constant, value);
+}
+
+// axis of a 2D tensor that points to the vocabulary dimension
+bool isLastAxis(int64_t axis) {
+    return axis == 1 || axis == -1;
+}
+
+bool isLastAxis(const ov::Output<ov::Node>& output) {
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || ov::shape_size(constant->get_shape()) != 1)
+        return false;
+    return isLastAxis(constant->cast_vector<int64_t>()[0]);
+}
+
+// Select(Greater(CumSum(probs, exclusive), p), 0, probs) or Select(Less(CumSum(probs, exclusive), p), probs, 0),
+// the latter keeps candidates strictly below p
+bool matchTopP(const std::shared_ptr<ov::Node>& node,
+               ov::Output<ov::Node>& probs,
+               float& top_p,
+               bool& strict,
+               ov::NodeVector& matched) {
+    auto select = ov::as_type_ptr<ov::op::v1::Select>(node);
+    if (!select)
+        return false;
+    const auto mask = select->get_input_node_shared_ptr(0);
+    const bool is_greater = ov::is_type<ov::op::v1::Greater>(mask);
+    if (!is_greater && !ov::is_type<ov::op::v1::Less>(mask))
+        return false;
+
+    probs = select->input_value(is_greater ? 2 : 1);
+    float zero = 0.f;
+    if (!getScalar(select->input_value(is_greater ? 1 : 2), zero) || zero != 0.f)
+        return false;
+
+    auto cumsum = ov::as_type_ptr<ov::op::v0::CumSum>(mask->get_input_node_shared_ptr(0));
+    if (!cumsum || !cumsum->is_exclusive() || cumsum->is_reverse() || cumsum->input_value(0) != probs ||
+        !isLastAxis(cumsum->input_value(1)))
+        return false;
+    if (!getScalar(mask->input_value(1), top_p) || top_p < 0.f)
+        return false;
+    strict = !is_greater;
+    // nothing is below zero, the whole distribution would be masked out
+    if (strict && top_p == 0.f)
+        return false;
+
+    matched.insert(matched.end(), {select, mask, cumsum});
+    return true;
+}
+
+}  // namespace
+
+SamplingFusion::SamplingFusion() {
+    MATCHER_SCOPE(SamplingFusion);
+    using namespace ov::pass::pattern;
+
+    auto multinomial_m = wrap_type<ov::op::v13::Multinomial>({any_input(rank_equals(2)), wrap_type<ov::op::v0::Constant>()});
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        auto multinomial = ov::as_type_ptr<ov::op::v13::Multinomial>(m.get_match_root());
+        if (!multinomial || transformation_callback(multinomial) || multinomial->get_log_probs())
+            return false;
+
+        SamplingNode::Config config;
+        config.with_replacement = multinomial->get_with_replacement();
+        config.global_seed = multinomial->get_global_seed();
+        config.op_seed = multinomial->get_op_seed();
+        config.output_type = multinomial->get_convert_type();
+
+        auto num_samples = ov::as_type_ptr<ov::op::v0::Constant>(multinomial->get_input_node_shared_ptr(1));
+        if (ov::shape_size(num_samples->get_shape()) != 1)
+            return false;
+        const auto samples = num_samples->cast_vector<int64_t>()[0];
+        if (samples <= 0)
+            return false;
+        config.num_samples = static_cast<size_t>(samples);
+
+        ov::NodeVector matched = {multinomial};
+        auto probs = multinomial->input_value(0);
+        const bool has_top_p =
+            matchTopP(probs.get_node_shared_ptr(), probs, config.top_p, config.top_p_strict, matched);
+
+        const auto softmax = probs.get_node_shared_ptr();
+        if (auto softmax_v1 = ov::as_type_ptr<ov::op::v1::Softmax>(softmax)) {
+            if (!isLastAxis(static_cast<int64_t>(softmax_v1->get_axis())))
+                return false;
+        } else if (auto softmax_v8 = ov::as_type_ptr<ov::op::v8::Softmax>(softmax)) {
+            if (!isLastAxis(softmax_v8->get_axis()))
+                return false;
+        } else {
+            return false;
+        }
+        matched.push_back(softmax);
+
+        auto logits = softmax->input_value(0);
+        auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(logits.get_node_shared_ptr());
+        if (topk) {
+            if (logits.get_index() != 0 || topk->get_mode() != ov::op::TopKMode::MAX ||
+                topk->get_sort_type() != ov::op::TopKSortType::SORT_VALUES ||
+                !isLastAxis(topk->get_provided_axis()) ||
+                !ov::is_type<ov::op::v0::Constant>(topk->get_input_node_ptr(1)) || topk->get_k() == 0)
+                return false;
+            config.top_k = topk->get_k();
+            logits = topk->input_value(0);
+            matched.push_back(topk);
+        } else if (has_top_p) {
+            // top-p is defined on the sorted probabilities, TopK provides the sort
+            return false;
+        }
+
+        if (ov::is_type<ov::op::v1::Multiply>(logits.get_node()) || ov::is_type<ov::op::v1::Divide>(logits.get_node())) {
+            const auto scale = logits.get_node_shared_ptr();
+            const bool is_divide = ov::is_type<ov::op::v1::Divide>(scale);
+            float value = 0.f;
+            size_t data_idx = 0;
+            if (getScalar(scale->input_value(1), value)) {
+                data_idx = 0;
+            } else if (!is_divide && getScalar(scale->input_value(0), value)) {
+                data_idx = 1;
+            } else {
+                return false;
+            }
+            if (value <= 0.f)
+                return false;
+            config.inv_temperature = is_divide ? 1.f / value : value;
+            logits = scale->input_value(data_idx);
+            matched.push_back(scale);
+        }
+
+        if (logits.get_partial_shape().rank() != 2 || !logits.get_element_type().is_real())
+            return false;
+
+        // samples indexing sorted top-k candidates are usually mapped back to vocabulary ids right away
+        std::shared_ptr<ov::Node> root = multinomial;
+        const auto& consumers = multinomial->get_output_target_inputs(0);
+        if (topk && consumers.size() == 1) {
+            const auto gather = consumers.begin()->get_node()->shared_from_this();
+            bool is_mapping = false;
+            if (auto gather_base = ov::as_type_ptr<ov::op::util::GatherBase>(gather)) {
+                const auto batch_dims = gather_base->get_batch_dims();
+                is_mapping = isLastAxis(gather_base->get_axis()) && (batch_dims == 1 || batch_dims == -1);
+            } else if (auto gather_elements = ov::as_type_ptr<ov::op::v6::GatherElements>(gather)) {
+                is_mapping = isLastAxis(gather_elements->get_axis());
+            }
+            if (is_mapping && gather->input_value(0) == topk->output(1) && gather->input_value(1) == multinomial->output(0)) {
+                config.topk_indices = true;
+                config.output_type = topk->get_index_element_type();
+                root = gather;
+                matched.push_back(gather);
+            }
+        }
+
+        auto sampling = std::make_shared<SamplingNode>(logits, config);
+        sampling->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(matched, sampling);
+        ov::replace_node(root, sampling);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(multinomial_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
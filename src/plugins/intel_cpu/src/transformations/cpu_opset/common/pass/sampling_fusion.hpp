@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fuses the token sampling tail into a single Sampling node:
+ *
+ *     logits -> [Multiply/Divide by temperature] -> [TopK] -> Softmax -> [top-p Select] -> Multinomial
+ *            -> [Gather/GatherElements of the TopK indices by the samples]
+ *
+ * The top-p mask is expected in the form Select(Greater(CumSum(probs, exclusive), p), 0, probs)
+ * (or the equivalent Select(Less(...), probs, 0)) on top of sorted TopK probabilities.
+ */
+class SamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SamplingFusion", "0");
+    SamplingFusion();
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
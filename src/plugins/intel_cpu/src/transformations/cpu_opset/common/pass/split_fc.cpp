@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <numeric>
+
 #include "openvino/core/rt_info.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/pass/constant_folding.hpp"
@@ -19,6 +21,141 @@
 
 #include "itt.hpp"
 
+ov::OutputVector ov::intel_cpu::split_decompressed_weights(const std::shared_ptr<ov::Node>& fc_weight_node,
+                                                           size_t split_dim,
+                                                           const std::vector<int>& split_parts) {
+    // INT4 model should consider two patterns, including with Reshape Node and without Reshape Node.
+    const auto reshape_node = ov::as_type_ptr<ov::op::v1::Reshape>(fc_weight_node);
+    const auto multiply_node = reshape_node ? reshape_node->get_input_node_shared_ptr(0) : fc_weight_node;
+    if (!ov::is_type<ov::op::v1::Multiply>(multiply_node)) {
+        return {};
+    }
+    auto multiply_pattern = multiply_node->get_input_node_shared_ptr(1);
+    if (!ov::is_type<ov::op::v0::Constant>(multiply_pattern)) {
+        return {};
+    }
+    auto subtract_node = multiply_node->get_input_node_shared_ptr(0);
+    if (!ov::is_type<ov::op::v1::Subtract>(subtract_node)) {
+        return {};
+    }
+    auto convert_node1 = subtract_node->get_input_node_shared_ptr(1);
+    if (!ov::is_type<ov::op::v0::Convert>(convert_node1)) {
+        return {};
+    }
+    auto convert_node1_const = ov::as_type_ptr<ov::op::v0::Constant>(convert_node1->get_input_node_shared_ptr(0));
+    if (!convert_node1_const) {
+        return {};
+    }
+    auto convert_node0 = subtract_node->get_input_node_shared_ptr(0);
+    if (!ov::is_type<ov::op::v0::Convert>(convert_node0)) {
+        return {};
+    }
+    auto wgt_item = convert_node0->get_input_node_shared_ptr(0);
+    auto cvt_prec = convert_node0->get_element_type();
+
+    const auto& wgt_shape = wgt_item->get_shape();
+    const auto& fc_wgt_shape = fc_weight_node->get_shape();
+    if (fc_wgt_shape.size() != 2 || split_dim >= fc_wgt_shape.size() || split_dim >= wgt_shape.size()) {
+        return {};
+    }
+
+    // Grouped weights [OC, G, IC / G] are reshaped to [OC, IC] after decompression, so the split by
+    // input channels goes along the groups and must not break a group.
+    std::vector<int> wgt_split_parts(split_parts);
+    if (split_dim == 1 && wgt_shape.size() == 3) {
+        const auto group_size = static_cast<int>(wgt_shape[2]);
+        for (auto& part : wgt_split_parts) {
+            if (part % group_size != 0) {
+                return {};
+            }
+            part /= group_size;
+        }
+    }
+    const auto split_dim_range = wgt_shape[split_dim];
+    if (std::accumulate(wgt_split_parts.begin(), wgt_split_parts.end(), size_t(0)) != split_dim_range) {
+        return {};
+    }
+    const auto split_num = wgt_split_parts.size();
+
+    // We should use VariadicSplit to split the input for FC.
+    auto split_dim_node = std::make_shared<ov::op::v0::Constant>(ov::element::i32, ov::Shape{}, split_dim);
+    auto split_length = ov::op::v0::Constant::create<int32_t>(ov::element::i32, ov::Shape{split_num}, wgt_split_parts);
+
+    auto split_constants = [&](const std::shared_ptr<ov::Node>& constant) {
+        static const std::set<ov::element::Type> unsupported_by_split_element_types{ov::element::u4, ov::element::i4, ov::element::nf4};
+        const auto& constant_precision = constant->get_output_element_type(0);
+        if (unsupported_by_split_element_types.count(constant_precision) == 0) {
+            auto split = std::make_shared<ov::op::v1::VariadicSplit>(constant, split_dim_node, split_length);
+            return split->outputs();
+        }
+
+        auto convert = std::make_shared<ov::op::v0::Convert>(constant, ov::element::i8);
+        auto split = std::make_shared<ov::op::v1::VariadicSplit>(convert, split_dim_node, split_length);
+        ov::OutputVector res(split->get_output_size());
+        for (size_t i = 0; i < split->get_output_size(); ++i) {
+            res[i] = std::make_shared<ov::op::v0::Convert>(split->output(i), constant_precision);
+        }
+        return res;
+    };
+
+    // Zero points and scales are split along with the weights, unless they are broadcast along the split dimension.
+    auto split_or_share_constants = [&](const std::shared_ptr<ov::Node>& constant, ov::OutputVector& res) {
+        const auto& shape = constant->get_output_shape(0);
+        if (ov::shape_size(shape) > 1 && shape.size() == wgt_shape.size() && shape[split_dim] == split_dim_range) {
+            res = split_constants(constant);
+        } else if (ov::shape_size(shape) == 1 || (shape.size() == wgt_shape.size() && shape[split_dim] == 1)) {
+            res.resize(split_num);
+            for (auto& part : res) {
+                part = constant->clone_with_new_inputs({});
+            }
+        } else {
+            return false;
+        }
+        return true;
+    };
+
+    auto split_wgts = split_constants(wgt_item);
+    ov::OutputVector split_muls;
+    ov::OutputVector split_cvts;
+    if (!split_or_share_constants(multiply_pattern, split_muls) ||
+        !split_or_share_constants(convert_node1_const, split_cvts)) {
+        return {};
+    }
+
+    std::vector<int32_t> reshape_vec;
+    if (reshape_node) {
+        auto reshape_pattern = reshape_node->get_input_node_shared_ptr(1);
+        auto reshape_const = ov::as_type_ptr<ov::op::v0::Constant>(reshape_pattern);
+        if (!reshape_const) {
+            return {};
+        }
+        reshape_vec = reshape_const->cast_vector<int32_t>();
+        if (reshape_vec.size() != 2) {
+            return {};
+        }
+    }
+
+    ov::OutputVector wgt_node_vec(split_num);
+    for (size_t i = 0; i < split_num; ++i) {
+        auto sub_parent0 = std::make_shared<ov::op::v0::Convert>(split_wgts[i], cvt_prec);
+        auto sub_parent1 = std::make_shared<ov::op::v0::Convert>(split_cvts[i], cvt_prec);
+        ov::pass::disable_constant_folding(sub_parent0);
+        ov::pass::disable_constant_folding(sub_parent1);
+        auto sub_node = std::make_shared<ov::op::v1::Subtract>(sub_parent0, sub_parent1);
+
+        auto mul_node = std::make_shared<ov::op::v1::Multiply>(sub_node, split_muls[i]);
+        if (reshape_node) {
+            std::vector<int32_t> split_reshape_pattern(reshape_vec);
+            split_reshape_pattern[split_dim] = split_parts[i];
+            auto reshape_pattern = ov::op::v0::Constant::create<int32_t>(ov::element::i32, ov::Shape{2}, split_reshape_pattern);
+            wgt_node_vec[i] = std::make_shared<ov::op::v1::Reshape>(mul_node, reshape_pattern, reshape_node->get_special_zero());
+        } else {
+            wgt_node_vec[i] = mul_node;
+        }
+    }
+    return wgt_node_vec;
+}
+
 ov::intel_cpu::SplitFC::SplitFC(int sub_stream_num) {
     MATCHER_SCOPE(SplitFC);
     auto fc_m = ov::pass::pattern::wrap_type<ov::intel_cpu::FullyConnectedNode>();
@@ -65,102 +202,11 @@ ov::intel_cpu::SplitFC::SplitFC(int sub_stream_num) {
         // 2. If the model is NOT INT4 format, split the weight.
         std::vector<ov::Output<ov::Node>> wgt_node_vec(split_num);
         if (ov::is_type<ov::op::v1::Multiply>(fc_weight_node) || ov::is_type<ov::op::v1::Reshape>(fc_weight_node)) {
-            // INT4 model should consider two patterns, including with Reshape Node and without Reshape Node.
-            const auto reshape_node = ov::as_type_ptr<ov::op::v1::Reshape>(fc_weight_node);
-            const auto multiply_node = reshape_node ? reshape_node->get_input_node_shared_ptr(0) : fc_weight_node;
-            if (!ov::is_type<ov::op::v1::Multiply>(multiply_node)) {
-                return false;
-            }
-            auto multiply_pattern = multiply_node->get_input_node_shared_ptr(1);
-            if (!ov::is_type<ov::op::v0::Constant>(multiply_pattern)) {
-                return false;
-            }
-            auto subtract_node = multiply_node->get_input_node_shared_ptr(0);
-            if (!ov::is_type<ov::op::v1::Subtract>(subtract_node)) {
+            wgt_node_vec =
+                split_decompressed_weights(fc_weight_node, split_dim, split_parts(wgt_shape[split_dim], split_num));
+            if (wgt_node_vec.empty()) {
                 return false;
             }
-            auto convert_node1 = subtract_node->get_input_node_shared_ptr(1);
-            if (!ov::is_type<ov::op::v0::Convert>(convert_node1)) {
-                return false;
-            }
-            auto convert_node1_const = ov::as_type_ptr<ov::op::v0::Constant>(convert_node1->get_input_node_shared_ptr(0));
-            if (!convert_node1_const) {
-                return false;
-            }
-            auto convert_node0 = subtract_node->get_input_node_shared_ptr(0);
-            if (!ov::is_type<ov::op::v0::Convert>(convert_node0)) {
-                return false;
-            }
-            auto wgt_item = convert_node0->get_input_node_shared_ptr(0);
-            auto cvt_prec = convert_node0->get_element_type();
-
-            auto split_dim_range = wgt_item->get_shape()[split_dim];
-            const auto& convert_node1_shape = convert_node1->get_shape();
-            bool need_to_split_convert = ov::shape_size(convert_node1_shape) > 1 &&
-                                         split_dim < convert_node1_shape.size() &&
-                                         convert_node1_shape[split_dim] == split_dim_range;
-
-            // We should use VariadicSplit to split the input for FC.
-            std::vector<std::vector<int32_t>> split_reshape_pattern_vec(split_num);
-            auto fc_dim_vec = split_parts(split_dim_range, split_num);
-            auto split_length = ov::op::v0::Constant::create<int32_t>(ov::element::i32, ov::Shape{static_cast<size_t>(split_num)}, fc_dim_vec);
-
-            auto split_constants = [&](const std::shared_ptr<ov::Node>& constant) {
-                static const std::set<ov::element::Type> unsupported_by_split_element_types{ov::element::u4, ov::element::i4, ov::element::nf4};
-                const auto& constant_precision = constant->get_output_element_type(0);
-                if (unsupported_by_split_element_types.count(constant_precision) == 0) {
-                    auto split = std::make_shared<ov::op::v1::VariadicSplit>(constant, split_dim_node, split_length);
-                    return split->outputs();
-                }
-
-                auto convert = std::make_shared<ov::op::v0::Convert>(constant, ov::element::i8);
-                auto split = std::make_shared<ov::op::v1::VariadicSplit>(convert, split_dim_node, split_length);
-                ov::OutputVector res(split->get_output_size());
-                for (size_t i = 0; i < split->get_output_size(); ++i) {
-                    res[i] = std::make_shared<ov::op::v0::Convert>(split->output(i), constant_precision);
-                }
-                return res;
-            };
-
-            auto split_wgts = split_constants(wgt_item);
-            auto split_muls = split_constants(multiply_pattern);
-            ov::OutputVector split_cvts;
-            if (need_to_split_convert) {
-                split_cvts = split_constants(convert_node1_const);
-            }
-
-            if (reshape_node) {
-                auto reshape_pattern = reshape_node->get_input_node_shared_ptr(1);
-                auto reshape_const = ov::as_type_ptr<ov::op::v0::Constant>(reshape_pattern);
-                if (!reshape_const) {
-                    return false;
-                }
-                const auto reshape_vec = reshape_const->cast_vector<int32_t>();
-                for (int i = 0; i < split_num; ++i) {
-                    split_reshape_pattern_vec[i] = {fc_dim_vec[i], reshape_vec[1]};
-                }
-            }
-
-            std::vector<ov::Output<ov::Node>> zp_const_vec(split_num);
-            for (int i = 0; i < split_num; ++i) {
-                zp_const_vec[i] = need_to_split_convert ? split_cvts[i] : convert_node1_const->clone_with_new_inputs({});
-            }
-
-            for (int i = 0; i < split_num; ++i) {
-                auto sub_parent0 = std::make_shared<ov::op::v0::Convert>(split_wgts[i], cvt_prec);
-                auto sub_parent1 = std::make_shared<ov::op::v0::Convert>(zp_const_vec[i], cvt_prec);
-                ov::pass::disable_constant_folding(sub_parent0);
-                ov::pass::disable_constant_folding(sub_parent1);
-                auto sub_node = std::make_shared<ov::op::v1::Subtract>(sub_parent0, sub_parent1);
-
-                auto mul_node = std::make_shared<ov::op::v1::Multiply>(sub_node, split_muls[i]);
-                if (reshape_node) {
-                    auto reshape_pattern = ov::op::v0::Constant::create<int32_t>(ov::element::i32, ov::Shape{2}, split_reshape_pattern_vec[i]);
-                    wgt_node_vec[i] = std::make_shared<ov::op::v1::Reshape>(mul_node, reshape_pattern, reshape_node->get_special_zero());
-                } else {
-                    wgt_node_vec[i] = mul_node;
-                }
-            }
         } else {
             // get input
             auto wgt_item = fc_node->get_input_node_shared_ptr(1);
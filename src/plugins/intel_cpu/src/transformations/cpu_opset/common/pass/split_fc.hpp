@@ -77,5 +77,16 @@ public:
     SplitFC(int sub_stream_num);
 };
 
+/*
+ * Splits the FullyConnected weights decompression subgraph
+ *      (Convert(W) - Convert(ZP)) * Scale [-> Reshape]
+ * into split_parts along split_dim of the resulting [OC, IC] weights: the compressed weights, zero points and
+ * scales are split by VariadicSplit and the decompression is repeated for every part.
+ * Returns an empty vector if the weights are not such a subgraph or can't be split this way.
+ */
+ov::OutputVector split_decompressed_weights(const std::shared_ptr<ov::Node>& fc_weight_node,
+                                            size_t split_dim,
+                                            const std::vector<int>& split_parts);
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "split_mlp.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/swish.hpp"
+#include "openvino/op/variadic_split.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/fully_connected.hpp"
+#include "transformations/cpu_opset/common/pass/split_fc.hpp"
+#include "transformations/rt_info/decompression.hpp"
+#include "utils/general_utils.h"
+
+#include "itt.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+bool isActivation(const std::shared_ptr<ov::Node>& node) {
+    return (ov::is_type<ov::op::v4::Swish>(node) && node->get_input_size() == 1) ||
+           ov::is_type<ov::op::v0::Gelu>(node) || ov::is_type<ov::op::v7::Gelu>(node) ||
+           ov::is_type<ov::op::v0::Relu>(node);
+}
+
+bool hasSingleConsumer(const std::shared_ptr<ov::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+std::shared_ptr<ov::Node> asFC(const ov::Output<ov::Node>& output) {
+    auto fc = ov::as_type_ptr<FullyConnectedNode>(output.get_node_shared_ptr());
+    if (!fc || fc->get_rt_info().count("parallelDomain") || !hasSingleConsumer(fc) ||
+        fc->get_input_partial_shape(1).is_dynamic() || fc->get_input_shape(1).size() != 2)
+        return nullptr;
+    return fc;
+}
+
+std::vector<int> splitParts(int len, int n) {
+    int average = len / n;
+    std::vector<int> parts(n, average);
+    parts.back() = len - average * (n - 1);
+    return parts;
+}
+
+// FullyConnected weights [OC, IC] given as a constant, optionally followed by decompression Convert, or as
+// the decompression subgraph of compressed weights with zero points and scales, which is split like SplitFC does
+ov::OutputVector splitWeights(const ov::Output<ov::Node>& weights, size_t dim, const std::vector<int>& parts) {
+    auto node = weights.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v1::Multiply>(node) || ov::is_type<ov::op::v1::Reshape>(node))
+        return split_decompressed_weights(node, dim, parts);
+
+    auto convert = ov::as_type_ptr<ov::op::v0::Convert>(node);
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(convert ? convert->get_input_node_shared_ptr(0) : node);
+    if (!constant || one_of(constant->get_element_type(), ov::element::u4, ov::element::i4, ov::element::nf4))
+        return {};
+
+    auto split_dim = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {dim});
+    auto split_length = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{parts.size()}, parts);
+    auto split = std::make_shared<ov::op::v1::VariadicSplit>(constant, split_dim, split_length);
+    ov::OutputVector result = split->outputs();
+    if (convert) {
+        for (auto& part : result) {
+            auto part_convert = std::make_shared<ov::op::v0::Convert>(part, convert->get_destination_type());
+            if (ov::is_decompression(convert)) {
+                ov::mark_as_decompression(part_convert);
+                ov::pass::disable_constant_folding(part_convert);
+            }
+            part = part_convert;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+SplitMLP::SplitMLP(int sub_stream_num) {
+    MATCHER_SCOPE(SplitMLP);
+    auto down_m = ov::pass::pattern::wrap_type<FullyConnectedNode>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto down = m.get_match_root();
+        if (down->get_rt_info().count("parallelDomain") || down->get_input_partial_shape(1).is_dynamic())
+            return false;
+
+        // the same trade-off weights size as SplitFC uses
+        const auto& down_wgt_shape = down->get_input_shape(1);
+        if (down_wgt_shape.size() != 2 || ov::shape_size(down_wgt_shape) < 6600000)
+            return false;
+
+        // [Multiply(act(FC_gate(X)), FC_up(X))] or act(FC_up(X))
+        std::shared_ptr<ov::Node> gate, act, mul, up;
+        auto hidden = down->get_input_node_shared_ptr(0);
+        if (!hasSingleConsumer(hidden))
+            return false;
+        if (ov::is_type<ov::op::v1::Multiply>(hidden)) {
+            mul = hidden;
+            for (size_t i = 0; i < 2 && !act; i++) {
+                auto candidate = mul->get_input_node_shared_ptr(i);
+                if (isActivation(candidate) && hasSingleConsumer(candidate) && asFC(candidate->input_value(0))) {
+                    act = candidate;
+                    gate = candidate->get_input_node_shared_ptr(0);
+                    up = asFC(mul->input_value(1 - i));
+                }
+            }
+            if (!up || up->input_value(0) != gate->input_value(0) ||
+                mul->get_input_partial_shape(0) != mul->get_input_partial_shape(1))
+                return false;
+        } else if (isActivation(hidden)) {
+            act = hidden;
+            up = asFC(act->input_value(0));
+            if (!up)
+                return false;
+        } else {
+            return false;
+        }
+
+        const auto inner_size = static_cast<int>(up->get_input_shape(1)[0]);
+        if (down_wgt_shape[1] != static_cast<size_t>(inner_size) ||
+            (gate && gate->get_input_shape(1) != up->get_input_shape(1)))
+            return false;
+
+        const int split_num = sub_stream_num + 1;
+        const auto parts = splitParts(inner_size, split_num);
+        const auto up_wgts = splitWeights(up->input_value(1), 0, parts);
+        const auto gate_wgts = gate ? splitWeights(gate->input_value(1), 0, parts) : ov::OutputVector{};
+        const auto down_wgts = splitWeights(down->input_value(1), 1, parts);
+        if (up_wgts.empty() || down_wgts.empty() || (gate && gate_wgts.empty()))
+            return false;
+
+        const auto& src = up->input_value(0);
+        ov::NodeVector partial_results(split_num);
+        std::vector<std::pair<std::shared_ptr<ov::Node>, std::shared_ptr<ov::Node>>> shards;
+        auto shard = [&](const std::shared_ptr<ov::Node>& origin, const ov::OutputVector& inputs) {
+            auto node = origin->clone_with_new_inputs(inputs);
+            shards.emplace_back(node, origin);
+            return node;
+        };
+        for (int i = 0; i < split_num; i++) {
+            auto up_part = shard(up, {src, up_wgts[i]});
+            std::shared_ptr<ov::Node> hidden_part;
+            if (gate) {
+                auto gate_part = shard(gate, {src, gate_wgts[i]});
+                auto act_part = shard(act, {gate_part});
+                hidden_part = mul->get_input_node_shared_ptr(0) == act ? shard(mul, {act_part, up_part})
+                                                                        : shard(mul, {up_part, act_part});
+            } else {
+                hidden_part = shard(act, {up_part});
+            }
+            partial_results[i] = shard(down, {hidden_part, down_wgts[i]});
+        }
+
+        // all-reduce of the partial results
+        std::shared_ptr<ov::Node> sum = partial_results[0];
+        for (int i = 1; i < split_num; i++)
+            sum = std::make_shared<ov::op::v1::Add>(sum, partial_results[i]);
+        if (sum->get_output_partial_shape(0) != down->get_output_partial_shape(0))
+            return false;
+
+        // all shards of one stage are executed in parallel on different sub streams
+        for (auto& s : shards) {
+            ov::copy_runtime_info(s.second, s.first);
+            s.first->get_rt_info()["parallelDomain"] = s.second->get_name();
+        }
+        ov::copy_runtime_info(down, sum);
+        ov::replace_node_update_name(down, sum);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(down_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *      SplitMLP shards the MLP block of a transformer layer between sub streams (tensor parallel):
+ *      up and gate projections are split by output channels, down projection by input channels.
+ *      Every shard computes its part of the activations locally and produces a partial result of the down
+ *      projection, the partial results are summed up at the end. Compared to SplitFC the activations are not
+ *      concatenated after every FullyConnected and the nodes of a shard can stay on one numa node.
+ *      The nodes of the same stage of all shards are marked with one "parallelDomain" to be executed in parallel.
+ *      Only MLP blocks are sharded. Attention is not split by heads: its QKV and output projections are left to
+ *      SplitFC, which concatenates after every FullyConnected, and the KV cache state is not partitioned.
+ *
+ * Before:
+ *
+ *              X
+ *        +-----+-----+
+ *        |           |
+ *   FC(W_gate)   FC(W_up)
+ *        |           |
+ *   Swish/Gelu/Relu  |
+ *        |           |
+ *        +-- [Mul] --+
+ *              |
+ *          FC(W_down)
+ *
+ * After (2 shards):
+ *
+ *                        X
+ *        +-----------+---+-------+-----------+
+ *        |           |           |           |
+ *  FC(W_gate[0]) FC(W_up[0]) FC(W_gate[1]) FC(W_up[1])
+ *        |           |           |           |
+ *   Swish/Gelu/Relu  |      Swish/Gelu/Relu  |
+ *        |           |           |           |
+ *        +-- [Mul] --+           +-- [Mul] --+
+ *              |                       |
+ *      FC(W_down[:, 0])        FC(W_down[:, 1])
+ *              |                       |
+ *              +---------- Add --------+
+ */
+
+class SplitMLP : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SplitMLP", "0");
+    SplitMLP(int sub_stream_num);
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
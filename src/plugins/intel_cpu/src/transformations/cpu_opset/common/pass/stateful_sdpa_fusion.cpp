@@ -19,6 +19,7 @@
 
 #include "itt.hpp"
 #include "ov_ops/type_relaxed.hpp"
+#include "transformations/cpu_opset/common/op/rope.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
 #include "utils/gen_pattern.hpp"
 using namespace ov::gen_pattern;
@@ -240,5 +241,86 @@ StatefulSDPAFusion::StatefulSDPAFusion() {
     this->register_matcher(m, callback);
 }
 
+SDPARoPEFusion::SDPARoPEFusion() {
+    MATCHER_SCOPE(SDPARoPEFusion);
+    using namespace ov::pass::pattern;
+
+    auto sdp = wrap_type<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>();
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto sdp_node = ov::as_type_ptr<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(m.get_match_root());
+        auto config = sdp_node->get_config();
+        if (!config.fuse_concat || config.fuse_rope || !config.permute_axes.empty() || config.output_BLHxS)
+            return false;
+
+        const auto rope_q = ov::as_type_ptr<ov::intel_cpu::RoPENode>(sdp_node->get_input_node_shared_ptr(0));
+        const auto rope_k = ov::as_type_ptr<ov::intel_cpu::RoPENode>(sdp_node->get_input_node_shared_ptr(1));
+        if (!rope_q || !rope_k || rope_q == rope_k)
+            return false;
+        // the rotated q/k are not materialized any more
+        if (rope_q->get_output_target_inputs(0).size() != 1 || rope_k->get_output_target_inputs(0).size() != 1)
+            return false;
+
+        const auto& config_q = rope_q->get_config();
+        const auto& config_k = rope_k->get_config();
+        // only rotate-half mode with q & k sharing the same cos/sin (and position_ids)
+        auto is_rotate_half = [](const ov::intel_cpu::RoPENode::Config& cfg) {
+            return !cfg.is_interleaved && !cfg.is_chatglm && !cfg.is_qwen && cfg.rotary_ndims % 2 == 0;
+        };
+        if (!is_rotate_half(config_q) || !is_rotate_half(config_k))
+            return false;
+        if (config_q.rotary_ndims != config_k.rotary_ndims || config_q.input_trans0213 != config_k.input_trans0213 ||
+            config_q.gather_position_arg_id != config_k.gather_position_arg_id)
+            return false;
+        if (rope_q->get_input_size() != rope_k->get_input_size())
+            return false;
+        for (size_t i = 1; i < rope_q->get_input_size(); i++) {
+            if (rope_q->input_value(i) != rope_k->input_value(i))
+                return false;
+        }
+        for (size_t i = 1; i < 3; i++) {
+            const auto& cos_sin_ps = rope_q->get_input_partial_shape(i);
+            if (rope_q->get_input_element_type(i) != ov::element::f32 || cos_sin_ps.rank().is_dynamic() ||
+                (cos_sin_ps.size() != 2 && cos_sin_ps.size() != 4))
+                return false;
+        }
+        for (const auto& rope : {rope_q, rope_k}) {
+            if (rope->get_input_partial_shape(0).rank() != 4 ||
+                rope->get_input_element_type(0) != rope->get_output_element_type(0))
+                return false;
+        }
+
+        auto slice_of = [](const ov::intel_cpu::RoPENode::Config& cfg) {
+            return cfg.slice_stop > cfg.slice_start ? std::vector<size_t>{cfg.slice_start, cfg.slice_stop}
+                                                    : std::vector<size_t>{};
+        };
+        config.fuse_rope = true;
+        config.rope_rotary_ndims = config_q.rotary_ndims;
+        config.rope_input_trans0213 = config_q.input_trans0213;
+        config.rope_slice_q = slice_of(config_q);
+        config.rope_slice_k = slice_of(config_k);
+        config.rope_gather_position = config_q.gather_position_arg_id > 0;
+
+        // [q, k, v, (mask), (scale), beam_idx, past_k, past_v] =>
+        //   [q_src, k_src, v, (mask), (scale), cos, sin, (position_ids), beam_idx, past_k, past_v]
+        OutputVector args = sdp_node->input_values();
+        args[0] = rope_q->input_value(0);
+        args[1] = rope_k->input_value(0);
+        OutputVector rope_args{rope_q->input_value(1), rope_q->input_value(2)};
+        if (config.rope_gather_position)
+            rope_args.push_back(rope_q->input_value(config_q.gather_position_arg_id));
+        args.insert(args.end() - 3, rope_args.begin(), rope_args.end());
+
+        auto new_node = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(args, config);
+        new_node->set_friendly_name(sdp_node->get_friendly_name());
+        copy_runtime_info({rope_q, rope_k, sdp_node}, new_node);
+        ov::replace_node(sdp_node, new_node);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(sdp, matcher_name);
+    this->register_matcher(m, callback);
+}
+
 }  // namespace intel_cpu
 }  // namespace ov
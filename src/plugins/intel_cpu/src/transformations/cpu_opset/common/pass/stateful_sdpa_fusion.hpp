@@ -14,5 +14,12 @@ public:
     StatefulSDPAFusion();
 };
 
+// fuse rotate-half RoPE of q & k into the stateful SDPA, k is rotated while it's written to the kv cache
+class SDPARoPEFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SDPARoPEFusion", "0");
+    SDPARoPEFusion();
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
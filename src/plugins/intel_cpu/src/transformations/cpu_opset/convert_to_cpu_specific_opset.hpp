@@ -15,6 +15,7 @@
 #include "common/pass/convert_to_swish_cpu.hpp"
 #include "common/pass/move_fc_reshape_to_weights.hpp"
 #include "common/pass/split_fc.hpp"
+#include "common/pass/split_mlp.hpp"
 #include "transformations/convert_precision.hpp"
 #include "transformations/utils/utils.hpp"
 #include "common/pass/rnn_sequences_optimization.hpp"
@@ -35,6 +36,9 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ov::Model> &nGraphFunc, in
     CPU_REGISTER_PASS_X64(manager, MoveFCReshapeToWeights);
     CPU_REGISTER_PASS_X64(manager, ov::pass::Validate);
     if (subStreamNum >= 1) {
+        // MLP blocks are sharded as a whole, the remaining FullyConnected nodes (attention projections included)
+        // are split one by one
+        CPU_REGISTER_PASS_COMMON(manager, SplitMLP, subStreamNum);
         CPU_REGISTER_PASS_COMMON(manager, SplitFC, subStreamNum);
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
     }
@@ -3,13 +3,112 @@
 //
 
 #include "weights_cache.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/system_conf.hpp"
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+constexpr uint64_t kPoly = 0xc96c5795d7870f42;  // reflected ECMA-182 polynomial
+constexpr uint64_t kTopBit = static_cast<uint64_t>(1) << 63;  // x^0 in the reflected representation
+}  // namespace
+
+SimpleDataHash::SimpleDataHash() {
+    for (int i = 0; i < kTableSize; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? kPoly : 0) ^ (c >> 1);
+        table[0][i] = c;
+    }
+    // slice-by-8 tables: table[k][i] is the CRC of byte i followed by k zero bytes
+    for (int i = 0; i < kTableSize; i++) {
+        for (int k = 1; k < kSlices; k++)
+            table[k][i] = table[0][table[k - 1][i] & 0xff] ^ (table[k - 1][i] >> 8);
+    }
+    // x2nTable[n] = x^(2^n) mod P
+    x2nTable[0] = kTopBit >> 1;
+    for (int n = 1; n < kX2NTableSize; n++)
+        x2nTable[n] = multModP(x2nTable[n - 1], x2nTable[n - 1]);
+}
+
+uint64_t SimpleDataHash::update(uint64_t crc, const unsigned char* data, size_t size) const {
+    size_t idx = 0;
+    for (; idx + kSlices <= size; idx += kSlices) {
+        uint64_t word;
+        std::memcpy(&word, data + idx, sizeof(word));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        word = __builtin_bswap64(word);
+#endif
+        crc ^= word;
+        crc = table[7][crc & 0xff] ^ table[6][(crc >> 8) & 0xff] ^
+              table[5][(crc >> 16) & 0xff] ^ table[4][(crc >> 24) & 0xff] ^
+              table[3][(crc >> 32) & 0xff] ^ table[2][(crc >> 40) & 0xff] ^
+              table[1][(crc >> 48) & 0xff] ^ table[0][crc >> 56];
+    }
+    for (; idx < size; idx++)
+        crc = table[0][(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+
+    return crc;
+}
+
+uint64_t SimpleDataHash::multModP(uint64_t a, uint64_t b) const {
+    uint64_t m = kTopBit;
+    uint64_t p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ kPoly : b >> 1;
+    }
+    return p;
+}
+
+uint64_t SimpleDataHash::x2nModP(size_t n, unsigned k) const {
+    uint64_t p = kTopBit;
+    while (n) {
+        if (n & 1)
+            p = multModP(x2nTable[k % kX2NTableSize], p);
+        n >>= 1;
+        k++;
+    }
+    return p;
+}
+
+uint64_t SimpleDataHash::combine(uint64_t crcA, uint64_t crcB, size_t sizeB) const {
+    // shifting by sizeB bytes is a multiplication by x^(8 * sizeB), i.e. x^(2^3 * sizeB)
+    return multModP(x2nModP(sizeB, 3), crcA) ^ crcB;
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    const size_t chunks = size / kChunkSize;
+    if (chunks < 2) {
+        return ~update(0, data, size);
+    }
+
+    std::vector<uint64_t> partial(chunks);
+    parallel_for(chunks, [&](size_t i) {
+        partial[i] = update(0, data + i * kChunkSize, kChunkSize);
+    });
+
+    const uint64_t shiftChunk = x2nModP(kChunkSize, 3);
+    uint64_t crc = partial[0];
+    for (size_t i = 1; i < chunks; i++)
+        crc = multModP(shiftChunk, crc) ^ partial[i];
+
+    const size_t tail = size - chunks * kChunkSize;
+    crc = combine(crc, update(0, data + chunks * kChunkSize, tail), tail);
+
+    return ~crc;
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -25,26 +25,29 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    SimpleDataHash();
+
+    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182.
+    // Large buffers are split into fixed size chunks that are hashed in parallel and then
+    // combined, so the result does not depend on the number of threads or on the host ISA.
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
+    // raw (non-inverted) CRC register update over a contiguous range
+    uint64_t update(uint64_t crc, const unsigned char* data, size_t size) const;
+    // returns CRC register of A||B given registers of A and B and the length of B
+    uint64_t combine(uint64_t crcA, uint64_t crcB, size_t sizeB) const;
+    uint64_t multModP(uint64_t a, uint64_t b) const;
+    uint64_t x2nModP(size_t n, unsigned k) const;
+
     static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr int kSlices = 8;
+    static constexpr int kX2NTableSize = 64;
+    // 1 MiB, small enough to balance the work between threads, large enough to amortize combine()
+    static constexpr size_t kChunkSize = 1 << 20;
+
+    uint64_t table[kSlices][kTableSize];
+    uint64_t x2nTable[kX2NTableSize];
 };
 
 /**
@@ -139,6 +139,25 @@ INSTANTIATE_TEST_SUITE_P(smoke,
                                             ::testing::ValuesIn(indPrecisions),
                                             ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+// bags of very different sizes and empty bags, the work is split between threads by the number of indices
+const auto embBagOffsetSumUnbalancedArgSet =
+    ::testing::Combine(::testing::Values(InputShape{{10, 35}, {{10, 35}}},
+                                         InputShape{{5, 4, 16}, {{5, 4, 16}}}),
+                       ::testing::Values(std::vector<size_t>{0, 1, 2, 3, 4, 4, 3, 2, 1, 0, 1, 3, 0, 2, 4, 1,
+                                                             2, 3, 4, 0, 3, 1, 4, 2, 0, 0, 1, 2, 3, 4, 1}),
+                       ::testing::Values(std::vector<size_t>{0, 24, 24, 25, 26, 26, 28, 30}),
+                       ::testing::Values(size_t(3)),
+                       ::testing::ValuesIn(with_weights),
+                       ::testing::ValuesIn(with_default_index));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Unbalanced,
+                         EmbeddingBagOffsetsSumLayerCPUTest,
+                         ::testing::Combine(embBagOffsetSumUnbalancedArgSet,
+                                            ::testing::Values(ElementType::f32),
+                                            ::testing::Values(ElementType::i32),
+                                            ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -73,6 +73,36 @@ INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttn_CPU,
                          params,
                          ScaledAttnLayerCPUTest::getTestCaseName);
 
+// long prompts take the blocked (flash) attention path of the oneDNN kernel, kv_len is not a multiple of the kv
+// block. f32 goes to the MLAS kernel when it is enabled, so bf16 is tested only.
+const std::vector<std::vector<InputShape>> shapes_flash{
+    {
+        // q shape
+        {ov::test::InputShape{ov::PartialShape{-1, 4, -1, 64},
+            {ov::Shape{1, 4, 1100, 64}, ov::Shape{1, 4, 1, 64}, ov::Shape{2, 4, 1030, 64}}}
+        },
+        // kv shape
+        {ov::test::InputShape{ov::PartialShape{-1, 2, -1, 64},
+            {ov::Shape{1, 2, 1100, 64}, ov::Shape{1, 2, 1, 64}, ov::Shape{2, 2, 1030, 64}}}
+        },
+        // attn shape: [B, 1, -1, L0+L1]
+        {ov::test::InputShape{ov::PartialShape{-1, 1, -1, -1},
+            {ov::Shape{1, 1, 1100, 1100}, ov::Shape{1, 1, 1, 1}, ov::Shape{2, 1, 1030, 1030}}}
+        },
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttn_Flash_CPU,
+                         ScaledAttnLayerCPUTest,
+                         testing::Combine(testing::Values(ElementType::bf16),
+                                          testing::ValuesIn(shapes_flash),
+                                          testing::Values(true, false),
+                                          testing::Values(true, false),
+                                          testing::Values(false),
+                                          testing::Values(ov::test::utils::DEVICE_CPU),
+                                          testing::Values(cpuSpec)),
+                         ScaledAttnLayerCPUTest::getTestCaseName);
+
 }  // namespace ScaledAttn
 }  // namespace test
 }  // namespace ov
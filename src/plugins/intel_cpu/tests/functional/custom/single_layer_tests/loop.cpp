@@ -442,6 +442,74 @@ class StaticLoopDynamicSubgraphCPUTest : public SubgraphBaseTest {
 };
 
 
+using LoopWhileConcatParams = typename std::tuple<
+        int64_t,                                                           // Number of iterations
+        int64_t>;                                                          // Concatenation axis
+
+class LoopWhileConcatCPUTest : public testing::WithParamInterface<LoopWhileConcatParams>,
+                               virtual public SubgraphBaseTest {
+    // trip count is unknown, so the concatenated output buffer can't be preallocated:
+    // i = 0
+    // do
+    //   y = x + i
+    //   i += 1
+    // while (i < num_iterations)
+    // return concat(y)
+
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LoopWhileConcatParams> obj) {
+        int64_t num_iterations, axis;
+        std::tie(num_iterations, axis) = obj.param;
+
+        std::ostringstream result;
+        result << "num_iterations=" << num_iterations << "_";
+        result << "axis=" << axis;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        int64_t num_iterations, axis;
+        std::tie(num_iterations, axis) = this->GetParam();
+
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes({{{-1, 1, 16}, {{3, 1, 16}, {1, 1, 16}, {3, 1, 16}}}});
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0])};
+
+        ov::ParameterVector body_params{std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1}),
+                                        std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 1, 16})};
+
+        auto const_one = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, 1);
+        auto const_num_iterations = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, num_iterations);
+        auto next_idx = std::make_shared<ov::op::v1::Add>(body_params[0], const_one);
+        auto body_cond = std::make_shared<ov::op::v1::Less>(next_idx, const_num_iterations);
+        auto idx = std::make_shared<ov::op::v0::Convert>(body_params[0], ov::element::f32);
+        auto y = std::make_shared<ov::op::v1::Add>(body_params[1], idx);
+
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_cond, next_idx, y}, body_params);
+
+        auto trip_count = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, -1);
+        auto exec_condition = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, true);
+        auto start_idx = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, 0);
+
+        auto loop = std::make_shared<ov::op::v5::Loop>(trip_count, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ov::op::v5::Loop::SpecialBodyPorts{-1, 0});
+
+        loop->set_merged_input(body_params[0], start_idx, next_idx);
+        loop->set_invariant_input(body_params[1], params[0]);
+
+        auto out0 = loop->get_concatenated_slices(y, 0, 1, 1, -1, axis);
+        auto out1 = loop->get_iter_value(next_idx, -1);
+
+        auto result0 = std::make_shared<ov::op::v0::Result>(out0);
+        auto result1 = std::make_shared<ov::op::v0::Result>(out1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result0, result1}, params, "loop");
+    }
+};
+
+
 TEST_P(LoopLayerCPUTest, CompareWithRefs) {
     run();
 }
@@ -458,6 +526,10 @@ TEST_P(LoopForConcatLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+TEST_P(LoopWhileConcatCPUTest, CompareWithRefs) {
+    run();
+}
+
 TEST_F(StaticLoopDynamicSubgraphCPUTest, smoke_StaticLoopWithDynSubgraph) {
     run();
 }
@@ -675,6 +747,13 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcat, LoopForConcatLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the number of iterations exceeds the first buffer chunks, axis 0 and 1 give outer dimension 1 and 3 respectively
+INSTANTIATE_TEST_SUITE_P(smoke_LoopWhileConcat, LoopWhileConcatCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(1, 7, 33),
+                                 ::testing::Values(0, 1)),
+                         LoopWhileConcatCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
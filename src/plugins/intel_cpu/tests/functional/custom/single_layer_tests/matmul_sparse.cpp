@@ -8,6 +8,7 @@
 #include "ov_ops/type_relaxed.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "shared_test_classes/base/utils/generate_inputs.hpp"
+#include "transformations/rt_info/primitives_priority_attribute.hpp"
 #include "utils/fusing_test_utils.hpp"
 
 using namespace CPUTestUtils;
@@ -332,5 +333,181 @@ INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_I8_sparse, MatMulSparseCPUTest, testParams3
 
 } // namespace
 
+/* ============= FullyConnected with structured sparse float weights ============= */
+
+enum class SparsityPattern {
+    blocked,  // zero blocks of 16 output channels x 1 input channel
+    nm        // 2 non zero weights in every 4 input channels of an output channel
+};
+
+inline std::ostream& operator<<(std::ostream& os, SparsityPattern pattern) {
+    return os << (pattern == SparsityPattern::blocked ? "blocked" : "2of4");
+}
+
+typedef std::tuple<
+        ShapeRelatedParams,
+        SparsityPattern,
+        float,                              // rate of zero blocks
+        ov::AnyMap                          // Additional config
+> MatMulStructuredSparseParamSet;
+
+class MatMulStructuredSparseCPUTest : public testing::WithParamInterface<MatMulStructuredSparseParamSet>,
+                                      virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MatMulStructuredSparseParamSet>& obj) {
+        ShapeRelatedParams shapeRelatedParams;
+        SparsityPattern pattern;
+        float zeroBlocksRate;
+        ov::AnyMap additionalConfig;
+        std::tie(shapeRelatedParams, pattern, zeroBlocksRate, additionalConfig) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : shapeRelatedParams.inputShapes) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : shapeRelatedParams.inputShapes) {
+            result << "(";
+            for (const auto& item : shape.second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+            result << ")_";
+        }
+        result << "transpose_b=" << shapeRelatedParams.transpose.second << "_";
+        result << "pattern=" << pattern << "_";
+        result << "zeroBlocksRate=" << zeroBlocksRate;
+        for (const auto& item : additionalConfig) {
+            result << "_" << item.first << "=" << item.second.as<std::string>();
+        }
+        return result.str();
+    }
+
+protected:
+    // weights [N, K] (transposed) or [K, N] with the given sparsity pattern
+    static std::vector<float> generateWeights(size_t N, size_t K, bool transposed, SparsityPattern pattern, float rate) {
+        std::vector<float> res(N * K, 0.f);
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> dist(-1.f, 1.f);
+        std::uniform_real_distribution<float> dist_rate(0.f, 1.f);
+        auto at = [&](size_t n, size_t k) -> float& {
+            return res[transposed ? n * K + k : k * N + n];
+        };
+
+        if (pattern == SparsityPattern::blocked) {
+            for (size_t n = 0; n < N; n += 16) {
+                for (size_t k = 0; k < K; k++) {
+                    if (dist_rate(gen) < rate)
+                        continue;
+                    for (size_t j = n; j < std::min(N, n + 16); j++)
+                        at(j, k) = dist(gen);
+                }
+            }
+        } else {
+            for (size_t n = 0; n < N; n++) {
+                for (size_t k = 0; k < K; k += 4) {
+                    const size_t first = gen() % 4;
+                    const size_t second = (first + 1 + gen() % 3) % 4;
+                    for (size_t j = 0; j < 4 && k + j < K; j++) {
+                        if (j == first || j == second)
+                            at(n, k + j) = dist(gen);
+                    }
+                }
+            }
+        }
+        return res;
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        ShapeRelatedParams shapeRelatedParams;
+        ov::AnyMap additionalConfig;
+        std::tie(shapeRelatedParams, pattern, zeroBlocksRate, additionalConfig) = this->GetParam();
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
+        // the kernels are implemented for f32 activations only
+        configuration.insert(ov::hint::inference_precision(ElementType::f32));
+
+        init_input_shapes(shapeRelatedParams.inputShapes);
+        const bool transposeB = shapeRelatedParams.transpose.second;
+        const auto weightsShape = inputDynamicShapes[1].to_shape();
+        const size_t N = transposeB ? weightsShape[0] : weightsShape[1];
+        const size_t K = transposeB ? weightsShape[1] : weightsShape[0];
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0])};
+        auto weights = std::make_shared<ov::op::v0::Constant>(ElementType::f32,
+                                                              weightsShape,
+                                                              generateWeights(N, K, transposeB, pattern, zeroBlocksRate));
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weights, false, transposeB);
+        function = std::make_shared<ov::Model>(matMul, params, "MatMulStructuredSparse");
+    }
+
+    std::string fullyConnectedImplType() const {
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() == "FullyConnected")
+                return rtInfo.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+        }
+        return {};
+    }
+
+    SparsityPattern pattern;
+    float zeroBlocksRate;
+};
+
+TEST_P(MatMulStructuredSparseCPUTest, CompareWithRefs) {
+    run();
+
+    const auto& lastShape = targetStaticShapes.back()[0];
+    const auto M = ov::shape_size(lastShape) / lastShape.back();
+    // N:M sparse weights are used for GEMV only
+    const bool sparseExpected = ov::with_cpu_x86_avx2() && configuration.count(ov::intel_cpu::sparse_weights_decompression_rate.name()) &&
+                                (pattern == SparsityPattern::blocked || M <= 4);
+    const auto implType = fullyConnectedImplType();
+    ASSERT_EQ(sparseExpected, implType.find("sparse") != std::string::npos) << "Unexpected implementation: " << implType;
+}
+
+TEST_P(MatMulStructuredSparseCPUTest, PrimitivesPriority) {
+    if (!ov::with_cpu_x86_avx2())
+        GTEST_SKIP() << "The structured sparse weights executor requires AVX2";
+    // an explicit oneDNN implementation in primitivesPriority disables the sparse executor
+    const std::string dnnl_priority = ov::with_cpu_x86_avx512_core() ? "cpu:brgemm_avx512" : "cpu:brgemm_avx2";
+    for (const auto& op : function->get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::MatMul>(op))
+            op->get_rt_info()[ov::PrimitivesPriority::get_type_info_static()] = ov::PrimitivesPriority(dnnl_priority);
+    }
+    run();
+
+    const auto implType = fullyConnectedImplType();
+    ASSERT_EQ(implType.find("sparse"), std::string::npos) << "Unexpected implementation: " << implType;
+}
+
+namespace {
+
+const ov::AnyMap SparseRate30 = {{ov::intel_cpu::sparse_weights_decompression_rate(0.3)}};
+
+const std::vector<ShapeRelatedParams> IS_structured_sparse_smoke = {
+    {static_shapes_to_test_representation({{1, 128}, {64, 128}}), {false, true}},
+    {static_shapes_to_test_representation({{3, 61}, {40, 61}}), {false, true}},
+    {static_shapes_to_test_representation({{2, 17, 64}, {64, 72}}), {false, false}},
+    {static_shapes_to_test_representation({{130, 96}, {32, 96}}), {false, true}},
+    {
+        {
+            {{-1, -1}, {{20, 64}, {1, 64}, {4, 64}}},
+            {{48, 64}, {{48, 64}, {48, 64}, {48, 64}}}
+        },
+        {false, true}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_StructuredSparse, MatMulStructuredSparseCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(IS_structured_sparse_smoke),
+                                            ::testing::Values(SparsityPattern::blocked, SparsityPattern::nm),
+                                            ::testing::Values(0.7f),
+                                            ::testing::Values(ov::AnyMap{}, SparseRate30)),
+                         MatMulStructuredSparseCPUTest::getTestCaseName);
+
+} // namespace
+
 }  // namespace test
 }  // namespace ov
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <random>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
@@ -129,6 +131,82 @@ TEST_P(ScatterElementsUpdateLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "ScatterUpdate");
 }
 
+// Segment reduction of many rows into a narrow destination, the number of destination rows sets the collision rate.
+using scatterReduceParams = std::tuple<size_t,  // destination rows
+                                       size_t,  // update rows
+                                       size_t,  // columns
+                                       ov::op::v12::ScatterElementsUpdate::Reduction,
+                                       bool>;   // use_init_val
+
+class ScatterElementsReduceCPUTest : public testing::WithParamInterface<scatterReduceParams>,
+                                     public SubgraphBaseTest,
+                                     public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<scatterReduceParams> obj) {
+        size_t rows, updateRows, columns;
+        ov::op::v12::ScatterElementsUpdate::Reduction reduction;
+        bool useInitVal;
+        std::tie(rows, updateRows, columns, reduction, useInitVal) = obj.param;
+
+        std::ostringstream result;
+        result << "rows=" << rows << "_updateRows=" << updateRows << "_columns=" << columns << "_reduction=" << as_string(reduction)
+               << "_useInitVal=" << useInitVal;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        const auto rows = static_cast<int32_t>(targetInputStaticShapes[0][0]);
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::Tensor tensor;
+            if (i == 1) {
+                tensor = ov::Tensor{ElementType::i32, targetInputStaticShapes[i]};
+                std::mt19937 gen(rows);
+                std::uniform_int_distribution<int32_t> dist(-rows, rows - 1);
+                auto data = tensor.data<std::int32_t>();
+                for (size_t j = 0; j < tensor.get_size(); ++j)
+                    data[j] = dist(gen);
+            } else {
+                // integer values keep the sums exact whatever the order of the reduction is
+                ov::test::utils::InputGenerateData in_data;
+                in_data.start_from = 1;
+                in_data.range = 9;
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], in_data);
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        size_t rows, updateRows, columns;
+        ov::op::v12::ScatterElementsUpdate::Reduction reduction;
+        bool useInitVal;
+        std::tie(rows, updateRows, columns, reduction, useInitVal) = this->GetParam();
+
+        init_input_shapes(static_shapes_to_test_representation(
+            {ov::Shape{rows, columns}, ov::Shape{updateRows, columns}, ov::Shape{updateRows, columns}}));
+        selectedType = makeSelectedTypeStr("unknown", ElementType::f32);
+
+        auto data = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0]);
+        auto indices = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, inputDynamicShapes[1]);
+        auto updates = std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[2]);
+        auto axis = ov::op::v0::Constant::create(ElementType::i32, {}, {0});
+        auto scatter = std::make_shared<ov::op::v12::ScatterElementsUpdate>(data, indices, updates, axis, reduction, useInitVal);
+
+        ov::ParameterVector params{data, indices, updates};
+        function = makeNgraphFunction(ElementType::f32, params, scatter, "ScatterElementsReduceCPUTest");
+    }
+};
+
+TEST_P(ScatterElementsReduceCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "ScatterUpdate");
+}
+
 const std::vector<std::int64_t> axes = {-3, -2, -1, 0, 1, 2};
 
 const std::vector<ScatterElementsUpdateLayerParams> scatterParams = {
@@ -176,5 +254,22 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs,
                                             ::testing::ValuesIn(inputPrecisions),
                                             ::testing::ValuesIn(constantPrecisions)),
                          ScatterElementsUpdateLayerCPUTest::getTestCaseName);
+
+const std::vector<ov::op::v12::ScatterElementsUpdate::Reduction> reductions = {
+    ov::op::v12::ScatterElementsUpdate::Reduction::SUM,
+    ov::op::v12::ScatterElementsUpdate::Reduction::MAX,
+    ov::op::v12::ScatterElementsUpdate::Reduction::MIN,
+    ov::op::v12::ScatterElementsUpdate::Reduction::MEAN,
+};
+
+// 16 destination rows take the private accumulation path, 65536 ones the bucketing by destination
+INSTANTIATE_TEST_SUITE_P(smoke_SegmentReduce,
+                         ScatterElementsReduceCPUTest,
+                         ::testing::Combine(::testing::Values(16, 65536),
+                                            ::testing::Values(65536),
+                                            ::testing::Values(1, 4),
+                                            ::testing::ValuesIn(reductions),
+                                            ::testing::Values(true, false)),
+                         ScatterElementsReduceCPUTest::getTestCaseName);
 }  // namespace test
 }  // namespace ov
@@ -335,6 +335,65 @@ INSTANTIATE_TEST_SUITE_P(smoke_TopK_int32_dynamic,
                                            ::testing::Values(additionalConfig[0])),
                         TopKLayerCPUTest::getTestCaseName);
 
+// long sorting axes with a large k are served by radix select on planar layouts
+const std::vector<int64_t> k_radix_select = {32, 200};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select_innermost = {
+    {{}, {{1, 1, 2, 8192}}},
+};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select_strided = {
+    {{}, {{1, 5000, 1, 3}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix_select = {
+    {{1, 1, {1, 3}, {4096, 10000}}, {{1, 1, 2, 8192}, {1, 1, 3, 5000}}}};
+
+std::vector<CPUSpecificParams> cpuParams_planar = {CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {}),
+                                                   CPUSpecificParams({nhwc, x}, {nhwc, nhwc}, {}, {})};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_radix_select_innermost,
+                        TopKLayerCPUTest,
+                        ::testing::Combine(::testing::Combine(::testing::ValuesIn(k_radix_select),
+                                                              ::testing::Values(3),
+                                                              ::testing::ValuesIn(modes),
+                                                              ::testing::ValuesIn(sortTypeStable),
+                                                              ::testing::Values(ElementType::f32, ElementType::i32),
+                                                              ::testing::Values(ElementType::undefined),
+                                                              ::testing::Values(ElementType::undefined),
+                                                              ::testing::ValuesIn(inputShapes_radix_select_innermost)),
+                                           ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_planar)),
+                                           ::testing::Values(additionalConfig[0])),
+                        TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_radix_select_strided,
+                        TopKLayerCPUTest,
+                        ::testing::Combine(::testing::Combine(::testing::ValuesIn(k_radix_select),
+                                                              ::testing::Values(1),
+                                                              ::testing::ValuesIn(modes),
+                                                              ::testing::ValuesIn(sortTypeStable),
+                                                              ::testing::Values(ElementType::f32, ElementType::i32),
+                                                              ::testing::Values(ElementType::undefined),
+                                                              ::testing::Values(ElementType::undefined),
+                                                              ::testing::ValuesIn(inputShapes_radix_select_strided)),
+                                           ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_planar)),
+                                           ::testing::Values(additionalConfig[0])),
+                        TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_radix_select_dynamic,
+                        TopKLayerCPUTest,
+                        ::testing::Combine(::testing::Combine(::testing::Values(1),
+                                                              ::testing::Values(3),
+                                                              ::testing::ValuesIn(modes),
+                                                              ::testing::ValuesIn(sortTypeStable),
+                                                              ::testing::Values(ElementType::f32),
+                                                              ::testing::Values(ElementType::undefined),
+                                                              ::testing::Values(ElementType::undefined),
+                                                              ::testing::ValuesIn(inputShapesDynamic_radix_select)),
+                                           ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_planar)),
+                                           ::testing::Values(additionalConfig[0])),
+                        TopKLayerCPUTest::getTestCaseName);
+
 std::vector<ov::test::InputShape> inputShapes_bubble_BLK_on_channel_horiz = {
     {{}, {{2, 2, 2, 2}}},
 };
@@ -141,6 +141,28 @@ TEST_P(UniqueLayerTestCPU, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Unique");
 }
 
+// Large flattened inputs with a narrow range of values, so the parallel paths of the flattened mode get several
+// chunks per thread and every value repeats many times across the chunks.
+class UniqueLargeLayerTestCPU : public UniqueLayerTestCPU {
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs()[0];
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -500;
+        in_data.range = 1000;
+        auto tensor = utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[0], in_data);
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(UniqueLargeLayerTestCPU, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckPluginRelatedResults(compiledModel, "Unique");
+}
+
 namespace {
 
 const std::vector<ElementType> dataPrecisionSmoke = {ElementType::f32, ElementType::i32};
@@ -239,6 +261,25 @@ INSTANTIATE_TEST_SUITE_P(nightly_static,
                                             ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
 
+// Sorted mode merges an odd and an even number of chunks, unsorted mode fills the hash table from all threads.
+const std::vector<std::vector<InputShape>> largeShapes = {
+    {{{}, {{3 * 1024 + 5}}}},                           // Static shapes
+    {{{}, {{65536}}}},                                  // Static shapes
+    {{{}, {{4, 16, 32, 33}}}},                          // Static shapes
+    {{{-1, -1},                                         // Dynamic shape
+      {{7, 1024}, {64, 1000}, {3, 5}, {128, 513}}}}     // Target shapes
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_large_flattened,
+                         UniqueLargeLayerTestCPU,
+                         ::testing::Combine(::testing::ValuesIn(largeShapes),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
+
 const std::vector<std::vector<InputShape>> dynamicInSapes = {
     {{{ov::Dimension(1, 15), -1, -1, -1},                             // Dynamic shape
       {{1, 1, 1, 1}, {6, 3, 1, 2}, {4, 5, 3, 1}, {2, 7, 2, 2}}}},     // Target shapes
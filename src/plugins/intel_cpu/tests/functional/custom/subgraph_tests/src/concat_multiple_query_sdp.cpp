@@ -18,7 +18,8 @@ namespace test {
 using InputShapeAndTransposeOrder = std::pair<std::vector<InputShape>, std::vector<size_t>>;
 using ConcatMultiQuerySDPParams = std::tuple<ElementType,
                                              InputShapeAndTransposeOrder,
-                                             bool  // has ShapeOf
+                                             bool,        // has ShapeOf
+                                             ElementType  // kv cache precision, undefined for the default one
                                              >;
 // Subgraph:
 /*                              Parameter
@@ -53,7 +54,8 @@ public:
         ElementType qkvType;
         InputShapeAndTransposeOrder inputShapeAndOrders;
         bool hasShapeof;
-        std::tie(qkvType, inputShapeAndOrders, hasShapeof) = obj.param;
+        ElementType kvCacheType;
+        std::tie(qkvType, inputShapeAndOrders, hasShapeof, kvCacheType) = obj.param;
         std::ostringstream result;
         std::vector<InputShape>& inputShapes = inputShapeAndOrders.first;
         std::vector<size_t>& transposeOrder = inputShapeAndOrders.second;
@@ -73,6 +75,8 @@ public:
         }
         result << "Prc=" << qkvType << "_";
         result << "HasShapeOf=" << hasShapeof << "_";
+        if (kvCacheType != ElementType::undefined)
+            result << "KVCachePrc=" << kvCacheType << "_";
         result << "TransposeOrder=";
         result << "(";
         for (const auto& itr : transposeOrder) {
@@ -86,8 +90,8 @@ public:
     void SetUp() override {
         InputShapeAndTransposeOrder inputShapeAndOrders;
         bool hasShapeOf;
-        ElementType qkvType;
-        std::tie(qkvType, inputShapeAndOrders, hasShapeOf) = this->GetParam();
+        ElementType qkvType, kvCacheType;
+        std::tie(qkvType, inputShapeAndOrders, hasShapeOf, kvCacheType) = this->GetParam();
         std::vector<InputShape>& inputShapes = inputShapeAndOrders.first;
         std::vector<size_t>& transposeOrder = inputShapeAndOrders.second;
         targetDevice = ov::test::utils::DEVICE_CPU;
@@ -97,6 +101,12 @@ public:
             configuration[ov::hint::inference_precision.name()] = ov::element::bf16;
             rel_threshold = 0.01f;
         }
+        if (kvCacheType != ElementType::undefined)
+            configuration[ov::hint::kv_cache_precision.name()] = kvCacheType;
+        if (kvCacheType == ElementType::u8) {
+            abs_threshold = 5e-2f;
+            rel_threshold = 5e-2f;
+        }
         init_input_shapes(inputShapes);
         ov::ParameterVector inputParams;
         // q,k,v
@@ -145,11 +155,16 @@ public:
         auto unsqueezeK = std::make_shared<ov::op::v0::Unsqueeze>(concatK, unsquezeAxis);
         auto unsqueezeV = std::make_shared<ov::op::v0::Unsqueeze>(concatV, unsquezeAxis);
 
-        auto targetShape = ov::op::v0::Constant::create(qkvType, {1, 1, 1, 4, 1}, {1});
+        // every kv head is shared by a group of query heads
+        const auto headNumQ = inputDynamicShapes[0][transposeOrder[1]].get_length();
+        const auto headNumKV = inputDynamicShapes[1][transposeOrder[1]].get_length();
+        const auto headSize = inputDynamicShapes[0][transposeOrder[3]].get_length();
+        auto targetShape = ov::op::v0::Constant::create(qkvType, {1, 1, 1, size_t(headNumQ / headNumKV), 1}, {1});
         auto broadcastK = std::make_shared<ov::op::v1::Multiply>(unsqueezeK, targetShape);
         auto broadcastV = std::make_shared<ov::op::v1::Multiply>(unsqueezeV, targetShape);
 
-        auto target4D = ov::op::v0::Constant::create(ov::element::i32, {4}, {0, 0, 8, 64});
+        auto target4D =
+            ov::op::v0::Constant::create(ov::element::i32, {4}, std::vector<int64_t>{0, 0, headNumQ, headSize});
 
         auto reshapeK = std::make_shared<ov::op::v1::Reshape>(broadcastK, target4D, true);
         auto reshapeV = std::make_shared<ov::op::v1::Reshape>(broadcastV, target4D, true);
@@ -285,8 +300,8 @@ public:
 TEST_P(ConcatMultiQuerySDPTest, CompareWithRefs) {
     InputShapeAndTransposeOrder inputShapeAndOrders;
     bool hasShapeOf;
-    ElementType qkvType;
-    std::tie(qkvType, inputShapeAndOrders, hasShapeOf) = this->GetParam();
+    ElementType qkvType, kvCacheType;
+    std::tie(qkvType, inputShapeAndOrders, hasShapeOf, kvCacheType) = this->GetParam();
     if (qkvType == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
         GTEST_SKIP();
     auto actualOutputs = run_test(function);
@@ -380,7 +395,41 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatMultiQuerySDPTest,
                          ConcatMultiQuerySDPTest,
                          ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16),
                                             ::testing::ValuesIn(inputShapeAndReorders),
-                                            ::testing::Values(true, false)),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(ElementType::undefined)),
+                         ConcatMultiQuerySDPTest::getTestCaseName);
+
+// Grouped query attention, the next tokens after the first one go to the single token kernel: one by one and as a
+// chunk of several tokens, so kv rows are shared by all query heads and query tokens of a group.
+const std::vector<InputShapeAndTransposeOrder> inputShapeAndReordersGQA = {{
+    {// inputShapes 32 query heads, 8 kv heads
+     {
+         // L1, B, H, S
+         {{-1, 1, 32, 64}, {{10, 1, 32, 64}, {1, 1, 32, 64}, {1, 1, 32, 64}, {4, 1, 32, 64}, {1, 1, 32, 64}}},
+         {{-1, 1, 8, 64}, {{10, 1, 8, 64}, {1, 1, 8, 64}, {1, 1, 8, 64}, {4, 1, 8, 64}, {1, 1, 8, 64}}},
+         // L0, B, H, S
+         {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {10, 1, 8, 64}, {11, 1, 8, 64}, {12, 1, 8, 64}, {16, 1, 8, 64}}},
+     },
+     // transposeOrder
+     {1, 2, 0, 3}},
+    {// inputShapes 8 query heads, 1 kv head, beam search
+     {
+         // L1, B, H, S
+         {{-1, -1, 8, 64}, {{10, 2, 8, 64}, {1, 2, 8, 64}, {1, 2, 8, 64}, {4, 2, 8, 64}, {1, 2, 8, 64}}},
+         {{-1, -1, 1, 64}, {{10, 2, 1, 64}, {1, 2, 1, 64}, {1, 2, 1, 64}, {4, 2, 1, 64}, {1, 2, 1, 64}}},
+         // L0, B, H, S
+         {{-1, -1, 1, 64}, {{0, 2, 1, 64}, {10, 2, 1, 64}, {11, 2, 1, 64}, {12, 2, 1, 64}, {16, 2, 1, 64}}},
+     },
+     // transposeOrder
+     {1, 2, 0, 3}},
+}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatGroupQuerySDPTest,
+                         ConcatMultiQuerySDPTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16),
+                                            ::testing::ValuesIn(inputShapeAndReordersGQA),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ElementType::undefined, ElementType::u8)),
                          ConcatMultiQuerySDPTest::getTestCaseName);
 }  // namespace
 }  // namespace test
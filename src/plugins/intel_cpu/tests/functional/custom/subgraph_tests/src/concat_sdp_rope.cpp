@@ -0,0 +1,301 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <climits>
+#include <cmath>
+
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/op_conversions/scaled_dot_product_attention_decomposition.hpp"
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+#include "utils/gen_pattern.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::gen_pattern;
+
+namespace ov {
+namespace test {
+
+using ConcatSDPRoPETestParams = std::tuple<ElementType,  // inference precision
+                                           ElementType   // kv cache precision
+                                           >;
+// Subgraph:
+/*
+ *        Parameter(q)   Parameter(k)   ReadValue  Parameter(v)  ReadValue
+ *             |              |              |           |           |
+ *           RoPE           RoPE           Gather        |         Gather
+ *             |                \          /              \         /
+ *             |                  Concat                    Concat
+ *             |                 /      \                  /     \
+ *              \               /        Assign           /       Assign
+ *                  ScaledDotProductAttention -----------
+ *                                  |
+ *                                 Add
+ *                                  |
+ *                                Result
+ *
+ * Both RoPE share cos/sin and position_ids (Llama-2 rotate-half), so the plugin folds them and the cache update
+ * into the SDPA node. The reference decomposes SDPA, which keeps RoPE and the cache concat unfused.
+ */
+
+class ConcatSDPRoPETest : public testing::WithParamInterface<ConcatSDPRoPETestParams>,
+                          virtual public ov::test::SubgraphBaseTest,
+                          public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConcatSDPRoPETestParams>& obj) {
+        ElementType inferPrecision, kvCachePrecision;
+        std::tie(inferPrecision, kvCachePrecision) = obj.param;
+        std::ostringstream result;
+        result << "InferPrc=" << inferPrecision << "_";
+        result << "KVCachePrc=" << kvCachePrecision;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t B = 2;
+    static constexpr size_t H = 8;
+    static constexpr size_t S = 64;
+    static constexpr int max_position_embeddings = 256;
+
+    static ov::OutputVector makeCosSinCache() {
+        const int rotary_ndims = static_cast<int>(S);
+        std::vector<float> lut_sin(max_position_embeddings * rotary_ndims, 0.0f);
+        std::vector<float> lut_cos(max_position_embeddings * rotary_ndims, 0.0f);
+        for (int i = 0, k = 0; i < rotary_ndims; i += 2, k++) {
+            auto xita_i = 1.0 / std::pow(10000.0, static_cast<double>(i) / rotary_ndims);
+            float* psin = lut_sin.data();
+            float* pcos = lut_cos.data();
+            for (int m = 0; m < max_position_embeddings; m++, psin += rotary_ndims, pcos += rotary_ndims) {
+                auto vsin = std::sin(xita_i * m);
+                auto vcos = std::cos(xita_i * m);
+                pcos[k] = pcos[k + rotary_ndims / 2] = vcos;
+                psin[k] = psin[k + rotary_ndims / 2] = vsin;
+            }
+        }
+        auto shape = ov::Shape({1, 1, static_cast<size_t>(max_position_embeddings), S});
+        return {makeConst(ov::element::f32, shape, lut_cos), makeConst(ov::element::f32, shape, lut_sin)};
+    }
+
+    // [B, L, H, S] => rotate-half RoPE => [B, H, L, S], cos/sin: [1, 1, L, S]
+    static std::shared_ptr<ov::Node> makeRoPE(const ov::Output<ov::Node>& input,
+                                              const ov::Output<ov::Node>& cos,
+                                              const ov::Output<ov::Node>& sin) {
+        auto transpose = makeOP<ov::op::v1::Transpose>({input, {0, 2, 1, 3}});
+        auto mul_cos = makeOP<ov::op::v1::Multiply>({transpose, cos}, {{"auto_broadcast", "numpy"}});
+        auto shape_of = makeOP<ov::op::v3::ShapeOf>({transpose}, {{"output_type", "i32"}});
+        auto head_size = makeOP<ov::op::v8::Gather>({shape_of, 3, 0}, {{"batch_dims", 0}});
+        auto half_div =
+            makeOP<ov::op::v1::Divide>({head_size, 2}, {{"auto_broadcast", "numpy"}, {"m_pythondiv", true}});
+        auto half_floor = makeOP<ov::op::v0::Floor>({half_div});
+        auto half = makeOP<ov::op::v0::Unsqueeze>({half_floor, 0});
+        auto begin = makeOP<ov::op::v3::ScatterUpdate>({{0, 0, 0, 0}, {3}, half, {0}});
+        auto x2 = makeOP<ov::op::v1::StridedSlice>({transpose, begin, {0ll, 0ll, 0ll, LLONG_MAX}, {1, 1, 1, 1}},
+                                                   {{"begin_mask", {1, 1, 1, 0}},
+                                                    {"end_mask", {1, 1, 1, 0}},
+                                                    {"new_axis_mask", {}},
+                                                    {"shrink_axis_mask", {}},
+                                                    {"ellipsis_mask", {}}});
+        auto minus_one = makeConst(element::f32, ov::Shape({1, 1, 1, 1}), {-1.000000f});
+        auto neg_x2 = makeOP<ov::op::v1::Multiply>({x2, minus_one}, {{"auto_broadcast", "numpy"}});
+        auto end = makeOP<ov::op::v3::ScatterUpdate>({{0, 0, 0, 0}, {3}, half, {0}});
+        auto x1 = makeOP<ov::op::v1::StridedSlice>({transpose, {0, 0, 0, 0}, end, {1, 1, 1, 1}},
+                                                   {{"begin_mask", {1, 1, 1, 0}},
+                                                    {"end_mask", {1, 1, 1, 0}},
+                                                    {"new_axis_mask", {}},
+                                                    {"shrink_axis_mask", {}},
+                                                    {"ellipsis_mask", {}}});
+        auto rotated = makeOP<ov::op::v0::Concat>({neg_x2, x1}, {{"axis", -1}});
+        auto mul_sin = makeOP<ov::op::v1::Multiply>({rotated, sin}, {{"auto_broadcast", "numpy"}});
+        return makeOP<ov::op::v1::Add>({mul_cos, mul_sin}, {{"auto_broadcast", "numpy"}});
+    }
+
+    // rows [0, pos_id_end) of the cos/sin table gathered at position_ids: [1, 1, L, S]
+    static std::shared_ptr<ov::Node> makeCosSin(const ov::Output<ov::Node>& table,
+                                                const ov::Output<ov::Node>& pos_id_end,
+                                                const ov::Output<ov::Node>& pos_ids) {
+        auto end = makeOP<ov::op::v0::Unsqueeze>({pos_id_end, 0});
+        auto slice_end = makeOP<ov::op::v3::ScatterUpdate>({{0, 0, 0}, {2}, end, {0}});
+        auto slice = makeOP<ov::op::v1::StridedSlice>({table, {0, 0, 0}, slice_end, {1, 1, 1}},
+                                                      {{"begin_mask", {1, 1, 0}},
+                                                       {"end_mask", {1, 1, 0}},
+                                                       {"new_axis_mask", {}},
+                                                       {"shrink_axis_mask", {}},
+                                                       {"ellipsis_mask", {}}});
+        auto squeeze = makeOP<ov::op::v0::Squeeze>({slice, 1});
+        auto squeeze2 = makeOP<ov::op::v0::Squeeze>({squeeze, 0});
+        auto gather = makeOP<ov::op::v8::Gather>({squeeze2, pos_ids, 0}, {{"batch_dims", 0}});
+        return makeOP<ov::op::v0::Unsqueeze>({gather, 1});
+    }
+
+    void SetUp() override {
+        ElementType inferPrecision, kvCachePrecision;
+        std::tie(inferPrecision, kvCachePrecision) = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        rel_threshold = 1e-2f;
+        configuration[ov::hint::inference_precision.name()] = inferPrecision;
+        configuration[ov::hint::kv_cache_precision.name()] = kvCachePrecision;
+        if (inferPrecision == ElementType::bf16)
+            rel_threshold = 2e-2f;
+        if (kvCachePrecision == ElementType::u8) {
+            abs_threshold = 5e-2f;
+            rel_threshold = 5e-2f;
+        }
+        // q/k: [B, L1, H, S], v & past kv: [B, H, L, S]
+        // first token, decode tokens and a prompt chunk after the past
+        std::vector<InputShape> inputShapes = {
+            {{B, -1, H, S}, {{B, 10, H, S}, {B, 1, H, S}, {B, 1, H, S}, {B, 5, H, S}, {B, 1, H, S}}},
+            {{B, H, -1, S}, {{B, H, 10, S}, {B, H, 1, S}, {B, H, 1, S}, {B, H, 5, S}, {B, H, 1, S}}},
+            {{B, H, -1, S}, {{B, H, 0, S}, {B, H, 0, S}, {B, H, 0, S}, {B, H, 0, S}, {B, H, 0, S}}},
+        };
+        init_input_shapes(inputShapes);
+        ov::ParameterVector inputParams;
+        // q, k, v
+        inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0]));
+        inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0]));
+        inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[1]));
+        inputParams[0]->set_friendly_name("q");
+        inputParams[1]->set_friendly_name("k");
+        inputParams[2]->set_friendly_name("v");
+        // pastkv init_cost
+        inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[2]));
+        auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::PartialShape{-1});
+        beam_idx->set_friendly_name("beam_idx");
+        inputParams.push_back(beam_idx);
+        auto pos_id_end = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::Shape{});
+        pos_id_end->set_friendly_name("pos_id_end");
+        inputParams.push_back(pos_id_end);
+        auto pos_ids = std::make_shared<ov::op::v0::Parameter>(ElementType::i32, ov::PartialShape{1, -1});
+        pos_ids->set_friendly_name("pos_ids");
+        inputParams.push_back(pos_ids);
+
+        auto cos_sin_cache = makeCosSinCache();
+        auto cos = makeCosSin(cos_sin_cache[0], pos_id_end, pos_ids);
+        auto sin = makeCosSin(cos_sin_cache[1], pos_id_end, pos_ids);
+        auto rope_q = makeRoPE(inputParams[0], cos, sin);
+        auto rope_k = makeRoPE(inputParams[1], cos, sin);
+
+        auto var_k = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{inputDynamicShapes[2], ElementType::f32, "pastk"});
+        auto pastk = std::make_shared<ov::op::v6::ReadValue>(inputParams[3], var_k);
+        pastk->set_friendly_name("pastk_r");
+        auto var_v = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{inputDynamicShapes[2], ElementType::f32, "pastv"});
+        auto pastv = std::make_shared<ov::op::v6::ReadValue>(inputParams[3], var_v);
+        pastv->set_friendly_name("pastv_r");
+        auto axis = op::v0::Constant::create(ElementType::i32, {1}, {0});
+        auto gatherK = std::make_shared<ov::op::v8::Gather>(pastk, beam_idx, axis);
+        auto gatherV = std::make_shared<ov::op::v8::Gather>(pastv, beam_idx, axis);
+        auto concatK = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherK, rope_k}, 2);
+        auto concatV = std::make_shared<ov::op::v0::Concat>(OutputVector{gatherV, inputParams[2]}, 2);
+        auto sdp = std::make_shared<ov::opset13::ScaledDotProductAttention>(rope_q, concatK, concatV, false);
+        sdp->set_friendly_name("mha");
+        auto add = std::make_shared<ov::op::v1::Add>(sdp, op::v0::Constant::create(ElementType::f32, {1}, {1.0f}));
+        auto pastk_assign = std::make_shared<op::v6::Assign>(concatK, var_k);
+        auto pastv_assign = std::make_shared<op::v6::Assign>(concatV, var_v);
+        pastk_assign->set_friendly_name("pastk_w");
+        pastv_assign->set_friendly_name("pastv_w");
+
+        ResultVector results{std::make_shared<ov::op::v0::Result>(add)};
+        SinkVector sinks{pastk_assign, pastv_assign};
+        function = std::make_shared<ov::Model>(results, sinks, inputParams, "ConcatSDPRoPE");
+
+        functionRefs = function->clone();
+        pass::Manager manager;
+        // decompose ScaledDotProductAttention
+        manager.register_pass<ov::pass::ScaledDotProductAttentionDecomposition>();
+        manager.run_passes(functionRefs);
+    }
+
+    void generate(int idx, size_t past_len, const std::vector<ov::Shape>& targetInputStaticShapes) {
+        inputs.clear();
+        const auto& params = function->get_parameters();
+        auto L1 = targetInputStaticShapes[0][1];
+        auto create_input = [&](size_t i, const ov::Shape& shape) {
+            auto seed = static_cast<int>(idx * 8 + i);
+            auto tensor = utils::create_and_fill_tensor_real_distribution(ElementType::f32, shape, -1.f, 1.f, seed);
+            inputs.insert({params[i], tensor});
+        };
+        // q, k, v, pastkv
+        create_input(0, targetInputStaticShapes[0]);
+        create_input(1, targetInputStaticShapes[0]);
+        create_input(2, targetInputStaticShapes[1]);
+        create_input(3, targetInputStaticShapes[2]);
+        // beam_idx, pos_id_end, pos_ids
+        ov::Tensor beam_idx{ElementType::i32, ov::Shape{B}};
+        for (size_t b = 0; b < B; b++)
+            beam_idx.data<int32_t>()[b] = static_cast<int32_t>(b);
+        inputs.insert({params[4], beam_idx});
+        ov::Tensor pos_id_end{ElementType::i32, ov::Shape{}};
+        *pos_id_end.data<int32_t>() = static_cast<int32_t>(past_len + L1);
+        inputs.insert({params[5], pos_id_end});
+        ov::Tensor pos_ids{ElementType::i32, ov::Shape{1, L1}};
+        for (size_t m = 0; m < L1; m++)
+            pos_ids.data<int32_t>()[m] = static_cast<int32_t>(past_len + m);
+        inputs.insert({params[6], pos_ids});
+    }
+
+    std::vector<ov::Tensor> run_test(std::shared_ptr<ov::Model> model) {
+        function = model;
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+        std::vector<ov::Tensor> outputs;
+        int idx = 0;
+        size_t past_len = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            generate(idx++, past_len, shapes);
+            past_len += shapes[0][1];
+            for (const auto& input : inputs) {
+                inferRequest.set_tensor(input.first, input.second);
+            }
+            inferRequest.infer();
+            auto outputTensor = inferRequest.get_output_tensor(0);
+            ov::Tensor copy{outputTensor.get_element_type(), outputTensor.get_shape()};
+            outputTensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        for (auto&& state : inferRequest.query_state()) {
+            state.reset();
+        }
+        return outputs;
+    }
+};
+
+TEST_P(ConcatSDPRoPETest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ElementType inferPrecision = std::get<0>(GetParam());
+    if (inferPrecision == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    CheckNumberOfNodesWithType(compiledModel, "RoPE", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Concatenation", 0);
+    auto expectedOutputs = run_test(functionRefs);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 0);
+    CheckNumberOfNodesWithType(compiledModel, "RoPE", 2);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+namespace {
+// the prompt rotates k before the multi-token kernel (prepareRoPE + attn_rope), decode tokens and the prompt
+// chunk after the past rotate k straight into the cache (attn_rope_concat)
+const std::vector<ConcatSDPRoPETestParams> params = {
+    {ElementType::f32, ElementType::f32},
+    {ElementType::f32, ElementType::f16},
+    {ElementType::f32, ElementType::u8},
+    {ElementType::bf16, ElementType::bf16},
+    {ElementType::bf16, ElementType::u8},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPRoPETest,
+                         ConcatSDPRoPETest,
+                         ::testing::ValuesIn(params),
+                         ConcatSDPRoPETest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
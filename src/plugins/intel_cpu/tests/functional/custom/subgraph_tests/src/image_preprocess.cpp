@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using ov::preprocess::ColorFormat;
+
+namespace ov {
+namespace test {
+
+// source color format, source images [N, H, W], output [H, W], NCHW output
+typedef std::tuple<ColorFormat, std::vector<ov::Shape>, ov::Shape, bool> ImagePreprocessTestParams;
+
+static std::string colorFormatName(ColorFormat format) {
+    switch (format) {
+    case ColorFormat::BGR:
+        return "BGR";
+    case ColorFormat::RGB:
+        return "RGB";
+    case ColorFormat::NV12_SINGLE_PLANE:
+        return "NV12_SINGLE_PLANE";
+    case ColorFormat::NV12_TWO_PLANES:
+        return "NV12_TWO_PLANES";
+    default:
+        return "UNSUPPORTED";
+    }
+}
+
+class ImagePreprocessCPUTest : public testing::WithParamInterface<ImagePreprocessTestParams>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ImagePreprocessTestParams>& obj) {
+        ColorFormat format;
+        std::vector<ov::Shape> images;
+        ov::Shape out_size;
+        bool planar;
+        std::tie(format, images, out_size, planar) = obj.param;
+        std::ostringstream results;
+
+        results << "Format=" << colorFormatName(format) << "_TS=(";
+        for (const auto& item : images) {
+            results << ov::test::utils::vec2str(item) << "_";
+        }
+        results << ")_Out=" << ov::test::utils::vec2str(out_size) << "_planar=" << planar;
+        return results.str();
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& model_inputs = function->inputs();
+        for (size_t i = 0; i < model_inputs.size(); i++) {
+            ov::test::utils::InputGenerateData in_data;
+            in_data.start_from = 0;
+            in_data.range = 255;
+            in_data.seed = static_cast<int>(i + 1);
+            auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::u8, targetInputStaticShapes[i], in_data);
+            inputs.insert({model_inputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ColorFormat format;
+        std::vector<ov::Shape> images;
+        ov::Shape out_size;
+        bool planar;
+        std::tie(format, images, out_size, planar) = this->GetParam();
+
+        const bool is_nv12 = format == ColorFormat::NV12_SINGLE_PLANE || format == ColorFormat::NV12_TWO_PLANES;
+        std::vector<InputShape> input_shapes(format == ColorFormat::NV12_TWO_PLANES ? 2 : 1);
+        input_shapes[0].first = {-1, -1, -1, is_nv12 ? 1 : 3};
+        if (format == ColorFormat::NV12_TWO_PLANES)
+            input_shapes[1].first = {-1, -1, -1, 2};
+        for (const auto& image : images) {
+            const auto batch = image[0], height = image[1], width = image[2];
+            switch (format) {
+            case ColorFormat::NV12_SINGLE_PLANE:
+                input_shapes[0].second.push_back({batch, height * 3 / 2, width, 1});
+                break;
+            case ColorFormat::NV12_TWO_PLANES:
+                input_shapes[0].second.push_back({batch, height, width, 1});
+                input_shapes[1].second.push_back({batch, height / 2, width / 2, 2});
+                break;
+            default:
+                input_shapes[0].second.push_back({batch, height, width, 3});
+            }
+        }
+        init_input_shapes(input_shapes);
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+
+        const auto out_height = static_cast<int64_t>(out_size[0]);
+        const auto out_width = static_cast<int64_t>(out_size[1]);
+        auto image = std::make_shared<ov::opset1::Parameter>(
+            ov::element::f32,
+            planar ? ov::PartialShape{-1, 3, out_height, out_width} : ov::PartialShape{-1, out_height, out_width, 3});
+        auto abs = std::make_shared<ov::opset1::Abs>(image);
+        auto model = std::make_shared<ov::Model>(ov::NodeVector{abs}, ov::ParameterVector{image}, "ImagePreprocess");
+
+        // the chain ov::preprocess inserts in front of the model
+        ov::preprocess::PrePostProcessor ppp(model);
+        auto& input = ppp.input();
+        input.tensor().set_element_type(ov::element::u8).set_color_format(format).set_layout("NHWC").set_spatial_dynamic_shape();
+        auto& steps = input.preprocess();
+        if (is_nv12) {
+            steps.convert_color(format == ColorFormat::NV12_TWO_PLANES ? ColorFormat::BGR : ColorFormat::RGB)
+                .convert_element_type(ov::element::f32);
+        } else {
+            steps.convert_element_type(ov::element::f32).convert_color(ColorFormat::RGB);
+        }
+        steps.resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR)
+            .mean({123.675f, 116.28f, 103.53f})
+            .scale({58.395f, 57.12f, 57.375f});
+        input.model().set_layout(planar ? "NCHW" : "NHWC");
+        function = ppp.build();
+
+        // NV12 conversion rounds halves to even like the JIT ColorConvert kernel, one level of 255 is tolerated
+        abs_threshold = 2e-2;
+    }
+};
+
+TEST_P(ImagePreprocessCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+}
+
+namespace {
+
+const std::vector<std::vector<ov::Shape>> images = {
+    {{1, 480, 640}, {2, 36, 52}, {1, 480, 640}},
+    {{1, 224, 224}},
+};
+
+const std::vector<ov::Shape> outSizes = {
+    {224, 224},
+    {60, 80},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImagePreprocess_Packed,
+                         ImagePreprocessCPUTest,
+                         ::testing::Combine(::testing::Values(ColorFormat::BGR, ColorFormat::RGB),
+                                            ::testing::ValuesIn(images),
+                                            ::testing::ValuesIn(outSizes),
+                                            ::testing::Values(true, false)),
+                         ImagePreprocessCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImagePreprocess_NV12,
+                         ImagePreprocessCPUTest,
+                         ::testing::Combine(::testing::Values(ColorFormat::NV12_SINGLE_PLANE, ColorFormat::NV12_TWO_PLANES),
+                                            ::testing::ValuesIn(images),
+                                            ::testing::ValuesIn(outSizes),
+                                            ::testing::Values(true, false)),
+                         ImagePreprocessCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <limits>
+
 #include "common_test_utils/node_builders/constant.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/fusing_test_utils.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 using namespace CPUTestUtils;
 
@@ -326,6 +329,67 @@ TEST_P(MatmulWeightsDecompression, CompareWithRefs) {
     check_results();
 }
 
+class MatmulWeightsDecompressionNative : public MatmulWeightsDecompression {
+protected:
+    std::string fully_connected_impl_type() const {
+        for (const auto& n : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rt_info = n->get_rt_info();
+            if (rt_info.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() == "FullyConnected")
+                return rt_info.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+        }
+        return {};
+    }
+
+    // the native 4-bit weights and dynamic quantization executors, oneDNN reports brgemm / jit types
+    static bool is_native_impl_type(const std::string& impl_type) {
+        const std::string native_impl_type = ov::with_cpu_x86_avx512_core() ? "gemm_avx512" : "gemm_avx2";
+        return impl_type.rfind(native_impl_type, 0) == 0;
+    }
+};
+
+class MatmulWeightsDecompressionW4 : public MatmulWeightsDecompressionNative {};
+class MatmulWeightsDecompressionDynQuant : public MatmulWeightsDecompressionNative {};
+
+TEST_P(MatmulWeightsDecompressionW4, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_results();
+
+    const auto& last_shape = targetStaticShapes.back()[0];
+    const auto M = ov::shape_size(last_shape) / last_shape.back();
+    // the native 4-bit weights executor serves GEMV and small M only, bigger M goes to oneDNN
+    const bool w4_expected = ov::with_cpu_x86_avx2() && M <= 16;
+    const auto impl_type = fully_connected_impl_type();
+    ASSERT_EQ(w4_expected, is_native_impl_type(impl_type)) << "Unexpected implementation: " << impl_type;
+}
+
+TEST_P(MatmulWeightsDecompressionW4, PrimitivesPriority) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!ov::with_cpu_x86_avx2())
+        GTEST_SKIP() << "The native 4-bit weights executor requires AVX2";
+    // an explicit oneDNN implementation in primitivesPriority disables the native executor
+    const std::string dnnl_priority = ov::with_cpu_x86_avx512_core() ? "cpu:brgemm_avx512" : "cpu:brgemm_avx2";
+    for (const auto& op : function->get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::MatMul>(op))
+            op->get_rt_info()[ov::PrimitivesPriority::get_type_info_static()] = ov::PrimitivesPriority(dnnl_priority);
+    }
+    run();
+
+    const auto impl_type = fully_connected_impl_type();
+    ASSERT_FALSE(is_native_impl_type(impl_type)) << "Unexpected implementation: " << impl_type;
+}
+
+TEST_P(MatmulWeightsDecompressionDynQuant, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    check_results();
+
+    // AMX hosts run the dynamic quantization in oneDNN
+    const bool dyn_quant_expected = ov::with_cpu_x86_avx2() && !ov::with_cpu_x86_avx512_core_amx();
+    const auto impl_type = fully_connected_impl_type();
+    ASSERT_EQ(dyn_quant_expected, is_native_impl_type(impl_type)) << "Unexpected implementation: " << impl_type;
+}
+
 namespace {
 
 std::vector<ov::AnyMap> filter_additional_config_basic() {
@@ -436,6 +500,33 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_corner_cases_amx,
                                             ::testing::Values(true)),
                          MatmulWeightsDecompression::getTestCaseName);
 
+// GEMV and small M are executed by the native 4-bit weights executor
+const std::vector<ShapeParams> input_shapes_w4 = {
+    {{{}, {{1, 1, 512}}}, {512, 200}, 32ul},
+    {{{}, {{1, 3, 512}}}, {512, 256}, 64ul},
+    {{{}, {{1, 16, 256}}}, {256, 72}, 128ul},
+    {{{-1, -1, -1}, {{1, 1, 256}, {1, 9, 256}, {1, 17, 256}}}, {256, 48}, 32ul},
+    {{{-1, -1, -1}, {{1, 17, 256}, {1, 2, 256}}}, {256, 48}, 32ul},
+    {{{}, {{1, 5, 96}}}, {96, 40}},
+};
+const std::vector<ov::test::ElementType> weights_precisions_w4 = {ov::element::u4, ov::element::i4, ov::element::nf4};
+
+// the executor is implemented for f32 activations only
+const std::vector<ov::AnyMap> additional_config_w4 = {{ov::hint::inference_precision(ov::element::f32)}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_w4,
+                         MatmulWeightsDecompressionW4,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_w4),
+                                            ::testing::ValuesIn(weights_precisions_w4),
+                                            ::testing::ValuesIn(decompression_precisions_corner_cases),
+                                            ::testing::ValuesIn(transpose_weights),
+                                            ::testing::ValuesIn(decompression_subtract_type),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(additional_config_w4),
+                                            ::testing::ValuesIn(fusing_params),
+                                            ::testing::Values(true)),
+                         MatmulWeightsDecompression::getTestCaseName);
+
 const std::vector<ShapeParams> input_shapes_basic_dyn_quant = {
     {{{}, {{1, 7, 256}}}, {256, 128}, 32lu},
     {{{}, {{1, 1, 128}}}, {128, 32}},
@@ -468,6 +559,34 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_non_default_dyn_quant_gro
                                             ::testing::Values(true)),
                          MatmulWeightsDecompression::getTestCaseName);
 
+// group sizes which are not multiple of 16 and per token quantization are handled by the dynamic quantization executor
+const std::vector<ShapeParams> input_shapes_dyn_quant_corner_cases = {
+    {{{-1, -1, -1}, {{1, 1, 96}, {1, 9, 96}, {2, 70, 96}}}, {96, 40}, 24lu},
+    {{{}, {{1, 65, 264}}}, {264, 33}},
+};
+
+std::vector<ov::AnyMap> filter_additional_config_dyn_quant_corner_cases() {
+    std::vector<ov::AnyMap> additional_config = {
+        {{ov::hint::dynamic_quantization_group_size(8), ov::hint::inference_precision(ov::element::f32)}},
+        {{ov::hint::dynamic_quantization_group_size(std::numeric_limits<uint64_t>::max()),
+          ov::hint::inference_precision(ov::element::f32)}},
+    };
+    return additional_config;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_dyn_quant_corner_cases,
+                         MatmulWeightsDecompressionDynQuant,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_dyn_quant_corner_cases),
+                                            ::testing::Values(ov::element::u8),
+                                            ::testing::ValuesIn(decompression_precisions),
+                                            ::testing::ValuesIn(transpose_weights),
+                                            ::testing::ValuesIn(decompression_subtract_type),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(filter_additional_config_dyn_quant_corner_cases()),
+                                            ::testing::Values(emptyFusingSpec),
+                                            ::testing::Values(true)),
+                         MatmulWeightsDecompression::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -0,0 +1,304 @@
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/op.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// The op is registered by the python API only, the plugin matches it by the type name.
+class PagedAttentionExtension : public ov::op::Op {
+public:
+    OPENVINO_OP("PagedAttentionExtension");
+
+    PagedAttentionExtension() = default;
+    PagedAttentionExtension(const ov::OutputVector& args) : Op(args) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        OPENVINO_ASSERT(get_input_size() == 13, "Input count must be 13, Got: ", get_input_size());
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        OPENVINO_ASSERT(new_args.size() == 13,
+                        "Incorrect number of new arguments: ",
+                        new_args.size(),
+                        ". 13 is expected.");
+
+        return std::make_shared<PagedAttentionExtension>(new_args);
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override {
+        return true;
+    }
+};
+
+struct PagedAttnTestCase {
+    bool is_prompt;
+    std::vector<size_t> past_lens;  // tokens already in the cache of each sequence
+    std::vector<size_t> new_lens;   // new tokens of each sequence, the step is right padded to the longest one
+    int32_t sliding_window;
+};
+
+using PagedAttnTestParams = std::tuple<ElementType, PagedAttnTestCase>;
+
+class PagedAttnTest : public testing::WithParamInterface<PagedAttnTestParams>,
+                      virtual public ov::test::SubgraphBaseTest,
+                      public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PagedAttnTestParams>& obj) {
+        ElementType inType;
+        PagedAttnTestCase testCase;
+        std::tie(inType, testCase) = obj.param;
+        std::ostringstream result;
+        result << "Prc=" << inType << "_";
+        result << (testCase.is_prompt ? "Prompt" : "Generate") << "_";
+        result << "Past=" << ov::test::utils::vec2str(testCase.past_lens) << "_";
+        result << "New=" << ov::test::utils::vec2str(testCase.new_lens) << "_";
+        result << "SlidingWindow=" << testCase.sliding_window;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t H = 4;
+    static constexpr size_t Hk = 2;
+    static constexpr size_t S = 64;
+    static constexpr size_t block_size = 16;
+
+    void SetUp() override {
+        ElementType inType;
+        std::tie(inType, testCase) = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        rel_threshold = 1e-2f;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        if (inType == ElementType::bf16) {
+            configuration[ov::hint::inference_precision.name()] = ov::element::bf16;
+            rel_threshold = 2e-2f;
+        }
+
+        auto make_param = [](ElementType type, const ov::PartialShape& shape) {
+            return std::make_shared<ov::op::v0::Parameter>(type, shape);
+        };
+        ov::ParameterVector inputParams{make_param(inType, {-1, -1, H * S}),            // q
+                                        make_param(inType, {-1, -1, Hk * S}),           // k
+                                        make_param(inType, {-1, -1, Hk * S}),           // v
+                                        make_param(inType, {-1, Hk, block_size, S}),    // key cache
+                                        make_param(inType, {-1, Hk, block_size, S}),    // value cache
+                                        make_param(ElementType::u8, {}),                // is_prompt
+                                        make_param(ElementType::i32, {-1, -1}),         // slot_mapping
+                                        make_param(ElementType::i32, {}),               // max_context_len
+                                        make_param(ElementType::i32, {-1}),             // context_lens
+                                        make_param(ElementType::i32, {-1, -1}),         // block_tables
+                                        make_param(ElementType::f32, {}),               // scale
+                                        make_param(ElementType::f32, {-1}),             // alibi_slopes
+                                        make_param(ElementType::i32, {})};              // sliding_window
+        ov::OutputVector args(inputParams.begin(), inputParams.end());
+        auto pa = std::make_shared<PagedAttentionExtension>(args);
+        pa->set_friendly_name("pa");
+        ResultVector results{std::make_shared<ov::op::v0::Result>(pa)};
+        function = std::make_shared<ov::Model>(results, inputParams, "PagedAttn");
+    }
+
+    static std::vector<float> to_f32(const ov::Tensor& t) {
+        std::vector<float> data(t.get_size());
+        if (t.get_element_type() == ElementType::bf16) {
+            auto* src = t.data<ov::bfloat16>();
+            for (size_t i = 0; i < data.size(); i++)
+                data[i] = static_cast<float>(src[i]);
+        } else {
+            auto* src = t.data<float>();
+            std::copy(src, src + data.size(), data.begin());
+        }
+        return data;
+    }
+
+    // naive attention of the valid query rows, [B * L1, H * S], padded rows are zero
+    ov::Tensor reference(const std::vector<std::vector<int32_t>>& block_tables) {
+        const auto& params = function->get_parameters();
+        auto q = to_f32(inputs.at(params[0]));
+        auto k = to_f32(inputs.at(params[1]));
+        auto v = to_f32(inputs.at(params[2]));
+        auto k_cache = to_f32(inputs.at(params[3]));
+        auto v_cache = to_f32(inputs.at(params[4]));
+        const size_t B = testCase.new_lens.size();
+        const size_t L1 = inputs.at(params[0]).get_shape()[1];
+        const size_t window = static_cast<size_t>(testCase.sliding_window);
+        const float d_scale = 1.0f / std::sqrt(static_cast<float>(S));
+        ov::Tensor expected{ElementType::f32, ov::Shape{B * L1, H * S}};
+        std::fill_n(expected.data<float>(), expected.get_size(), 0.0f);
+        // the key/value of the token `pos` in the sequence `b`
+        auto kv_ptr = [&](std::vector<float>& cur, std::vector<float>& cache, size_t b, size_t pos, size_t hk) {
+            auto past = testCase.past_lens[b];
+            if (pos >= past)
+                return &cur[((b * L1) + pos - past) * Hk * S + hk * S];
+            auto block = static_cast<size_t>(block_tables[b][pos / block_size]);
+            return &cache[((block * Hk + hk) * block_size + pos % block_size) * S];
+        };
+        for (size_t b = 0; b < B; b++) {
+            auto past = testCase.past_lens[b];
+            for (size_t m = 0; m < testCase.new_lens[b]; m++) {
+                float* out = expected.data<float>() + (b * L1 + m) * H * S;
+                auto hi = past + m + 1;
+                auto lo = (window && hi > window) ? hi - window : 0;
+                for (size_t h = 0; h < H; h++) {
+                    auto hk = h / (H / Hk);
+                    const float* q_row = &q[(b * L1 + m) * H * S + h * S];
+                    std::vector<float> score(hi - lo);
+                    float max_score = -INFINITY;
+                    for (size_t j = lo; j < hi; j++) {
+                        const float* k_row = kv_ptr(k, k_cache, b, j, hk);
+                        float sum = 0.0f;
+                        for (size_t s = 0; s < S; s++)
+                            sum += q_row[s] * k_row[s];
+                        score[j - lo] = sum * d_scale;
+                        max_score = std::max(max_score, score[j - lo]);
+                    }
+                    float total = 0.0f;
+                    for (auto& w : score) {
+                        w = std::exp(w - max_score);
+                        total += w;
+                    }
+                    float* o = out + h * S;
+                    std::fill(o, o + S, 0.0f);
+                    for (size_t j = lo; j < hi; j++) {
+                        const float* v_row = kv_ptr(v, v_cache, b, j, hk);
+                        for (size_t s = 0; s < S; s++)
+                            o[s] += score[j - lo] / total * v_row[s];
+                    }
+                }
+            }
+        }
+        return expected;
+    }
+
+    void generate_and_run() {
+        const size_t B = testCase.new_lens.size();
+        const size_t L1 = *std::max_element(testCase.new_lens.begin(), testCase.new_lens.end());
+        std::vector<std::vector<int32_t>> block_tables(B);
+        std::vector<int32_t> context_lens(B);
+        size_t num_blocks = 0, max_blocks = 0;
+        for (size_t b = 0; b < B; b++) {
+            auto len = testCase.past_lens[b] + testCase.new_lens[b];
+            auto blocks = (len + block_size - 1) / block_size;
+            for (size_t i = 0; i < blocks; i++)
+                block_tables[b].push_back(static_cast<int32_t>(num_blocks++));
+            context_lens[b] = static_cast<int32_t>(len);
+            max_blocks = std::max(max_blocks, blocks);
+        }
+        // padded query rows have negative slots
+        ov::Tensor slot_mapping{ElementType::i32, ov::Shape{B, L1}};
+        ov::Tensor block_table{ElementType::i32, ov::Shape{B, max_blocks}};
+        for (size_t b = 0; b < B; b++) {
+            auto* slots = slot_mapping.data<int32_t>() + b * L1;
+            for (size_t m = 0; m < L1; m++) {
+                auto pos = testCase.past_lens[b] + m;
+                slots[m] = m < testCase.new_lens[b]
+                               ? block_tables[b][pos / block_size] * static_cast<int32_t>(block_size) +
+                                     static_cast<int32_t>(pos % block_size)
+                               : -1;
+            }
+            auto* table = block_table.data<int32_t>() + b * max_blocks;
+            std::fill(table, table + max_blocks, 0);
+            std::copy(block_tables[b].begin(), block_tables[b].end(), table);
+        }
+
+        const auto& params = function->get_parameters();
+        auto inType = params[0]->get_element_type();
+        auto scalar = [](ElementType type, float value) {
+            ov::Tensor t{type, ov::Shape{}};
+            if (type == ElementType::u8)
+                *t.data<uint8_t>() = static_cast<uint8_t>(value);
+            else if (type == ElementType::i32)
+                *t.data<int32_t>() = static_cast<int32_t>(value);
+            else
+                *t.data<float>() = value;
+            return t;
+        };
+        auto max_context_len = *std::max_element(context_lens.begin(), context_lens.end());
+        inputs.clear();
+        inputs[params[0]] = utils::create_and_fill_tensor_real_distribution(inType, {B, L1, H * S}, -1.f, 1.f, 1);
+        inputs[params[1]] = utils::create_and_fill_tensor_real_distribution(inType, {B, L1, Hk * S}, -1.f, 1.f, 2);
+        inputs[params[2]] = utils::create_and_fill_tensor_real_distribution(inType, {B, L1, Hk * S}, -1.f, 1.f, 3);
+        inputs[params[3]] =
+            utils::create_and_fill_tensor_real_distribution(inType, {num_blocks, Hk, block_size, S}, -1.f, 1.f, 4);
+        inputs[params[4]] =
+            utils::create_and_fill_tensor_real_distribution(inType, {num_blocks, Hk, block_size, S}, -1.f, 1.f, 5);
+        inputs[params[5]] = scalar(ElementType::u8, testCase.is_prompt ? 1.0f : 0.0f);
+        inputs[params[6]] = slot_mapping;
+        inputs[params[7]] = scalar(ElementType::i32, static_cast<float>(max_context_len));
+        inputs[params[8]] = utils::create_tensor<int32_t>(ElementType::i32, ov::Shape{B}, context_lens);
+        inputs[params[9]] = block_table;
+        inputs[params[10]] = scalar(ElementType::f32, 1.0f / std::sqrt(static_cast<float>(S)));
+        inputs[params[11]] = ov::Tensor{ElementType::f32, ov::Shape{0}};
+        inputs[params[12]] = scalar(ElementType::i32, static_cast<float>(testCase.sliding_window));
+
+        // the caches are updated in place, the reference is computed on the original content
+        auto expected = reference(block_tables);
+
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+        for (const auto& input : inputs)
+            inferRequest.set_tensor(input.first, input.second);
+        // non-zero garbage in the output, so padded rows which are not written fail the comparison
+        inferRequest.set_output_tensor(
+            0,
+            utils::create_and_fill_tensor_real_distribution(inType, {B, L1, H * S}, 1.f, 2.f, 6));
+        inferRequest.infer();
+
+        auto output = to_f32(inferRequest.get_output_tensor(0));
+        auto actual = utils::create_tensor<float>(ElementType::f32, expected.get_shape(), output);
+        ov::test::utils::compare(expected, actual, abs_threshold, rel_threshold);
+    }
+
+    PagedAttnTestCase testCase;
+};
+
+TEST_P(PagedAttnTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    ElementType inType = std::get<0>(GetParam());
+    if (inType == ElementType::bf16 && !ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    generate_and_run();
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+}
+
+namespace {
+// the prompt reaches the flash attention path of the bf16 kernel (kv length >= 1024)
+const std::vector<PagedAttnTestCase> promptCases = {
+    {true, {0}, {1100}, 0},
+    {true, {0}, {1100}, 300},
+    {true, {0, 0}, {1030, 1030}, 512},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttn_Prompt,
+                         PagedAttnTest,
+                         ::testing::Combine(::testing::Values(ElementType::bf16), ::testing::ValuesIn(promptCases)),
+                         PagedAttnTest::getTestCaseName);
+
+// continuous batching: a prompt, a prompt chunk and decode tokens of different sequences share one step
+const std::vector<PagedAttnTestCase> generateCases = {
+    {false, {17, 40}, {1, 1}, 0},
+    {false, {0, 40, 17}, {5, 1, 3}, 0},
+    {false, {33, 0}, {16, 20}, 0},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttn_Generate,
+                         PagedAttnTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32, ElementType::bf16),
+                                            ::testing::ValuesIn(generateCases)),
+                         PagedAttnTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
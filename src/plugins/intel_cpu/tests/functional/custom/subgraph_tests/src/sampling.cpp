@@ -0,0 +1,196 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "openvino/opsets/opset13.hpp"
+#include "openvino/opsets/opset3.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// input shape, top_k (0 - disabled), top_p, top-p mask built with Less, temperature, with_replacement,
+// flat distribution
+typedef std::tuple<InputShape, size_t, float, bool, float, bool, bool> SamplingTestParams;
+
+static std::shared_ptr<ov::Node> makeScalar(ov::element::Type type, float value) {
+    return ov::opset1::Constant::create(type, ov::Shape{}, {value});
+}
+
+class SamplingCPUTest : public testing::WithParamInterface<SamplingTestParams>,
+                        virtual public SubgraphBaseTest,
+                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SamplingTestParams>& obj) {
+        InputShape input_shape;
+        size_t top_k;
+        float top_p, temperature;
+        bool top_p_less, with_replacement, flat;
+        std::tie(input_shape, top_k, top_p, top_p_less, temperature, with_replacement, flat) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << ov::test::utils::partialShape2str({input_shape.first}) << "_TS=(";
+        for (const auto& item : input_shape.second) {
+            results << ov::test::utils::vec2str(item) << "_";
+        }
+        results << ")_top_k=" << top_k << "_top_p=" << top_p << (top_p_less ? "_less" : "")
+                << "_temperature=" << temperature << "_with_replacement=" << with_replacement << "_flat=" << flat;
+        return results.str();
+    }
+
+    // Every row has one dominating token, so the samples don't depend on the random generator. A flat
+    // distribution makes every draw depend on it, which checks that the random sequence of Multinomial is reproduced.
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& model_inputs = function->inputs();
+        const auto& shape = targetInputStaticShapes[0];
+        if (flat) {
+            ov::Tensor tensor(ov::element::f32, shape);
+            std::fill_n(tensor.data<float>(), tensor.get_size(), 0.5f);
+            inputs.insert({model_inputs[0].get_node_shared_ptr(), tensor});
+            return;
+        }
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -5;
+        in_data.range = 10;
+        in_data.resolution = 100;
+        in_data.seed = inferRequestNum++;
+        auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, in_data);
+        auto* logits = tensor.data<float>();
+        for (size_t b = 0; b < shape[0]; b++)
+            logits[b * shape[1] + (b * 7919 + inferRequestNum) % shape[1]] = 100.f;
+        inputs.insert({model_inputs[0].get_node_shared_ptr(), tensor});
+    }
+
+protected:
+    size_t inferRequestNum = 0;
+    bool flat = false;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        InputShape input_shape;
+        size_t top_k;
+        float top_p, temperature;
+        bool top_p_less, with_replacement;
+        std::tie(input_shape, top_k, top_p, top_p_less, temperature, with_replacement, flat) = this->GetParam();
+        init_input_shapes({input_shape});
+
+        auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto scaled = std::make_shared<ov::opset1::Divide>(logits, makeScalar(ov::element::f32, temperature));
+        ov::Output<ov::Node> values = scaled;
+        std::shared_ptr<ov::Node> topk;
+        if (top_k) {
+            topk = std::make_shared<ov::opset11::TopK>(scaled,
+                                                       makeScalar(ov::element::i32, static_cast<float>(top_k)),
+                                                       -1,
+                                                       ov::op::TopKMode::MAX,
+                                                       ov::op::TopKSortType::SORT_VALUES,
+                                                       ov::element::i32);
+            values = topk->output(0);
+        }
+        ov::Output<ov::Node> probs = std::make_shared<ov::opset8::Softmax>(values, -1);
+        if (top_p < 1.f) {
+            auto cumsum = std::make_shared<ov::opset3::CumSum>(probs, makeScalar(ov::element::i32, -1), true, false);
+            if (top_p_less) {
+                auto mask = std::make_shared<ov::opset1::Less>(cumsum, makeScalar(ov::element::f32, top_p));
+                probs = std::make_shared<ov::opset1::Select>(mask, probs, makeScalar(ov::element::f32, 0.f));
+            } else {
+                auto mask = std::make_shared<ov::opset1::Greater>(cumsum, makeScalar(ov::element::f32, top_p));
+                probs = std::make_shared<ov::opset1::Select>(mask, makeScalar(ov::element::f32, 0.f), probs);
+            }
+        }
+        auto samples = std::make_shared<ov::opset13::Multinomial>(probs,
+                                                                  makeScalar(ov::element::i32, with_replacement ? 3 : 1),
+                                                                  ov::element::i32,
+                                                                  with_replacement,
+                                                                  false,
+                                                                  42,
+                                                                  7);
+        std::shared_ptr<ov::Node> result = samples;
+        if (top_k)
+            result = std::make_shared<ov::opset8::Gather>(topk->output(1), samples, makeScalar(ov::element::i32, 1), 1);
+        function = std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{logits}, "Sampling");
+    }
+};
+
+TEST_P(SamplingCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Sampling", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Multinomial", 0);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{-1, -1}, {{1, 1000}, {4, 32000}, {1, 1000}}},
+    {{-1, 32000}, {{2, 32000}, {8, 32000}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_FullVocab,
+                         SamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(0),
+                                            ::testing::Values(1.f),
+                                            ::testing::Values(false),
+                                            ::testing::Values(1.f, 0.7f),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(false)),
+                         SamplingCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_TopK_TopP,
+                         SamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(1, 50),
+                                            ::testing::Values(1.f, 0.9f),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0.7f),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(false)),
+                         SamplingCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_TopK_TopP_Less,
+                         SamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(50),
+                                            ::testing::Values(0.9f),
+                                            ::testing::Values(true),
+                                            ::testing::Values(0.7f),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(false)),
+                         SamplingCPUTest::getTestCaseName);
+
+// equal logits, every sample is decided by the random generator
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_Flat,
+                         SamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(0, 50),
+                                            ::testing::Values(1.f),
+                                            ::testing::Values(false),
+                                            ::testing::Values(1.f),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true)),
+                         SamplingCPUTest::getTestCaseName);
+
+// top_p doesn't fall on a boundary of the cumulative probabilities of 50 equal candidates
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_Flat_TopP,
+                         SamplingCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(50),
+                                            ::testing::Values(0.85f),
+                                            ::testing::Values(false, true),
+                                            ::testing::Values(1.f),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true)),
+                         SamplingCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/lstm_sequence.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+// Streaming speech models run an LSTM chunk by chunk keeping h/c in ReadValue/Assign states:
+//
+//   X[1, T, DC]   ReadValue(h)  ReadValue(c)
+//        \           |          /
+//              LSTMSequence
+//        /           |          \
+//    Result(Y)   Assign(h)   Assign(c)
+//
+// Chunked execution must produce the same output as the whole sequence processed at once.
+class StatefulLSTMStreamingCPUTest : public testing::WithParamInterface<std::vector<size_t>>,
+                                     virtual public SubgraphBaseTest,
+                                     public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::vector<size_t>>& obj) {
+        std::ostringstream results;
+        results << "chunks=" << ov::test::utils::vec2str(obj.param);
+        return results.str();
+    }
+
+protected:
+    static constexpr size_t inputSize = 32;
+    static constexpr size_t hiddenSize = 64;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto prc = ov::element::f32;
+
+        auto X = std::make_shared<ov::op::v0::Parameter>(prc, ov::PartialShape{1, -1, inputSize});
+        const ov::PartialShape stateShape{1, 1, hiddenSize};
+        auto stateInit = ov::op::v0::Constant::create(prc, ov::Shape{1, 1, hiddenSize}, {0.f});
+        auto varH = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{stateShape, prc, "h"});
+        auto varC = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{stateShape, prc, "c"});
+        auto H = std::make_shared<ov::op::v6::ReadValue>(stateInit, varH);
+        auto C = std::make_shared<ov::op::v6::ReadValue>(stateInit, varC);
+
+        auto shape = std::make_shared<ov::op::v3::ShapeOf>(X, ov::element::i64);
+        auto seqLengths = std::make_shared<ov::op::v8::Gather>(shape,
+                                                               ov::op::v0::Constant::create(ov::element::i64, {1}, {1}),
+                                                               ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+
+        std::mt19937 gen(1);
+        std::uniform_real_distribution<float> dist(-0.3f, 0.3f);
+        auto makeWeights = [&](const ov::Shape& shape) {
+            std::vector<float> values(ov::shape_size(shape));
+            for (auto& value : values)
+                value = dist(gen);
+            return ov::op::v0::Constant::create(prc, shape, values);
+        };
+        auto W = makeWeights({1, 4 * hiddenSize, inputSize});
+        auto R = makeWeights({1, 4 * hiddenSize, hiddenSize});
+        auto B = makeWeights({1, 4 * hiddenSize});
+
+        auto lstm = std::make_shared<ov::op::v5::LSTMSequence>(X, H, C, seqLengths, W, R, B, hiddenSize,
+                                                               ov::op::RecurrentSequenceDirection::FORWARD);
+        auto assignH = std::make_shared<ov::op::v6::Assign>(lstm->output(1), varH);
+        auto assignC = std::make_shared<ov::op::v6::Assign>(lstm->output(2), varC);
+        auto result = std::make_shared<ov::op::v0::Result>(lstm->output(0));
+        function = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                               ov::SinkVector{assignH, assignC},
+                                               ov::ParameterVector{X},
+                                               "StatefulLSTMStreaming");
+    }
+
+    ov::Tensor makeChunk(const float* data, size_t length) {
+        ov::Tensor chunk(ov::element::f32, ov::Shape{1, length, inputSize});
+        std::copy(data, data + length * inputSize, chunk.data<float>());
+        return chunk;
+    }
+};
+
+TEST_P(StatefulLSTMStreamingCPUTest, CompareWithFullSequence) {
+    const auto& chunks = GetParam();
+    const size_t seqLength = std::accumulate(chunks.begin(), chunks.end(), size_t(0));
+
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+    ov::test::utils::InputGenerateData in_data;
+    in_data.start_from = -1;
+    in_data.range = 2;
+    in_data.resolution = 1000;
+    auto sequence = ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, seqLength, inputSize}, in_data);
+
+    inferRequest.set_input_tensor(sequence);
+    inferRequest.infer();
+    const auto& fullOutput = inferRequest.get_output_tensor();
+    ov::Tensor expected(ov::element::f32, fullOutput.get_shape());
+    fullOutput.copy_to(expected);
+
+    inferRequest.reset_state();
+    size_t offset = 0;
+    for (auto length : chunks) {
+        inferRequest.set_input_tensor(makeChunk(sequence.data<float>() + offset * inputSize, length));
+        inferRequest.infer();
+
+        ov::Tensor expectedChunk(ov::element::f32, ov::Shape{1, 1, length, hiddenSize});
+        const auto* src = expected.data<float>() + offset * hiddenSize;
+        std::copy(src, src + length * hiddenSize, expectedChunk.data<float>());
+        ov::test::utils::compare(expectedChunk, inferRequest.get_output_tensor(), 1e-5, 1e-4);
+        offset += length;
+    }
+    CheckNumberOfNodesWithType(compiledModel, "RNNSeq", 1);
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> chunks = {
+    {1, 1, 1, 1},
+    {3, 1, 4, 3, 1},
+    {8, 8},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulLSTMStreaming,
+                         StatefulLSTMStreamingCPUTest,
+                         ::testing::ValuesIn(chunks),
+                         StatefulLSTMStreamingCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
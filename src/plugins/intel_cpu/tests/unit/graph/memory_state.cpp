@@ -3,9 +3,14 @@
 //
 #include <gtest/gtest.h>
 
+#include <fstream>
+
+#include "common_test_utils/common_utils.hpp"
 #include "dummy_node.hpp"
 
 #include "graph.h"
+#include "memory_state.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "nodes/memory.hpp"
 #include "nodes/softmax.h"
 #include "nodes/shapeof.h"
@@ -13,6 +18,7 @@
 #include "openvino/op/convert.hpp"
 #include "openvino/op/shape_of.hpp"
 #include "openvino/op/softmax.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 using namespace ov::intel_cpu;
 
@@ -311,3 +317,128 @@ TEST(MemStateGraphTest, smoke_ShapeOf_no_Inplace_Conflicts) {
 
     ASSERT_EQ(itr, nodes.end());
 }
+
+TEST(MemStateKVcacheTest, smoke_Truncate_And_Compact) {
+    const size_t B = 2, H = 3, L = 6, S = 8;
+    auto dyn_shape = Shape(ov::PartialShape{-1, -1, -1, -1});
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, dyn_shape);
+    auto internal_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, dyn_shape);
+    auto state = std::make_shared<VariableStateKVcache>("kv", external_desc, internal_desc);
+
+    auto value = [](size_t b, size_t h, size_t l, size_t s) {
+        return static_cast<float>(b * 1000 + h * 100 + l * 10 + s);
+    };
+    ov::Tensor init(ov::element::f32, ov::Shape{B, H, L, S});
+    auto* init_data = init.data<float>();
+    for (size_t b = 0; b < B; b++)
+        for (size_t h = 0; h < H; h++)
+            for (size_t l = 0; l < L; l++)
+                for (size_t s = 0; s < S; s++)
+                    init_data[((b * H + h) * L + l) * S + s] = value(b, h, l, s);
+
+    auto check = [&](const std::vector<size_t>& rows) {
+        auto tensor = state->get_state();
+        ASSERT_EQ(tensor->get_shape(), (ov::Shape{B, H, rows.size(), S}));
+        auto* data = static_cast<float*>(tensor->data());
+        for (size_t b = 0; b < B; b++)
+            for (size_t h = 0; h < H; h++)
+                for (size_t l = 0; l < rows.size(); l++)
+                    for (size_t s = 0; s < S; s++)
+                        ASSERT_EQ(data[((b * H + h) * rows.size() + l) * S + s], value(b, h, rows[l], s));
+    };
+
+    state->set_state(ov::get_tensor_impl(init));
+    ASSERT_EQ(state->get_length(), L);
+    auto* cache_data = state->internal_state_mem()->getData();
+
+    // rejecting the draft tokens keeps the buffer
+    state->truncate(4);
+    ASSERT_EQ(state->get_length(), 4u);
+    ASSERT_EQ(state->internal_state_mem()->getData(), cache_data);
+    ASSERT_EQ(state->hidden_state_mem()->getStaticDims(), (VectorDims{B, 4}));
+    check({0, 1, 2, 3});
+    ASSERT_THROW(state->truncate(5), ov::Exception);
+
+    // accepted branch of a token tree
+    state->set_state(ov::get_tensor_impl(init));
+    state->compact(2, {1, 3});
+    ASSERT_EQ(state->get_length(), 4u);
+    check({0, 1, 3, 5});
+    ASSERT_THROW(state->compact(2, {2, 1}), ov::Exception);
+
+    state->truncate(0);
+    ASSERT_TRUE(state->is_reset_state());
+    ASSERT_EQ(state->get_length(), 0u);
+}
+
+TEST(MemStateKVcacheTest, smoke_Swap_Out_In) {
+    const size_t B = 2, H = 3, L = 5, S = 32;
+    auto dyn_shape = Shape(ov::PartialShape{-1, -1, -1, -1});
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, dyn_shape);
+    auto internal_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, dyn_shape);
+    auto state = std::make_shared<VariableStateKVcache>("kv", external_desc, internal_desc);
+
+    auto value = [](size_t b, size_t h, size_t l, size_t s) {
+        return static_cast<float>(b) + static_cast<float>(h) * 0.5f + static_cast<float>(l) * 0.25f +
+               static_cast<float>(s) / 16.0f;
+    };
+    ov::Tensor init(ov::element::f32, ov::Shape{B, H, L, S});
+    auto* init_data = init.data<float>();
+    for (size_t b = 0; b < B; b++)
+        for (size_t h = 0; h < H; h++)
+            for (size_t l = 0; l < L; l++)
+                for (size_t s = 0; s < S; s++)
+                    init_data[((b * H + h) * L + l) * S + s] = value(b, h, l, s);
+
+    // the first token of batch 1 comes from batch 0 after a beam search reorder
+    auto beam = [](size_t b, size_t l) {
+        return l == 0 ? size_t{0} : b;
+    };
+    auto check = [&](float tolerance) {
+        auto tensor = state->get_state();
+        ASSERT_EQ(tensor->get_shape(), (ov::Shape{B, H, L, S}));
+        auto* data = static_cast<float*>(tensor->data());
+        for (size_t b = 0; b < B; b++)
+            for (size_t h = 0; h < H; h++)
+                for (size_t l = 0; l < L; l++)
+                    for (size_t s = 0; s < S; s++)
+                        ASSERT_NEAR(data[((b * H + h) * L + l) * S + s], value(beam(b, l), h, l, s), tolerance);
+    };
+    auto set_state = [&]() {
+        state->set_state(ov::get_tensor_impl(init));
+        auto* table = state->hidden_state_mem()->getDataAs<int32_t>();
+        for (size_t b = 0; b < B; b++)
+            for (size_t l = 0; l < L; l++)
+                table[b * L + l] = static_cast<int32_t>(beam(b, l));
+    };
+
+    // compressed to u8 in host memory, restored by prefetch
+    set_state();
+    state->swap_out();
+    ASSERT_TRUE(state->is_swapped_out());
+    state->prefetch();
+    state->swap_in();
+    ASSERT_FALSE(state->is_swapped_out());
+    ASSERT_EQ(state->get_length(), L);
+    // one u8 step of a row spanning 2.0
+    check(2.0f / 255);
+
+    // spilled to a file, restored implicitly by the first access
+    const std::string spill_file = ov::test::utils::generateTestFilePrefix() + "_kvcache_swap.bin";
+    set_state();
+    state->swap_out(spill_file);
+    ASSERT_TRUE(state->is_swapped_out());
+    ASSERT_TRUE(std::ifstream(spill_file).good());
+    // the length does not restore the spilled cache
+    ASSERT_EQ(state->get_length(), L);
+    ASSERT_TRUE(state->is_swapped_out());
+    check(0.0f);
+    ASSERT_FALSE(state->is_swapped_out());
+    ASSERT_FALSE(std::ifstream(spill_file).good());
+
+    // reset drops the swapped cache
+    state->swap_out(spill_file);
+    state->reset();
+    ASSERT_FALSE(state->is_swapped_out());
+    ASSERT_EQ(state->get_length(), 0u);
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "paged_batch_scheduler.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<int32_t> to_vector(const ov::Tensor& t) {
+    auto* data = t.data<int32_t>();
+    return std::vector<int32_t>(data, data + t.get_size());
+}
+
+}  // namespace
+
+TEST(PagedBatchSchedulerTest, PrefillThenMixedStep) {
+    PagedBatchScheduler scheduler(8, 4);
+    scheduler.add_sequence(10, 5);
+    scheduler.add_sequence(20, 3);
+
+    // only prompts: the multi-token kernel is used
+    auto step = scheduler.schedule();
+    ASSERT_EQ(step.sequence_ids, (std::vector<uint64_t>{10, 20}));
+    ASSERT_EQ(step.query_lens, (std::vector<size_t>{5, 3}));
+    ASSERT_EQ(step.max_query_len, 5u);
+    ASSERT_EQ(*step.is_prompt.data<uint8_t>(), 1);
+    ASSERT_EQ(step.slot_mapping.get_shape(), (ov::Shape{2, 5}));
+    // sequence 10 owns blocks 0, 1, sequence 20 owns block 2
+    ASSERT_EQ(to_vector(step.slot_mapping), (std::vector<int32_t>{0, 1, 2, 3, 4, 8, 9, 10, -1, -1}));
+    ASSERT_EQ(to_vector(step.context_lens), (std::vector<int32_t>{5, 3}));
+    ASSERT_EQ(to_vector(step.block_tables), (std::vector<int32_t>{0, 1, 2, 0}));
+    ASSERT_EQ(*step.max_context_len.data<int32_t>(), 5);
+    ASSERT_EQ(scheduler.get_free_blocks(), 5u);
+    scheduler.step_done();
+
+    // a new prompt joins the running sequences
+    scheduler.add_sequence(30, 2);
+    step = scheduler.schedule();
+    ASSERT_EQ(step.sequence_ids, (std::vector<uint64_t>{10, 20, 30}));
+    ASSERT_EQ(step.past_lens, (std::vector<size_t>{5, 3, 0}));
+    ASSERT_EQ(step.query_lens, (std::vector<size_t>{1, 1, 2}));
+    ASSERT_EQ(*step.is_prompt.data<uint8_t>(), 0);
+    ASSERT_EQ(to_vector(step.slot_mapping), (std::vector<int32_t>{5, -1, 11, -1, 12, 13}));
+    ASSERT_EQ(to_vector(step.context_lens), (std::vector<int32_t>{6, 4, 2}));
+    scheduler.step_done();
+
+    // a finished sequence leaves and returns its blocks
+    scheduler.remove_sequence(10);
+    ASSERT_FALSE(scheduler.has_sequence(10));
+    ASSERT_EQ(scheduler.get_free_blocks(), 6u);
+    step = scheduler.schedule();
+    ASSERT_EQ(step.sequence_ids, (std::vector<uint64_t>{20, 30}));
+    ASSERT_EQ(step.query_lens, (std::vector<size_t>{1, 1}));
+    // sequence 20 crosses the block boundary and reuses block 0 of the removed sequence
+    ASSERT_EQ(to_vector(step.block_tables), (std::vector<int32_t>{2, 0, 3, 0}));
+}
+
+TEST(PagedBatchSchedulerTest, ChunkedPrefillAndOutOfBlocks) {
+    PagedBatchScheduler scheduler(3, 4, 6);
+    scheduler.add_sequence(1, 10);
+    scheduler.add_sequence(2, 8);
+
+    auto step = scheduler.schedule();
+    // the first chunk of sequence 1 takes 2 blocks, sequence 2 does not fit and waits
+    ASSERT_EQ(step.sequence_ids, (std::vector<uint64_t>{1}));
+    ASSERT_EQ(step.query_lens, (std::vector<size_t>{6}));
+    scheduler.step_done();
+
+    step = scheduler.schedule();
+    ASSERT_EQ(step.sequence_ids, (std::vector<uint64_t>{1}));
+    ASSERT_EQ(step.past_lens, (std::vector<size_t>{6}));
+    ASSERT_EQ(step.query_lens, (std::vector<size_t>{4}));
+    ASSERT_EQ(*step.is_prompt.data<uint8_t>(), 0);
+    scheduler.step_done();
+
+    scheduler.remove_sequence(1);
+    step = scheduler.schedule();
+    ASSERT_EQ(step.sequence_ids, (std::vector<uint64_t>{2}));
+    ASSERT_EQ(step.query_lens, (std::vector<size_t>{6}));
+
+    ASSERT_THROW(scheduler.add_sequence(2, 1), ov::Exception);
+    ASSERT_THROW(scheduler.remove_sequence(1), ov::Exception);
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/cpu_opset/common/op/image_preprocess.hpp>
+#include <transformations/cpu_opset/common/pass/image_preprocess_fusion.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+using InterpolateMode = ov::op::util::InterpolateBase::InterpolateMode;
+
+const std::vector<float> mean = {123.675f, 116.28f, 103.53f};
+const std::vector<float> stdev = {58.395f, 57.12f, 57.375f};
+
+std::shared_ptr<ov::Node> makeConst(ov::element::Type type, const ov::Shape& shape, const std::vector<float>& values) {
+    return ov::opset1::Constant::create(type, shape, values);
+}
+
+std::shared_ptr<ov::Node> makeInterpolate(const ov::Output<ov::Node>& image,
+                                          size_t height,
+                                          size_t width,
+                                          InterpolateMode mode = InterpolateMode::LINEAR) {
+    ov::op::util::InterpolateBase::InterpolateAttrs attrs(mode,
+                                                          ov::op::util::InterpolateBase::ShapeCalcMode::SIZES,
+                                                          {0, 0},
+                                                          {0, 0});
+    return std::make_shared<ov::opset11::Interpolate>(
+        image,
+        makeConst(ov::element::i64, {2}, {static_cast<float>(height), static_cast<float>(width)}),
+        makeConst(ov::element::i64, {2}, {1, 2}),
+        attrs);
+}
+
+// u8 BGR NHWC -> Convert -> reverse channels -> resize -> (x - mean) / std -> NCHW
+std::shared_ptr<ov::Model> buildBGRPreprocess(InterpolateMode mode) {
+    auto image = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{-1, 1080, 1920, 3});
+    auto convert = std::make_shared<ov::opset1::Convert>(image, ov::element::f32);
+    auto reverse = std::make_shared<ov::opset8::Gather>(convert,
+                                                        makeConst(ov::element::i64, {3}, {2, 1, 0}),
+                                                        makeConst(ov::element::i64, {}, {3}));
+    auto resize = makeInterpolate(reverse, 224, 224, mode);
+    auto sub = std::make_shared<ov::opset1::Subtract>(resize, makeConst(ov::element::f32, {1, 1, 1, 3}, mean));
+    auto div = std::make_shared<ov::opset1::Divide>(sub, makeConst(ov::element::f32, {1, 1, 1, 3}, stdev));
+    auto transpose = std::make_shared<ov::opset1::Transpose>(div, makeConst(ov::element::i64, {4}, {0, 3, 1, 2}));
+    auto relu = std::make_shared<ov::opset1::Relu>(transpose);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{image});
+}
+}  // namespace
+
+TEST_F(TransformationTestsF, ImagePreprocessFusion_BGR_Planar) {
+    comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    disable_rt_info_check();
+    model = buildBGRPreprocess(InterpolateMode::LINEAR);
+    manager.register_pass<ImagePreprocessFusion>();
+
+    ImagePreprocessNode::Config config;
+    config.out_height = 224;
+    config.out_width = 224;
+    config.channel_order = {2, 1, 0};
+    for (size_t c = 0; c < 3; c++) {
+        config.scale[c] = 1.f / stdev[c];
+        config.shift[c] = -mean[c] / stdev[c];
+    }
+    config.planar_output = true;
+    auto image = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{-1, 1080, 1920, 3});
+    auto preprocess = std::make_shared<ImagePreprocessNode>(ov::OutputVector{image}, config);
+    auto relu = std::make_shared<ov::opset1::Relu>(preprocess);
+    model_ref = std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{image});
+}
+
+TEST_F(TransformationTestsF, ImagePreprocessFusion_NV12_TwoPlanes) {
+    comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    disable_rt_info_check();
+    {
+        auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 1080, 1920, 1});
+        auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 540, 960, 2});
+        auto rgb = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+        auto convert = std::make_shared<ov::opset1::Convert>(rgb, ov::element::f32);
+        ov::op::util::InterpolateBase::InterpolateAttrs attrs(InterpolateMode::LINEAR_ONNX,
+                                                              ov::op::util::InterpolateBase::ShapeCalcMode::SIZES,
+                                                              {0, 0, 0, 0},
+                                                              {0, 0, 0, 0});
+        auto resize = std::make_shared<ov::opset4::Interpolate>(convert,
+                                                                makeConst(ov::element::i64, {2}, {640, 640}),
+                                                                makeConst(ov::element::f32, {2}, {0.59f, 0.33f}),
+                                                                makeConst(ov::element::i64, {2}, {-3, -2}),
+                                                                attrs);
+        auto scale = std::make_shared<ov::opset1::Multiply>(makeConst(ov::element::f32, {}, {1.f / 255.f}), resize);
+        model = std::make_shared<ov::Model>(ov::NodeVector{scale}, ov::ParameterVector{y, uv});
+    }
+    manager.register_pass<ImagePreprocessFusion>();
+
+    ImagePreprocessNode::Config config;
+    config.out_height = 640;
+    config.out_width = 640;
+    config.nv12 = true;
+    config.nv12_round = true;
+    config.scale = {1.f / 255.f, 1.f / 255.f, 1.f / 255.f};
+    auto y = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 1080, 1920, 1});
+    auto uv = std::make_shared<ov::opset1::Parameter>(ov::element::u8, ov::PartialShape{1, 540, 960, 2});
+    auto preprocess = std::make_shared<ImagePreprocessNode>(ov::OutputVector{y, uv}, config);
+    model_ref = std::make_shared<ov::Model>(ov::NodeVector{preprocess}, ov::ParameterVector{y, uv});
+}
+
+TEST_F(TransformationTestsF, ImagePreprocessFusion_Nearest_NotFused) {
+    model = buildBGRPreprocess(InterpolateMode::NEAREST);
+    manager.register_pass<ImagePreprocessFusion>();
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <openvino/opsets/opset13.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/cpu_opset/common/op/sampling.hpp>
+#include <transformations/cpu_opset/common/pass/sampling_fusion.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Node> makeScalar(ov::element::Type type, float value) {
+    return ov::opset1::Constant::create(type, ov::Shape{}, {value});
+}
+
+// logits * (1 / temperature) -> TopK -> Softmax -> top-p -> Multinomial -> Gather
+std::shared_ptr<ov::Model> buildSamplingHead(const ov::PartialShape& shape,
+                                             size_t top_k,
+                                             float top_p,
+                                             float inv_temperature,
+                                             bool log_probs = false,
+                                             bool top_p_less = false) {
+    auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+    auto scaled = std::make_shared<ov::opset1::Multiply>(logits, makeScalar(ov::element::f32, inv_temperature));
+
+    ov::Output<ov::Node> values = scaled;
+    std::shared_ptr<ov::Node> topk;
+    if (top_k) {
+        topk = std::make_shared<ov::opset11::TopK>(scaled,
+                                                   makeScalar(ov::element::i64, static_cast<float>(top_k)),
+                                                   -1,
+                                                   ov::op::TopKMode::MAX,
+                                                   ov::op::TopKSortType::SORT_VALUES,
+                                                   ov::element::i32);
+        values = topk->output(0);
+    }
+    ov::Output<ov::Node> probs = std::make_shared<ov::opset8::Softmax>(values, -1);
+    if (top_p < 1.f) {
+        auto cumsum = std::make_shared<ov::opset3::CumSum>(probs, makeScalar(ov::element::i64, -1), true, false);
+        if (top_p_less) {
+            auto mask = std::make_shared<ov::opset1::Less>(cumsum, makeScalar(ov::element::f32, top_p));
+            probs = std::make_shared<ov::opset1::Select>(mask, probs, makeScalar(ov::element::f32, 0.f));
+        } else {
+            auto mask = std::make_shared<ov::opset1::Greater>(cumsum, makeScalar(ov::element::f32, top_p));
+            probs = std::make_shared<ov::opset1::Select>(mask, makeScalar(ov::element::f32, 0.f), probs);
+        }
+    }
+    auto samples = std::make_shared<ov::opset13::Multinomial>(probs,
+                                                              makeScalar(ov::element::i32, 2),
+                                                              ov::element::i32,
+                                                              true,
+                                                              log_probs,
+                                                              1,
+                                                              2);
+    std::shared_ptr<ov::Node> result = samples;
+    if (top_k)
+        result = std::make_shared<ov::opset8::Gather>(topk->output(1), samples, makeScalar(ov::element::i64, 1), 1);
+    return std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{logits});
+}
+
+std::shared_ptr<ov::Model> buildSampling(const ov::PartialShape& shape, const SamplingNode::Config& config) {
+    auto logits = std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape);
+    auto sampling = std::make_shared<SamplingNode>(logits, config);
+    return std::make_shared<ov::Model>(ov::NodeVector{sampling}, ov::ParameterVector{logits});
+}
+}  // namespace
+
+TEST_F(TransformationTestsF, SamplingFusion_TopK_TopP) {
+    disable_rt_info_check();
+    comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    model = buildSamplingHead(ov::PartialShape{-1, 32000}, 50, 0.9f, 2.f);
+    manager.register_pass<SamplingFusion>();
+
+    SamplingNode::Config config;
+    config.top_k = 50;
+    config.top_p = 0.9f;
+    config.inv_temperature = 2.f;
+    config.topk_indices = true;
+    config.num_samples = 2;
+    config.with_replacement = true;
+    config.global_seed = 1;
+    config.op_seed = 2;
+    config.output_type = ov::element::i32;
+    model_ref = buildSampling(ov::PartialShape{-1, 32000}, config);
+}
+
+TEST_F(TransformationTestsF, SamplingFusion_TopK_TopP_Less) {
+    disable_rt_info_check();
+    comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    model = buildSamplingHead(ov::PartialShape{-1, 32000}, 50, 0.9f, 2.f, false, true);
+    manager.register_pass<SamplingFusion>();
+
+    SamplingNode::Config config;
+    config.top_k = 50;
+    config.top_p = 0.9f;
+    config.top_p_strict = true;
+    config.inv_temperature = 2.f;
+    config.topk_indices = true;
+    config.num_samples = 2;
+    config.with_replacement = true;
+    config.global_seed = 1;
+    config.op_seed = 2;
+    config.output_type = ov::element::i32;
+    model_ref = buildSampling(ov::PartialShape{-1, 32000}, config);
+}
+
+TEST_F(TransformationTestsF, SamplingFusion_FullVocab) {
+    disable_rt_info_check();
+    model = buildSamplingHead(ov::PartialShape{-1, -1}, 0, 1.f, 0.5f);
+    manager.register_pass<SamplingFusion>();
+
+    SamplingNode::Config config;
+    config.inv_temperature = 0.5f;
+    config.num_samples = 2;
+    config.with_replacement = true;
+    config.global_seed = 1;
+    config.op_seed = 2;
+    model_ref = buildSampling(ov::PartialShape{-1, -1}, config);
+}
+
+TEST_F(TransformationTestsF, SamplingFusion_LogProbs_NotFused) {
+    model = buildSamplingHead(ov::PartialShape{-1, 32000}, 50, 1.f, 1.f, true);
+    manager.register_pass<SamplingFusion>();
+}
+
+// nothing is below zero, such a mask drops the whole distribution
+TEST_F(TransformationTestsF, SamplingFusion_TopP_LessZero_NotFused) {
+    model = buildSamplingHead(ov::PartialShape{-1, 32000}, 50, 0.f, 1.f, false, true);
+    manager.register_pass<SamplingFusion>();
+}
@@ -0,0 +1,230 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <openvino/opsets/opset7.hpp>
+#include <openvino/pass/manager.hpp>
+#include <transformations/cpu_opset/common/op/fully_connected.hpp>
+#include <transformations/cpu_opset/common/pass/split_mlp.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "transformations/rt_info/decompression.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+constexpr size_t hidden_size = 1024;
+constexpr size_t inner_size = 8192;
+
+std::shared_ptr<ov::Node> makeWeights(const ov::Shape& shape, bool compressed) {
+    if (!compressed)
+        return ov::opset1::Constant::create(ov::element::f32, shape, {0.5f});
+    auto wgt = ov::opset1::Constant::create(ov::element::f16, shape, {0.5f});
+    auto convert = std::make_shared<ov::opset1::Convert>(wgt, ov::element::f32);
+    ov::mark_as_decompression(convert);
+    return convert;
+}
+
+std::shared_ptr<ov::Node> splitWeights(const std::shared_ptr<ov::Node>& wgt, int64_t dim, bool compressed) {
+    auto constant = compressed ? wgt->get_input_node_shared_ptr(0) : wgt;
+    auto split_dim = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {dim});
+    auto split_length = ov::opset1::Constant::create<int32_t>(ov::element::i32, ov::Shape{2}, {4096, 4096});
+    return std::make_shared<ov::opset1::VariadicSplit>(constant, split_dim, split_length);
+}
+
+ov::Output<ov::Node> splitPart(const std::shared_ptr<ov::Node>& split, size_t i, bool compressed) {
+    if (!compressed)
+        return split->output(i);
+    auto convert = std::make_shared<ov::opset1::Convert>(split->output(i), ov::element::f32);
+    ov::mark_as_decompression(convert);
+    return convert;
+}
+
+std::shared_ptr<ov::Node> makeActivation(const ov::Output<ov::Node>& input, bool gated) {
+    if (gated)
+        return std::make_shared<ov::opset4::Swish>(input);
+    return std::make_shared<ov::opset7::Gelu>(input);
+}
+
+// gated: FC_down(Swish(FC_gate(X)) * FC_up(X)), otherwise FC_down(Gelu(FC_up(X)))
+std::shared_ptr<ov::Model> buildMLP(bool gated, bool compressed) {
+    auto src = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4, hidden_size});
+    auto up = std::make_shared<FullyConnectedNode>(src, makeWeights({inner_size, hidden_size}, compressed), ov::Rank(3));
+    std::shared_ptr<ov::Node> hidden;
+    if (gated) {
+        auto gate =
+            std::make_shared<FullyConnectedNode>(src, makeWeights({inner_size, hidden_size}, compressed), ov::Rank(3));
+        hidden = std::make_shared<ov::opset1::Multiply>(makeActivation(gate, true), up);
+    } else {
+        hidden = makeActivation(up, false);
+    }
+    auto down = std::make_shared<FullyConnectedNode>(hidden, makeWeights({hidden_size, inner_size}, compressed), ov::Rank(3));
+    return std::make_shared<ov::Model>(ov::NodeVector{down}, ov::ParameterVector{src});
+}
+
+std::shared_ptr<ov::Model> buildSplitMLP(bool gated, bool compressed) {
+    auto src = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4, hidden_size});
+    auto up_wgts = splitWeights(makeWeights({inner_size, hidden_size}, compressed), 0, compressed);
+    auto gate_wgts = splitWeights(makeWeights({inner_size, hidden_size}, compressed), 0, compressed);
+    auto down_wgts = splitWeights(makeWeights({hidden_size, inner_size}, compressed), 1, compressed);
+
+    ov::NodeVector partial_results;
+    for (size_t i = 0; i < 2; i++) {
+        auto up = std::make_shared<FullyConnectedNode>(src, splitPart(up_wgts, i, compressed), ov::Rank(3));
+        std::shared_ptr<ov::Node> hidden;
+        if (gated) {
+            auto gate = std::make_shared<FullyConnectedNode>(src, splitPart(gate_wgts, i, compressed), ov::Rank(3));
+            hidden = std::make_shared<ov::opset1::Multiply>(makeActivation(gate, true), up);
+        } else {
+            hidden = makeActivation(up, false);
+        }
+        partial_results.push_back(
+            std::make_shared<FullyConnectedNode>(hidden, splitPart(down_wgts, i, compressed), ov::Rank(3)));
+    }
+    auto sum = std::make_shared<ov::opset1::Add>(partial_results[0], partial_results[1]);
+    return std::make_shared<ov::Model>(ov::NodeVector{sum}, ov::ParameterVector{src});
+}
+
+// (Convert(W) - Convert(ZP)) * Scale, per output channel for [OC, IC] weights. Grouped weights [OC, G, IC / G]
+// have a scale per group, a scalar zero point and are reshaped to [OC, IC].
+std::shared_ptr<ov::Node> makeCompressedWeights(const ov::Shape& shape, size_t group_size) {
+    const bool grouped = group_size != 0;
+    const auto wgt_shape = grouped ? ov::Shape{shape[0], shape[1] / group_size, group_size} : shape;
+    const auto scale_shape = grouped ? ov::Shape{shape[0], shape[1] / group_size, 1} : ov::Shape{shape[0], 1};
+    const auto zp_shape = grouped ? ov::Shape{1} : ov::Shape{shape[0], 1};
+    auto wgt = ov::opset1::Constant::create(ov::element::u8, wgt_shape, {3});
+    auto cvt_wgt = std::make_shared<ov::opset1::Convert>(wgt, ov::element::f32);
+    auto zp = ov::opset1::Constant::create(ov::element::u8, zp_shape, {1});
+    auto cvt_zp = std::make_shared<ov::opset1::Convert>(zp, ov::element::f32);
+    auto sub = std::make_shared<ov::opset1::Subtract>(cvt_wgt, cvt_zp);
+    auto scale = ov::opset1::Constant::create(ov::element::f32, scale_shape, {0.25f});
+    auto mul = std::make_shared<ov::opset1::Multiply>(sub, scale);
+    if (!grouped)
+        return mul;
+    auto pattern = ov::opset1::Constant::create(ov::element::i32, ov::Shape{2}, shape);
+    return std::make_shared<ov::opset1::Reshape>(mul, pattern, false);
+}
+
+// the decompression repeated for every half of the weights split along dim
+ov::OutputVector splitCompressedWeights(const ov::Shape& shape, size_t dim, size_t group_size) {
+    const bool grouped = group_size != 0;
+    const auto wgt_shape = grouped ? ov::Shape{shape[0], shape[1] / group_size, group_size} : shape;
+    const auto scale_shape = grouped ? ov::Shape{shape[0], shape[1] / group_size, 1} : ov::Shape{shape[0], 1};
+    const int32_t part = static_cast<int32_t>(wgt_shape[dim] / 2);
+    auto split_dim = ov::opset1::Constant::create(ov::element::i32, ov::Shape{}, {dim});
+    auto split_length = ov::opset1::Constant::create<int32_t>(ov::element::i32, ov::Shape{2}, {part, part});
+
+    auto wgt = ov::opset1::Constant::create(ov::element::u8, wgt_shape, {3});
+    auto split_wgt = std::make_shared<ov::opset1::VariadicSplit>(wgt, split_dim, split_length);
+    auto scale = ov::opset1::Constant::create(ov::element::f32, scale_shape, {0.25f});
+    auto split_scale = std::make_shared<ov::opset1::VariadicSplit>(scale, split_dim, split_length);
+    std::shared_ptr<ov::Node> split_zp;
+    if (!grouped) {
+        auto zp = ov::opset1::Constant::create(ov::element::u8, ov::Shape{shape[0], 1}, {1});
+        split_zp = std::make_shared<ov::opset1::VariadicSplit>(zp, split_dim, split_length);
+    }
+
+    ov::OutputVector parts;
+    for (size_t i = 0; i < 2; i++) {
+        auto cvt_wgt = std::make_shared<ov::opset1::Convert>(split_wgt->output(i), ov::element::f32);
+        ov::Output<ov::Node> zp = split_zp ? split_zp->output(i)
+                                           : ov::opset1::Constant::create(ov::element::u8, ov::Shape{1}, {1})->output(0);
+        auto cvt_zp = std::make_shared<ov::opset1::Convert>(zp, ov::element::f32);
+        auto sub = std::make_shared<ov::opset1::Subtract>(cvt_wgt, cvt_zp);
+        std::shared_ptr<ov::Node> mul = std::make_shared<ov::opset1::Multiply>(sub, split_scale->output(i));
+        if (grouped) {
+            auto part_shape = shape;
+            part_shape[dim] /= 2;
+            auto pattern = ov::opset1::Constant::create(ov::element::i32, ov::Shape{2}, part_shape);
+            mul = std::make_shared<ov::opset1::Reshape>(mul, pattern, false);
+        }
+        parts.push_back(mul);
+    }
+    return parts;
+}
+}  // namespace
+
+TEST_F(TransformationTestsF, SplitMLPTest_Gated) {
+    disable_rt_info_check();
+    model = buildMLP(true, false);
+    manager.register_pass<SplitMLP>(1);
+    model_ref = buildSplitMLP(true, false);
+}
+
+TEST_F(TransformationTestsF, SplitMLPTest_Gelu_f16_weight) {
+    disable_rt_info_check();
+    model = buildMLP(false, true);
+    manager.register_pass<SplitMLP>(1);
+    model_ref = buildSplitMLP(false, true);
+}
+
+TEST_F(TransformationTestsF, SplitMLPTest_ParallelDomain) {
+    model = buildMLP(true, false);
+    ov::pass::Manager m;
+    m.register_pass<SplitMLP>(1);
+    m.run_passes(model);
+
+    size_t marked = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (op->get_rt_info().count("parallelDomain"))
+            marked++;
+    }
+    // up, gate, swish, multiply and down projections of both shards
+    ASSERT_EQ(marked, 10);
+    model_ref = buildSplitMLP(true, false);
+    disable_rt_info_check();
+}
+
+// u8 weights with zero points and scales: per channel for up and gate projections, per group for down projection
+TEST_F(TransformationTestsF, SplitMLPTest_Gated_u8_decompression) {
+    disable_rt_info_check();
+    constexpr size_t group_size = 128;
+    {
+        auto src = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4, hidden_size});
+        auto up = std::make_shared<FullyConnectedNode>(src, makeCompressedWeights({inner_size, hidden_size}, 0), ov::Rank(3));
+        auto gate =
+            std::make_shared<FullyConnectedNode>(src, makeCompressedWeights({inner_size, hidden_size}, 0), ov::Rank(3));
+        auto hidden = std::make_shared<ov::opset1::Multiply>(makeActivation(gate, true), up);
+        auto down = std::make_shared<FullyConnectedNode>(hidden,
+                                                         makeCompressedWeights({hidden_size, inner_size}, group_size),
+                                                         ov::Rank(3));
+        model = std::make_shared<ov::Model>(ov::NodeVector{down}, ov::ParameterVector{src});
+        manager.register_pass<SplitMLP>(1);
+    }
+    {
+        auto src = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4, hidden_size});
+        auto up_wgts = splitCompressedWeights({inner_size, hidden_size}, 0, 0);
+        auto gate_wgts = splitCompressedWeights({inner_size, hidden_size}, 0, 0);
+        auto down_wgts = splitCompressedWeights({hidden_size, inner_size}, 1, group_size);
+
+        ov::NodeVector partial_results;
+        for (size_t i = 0; i < 2; i++) {
+            auto up = std::make_shared<FullyConnectedNode>(src, up_wgts[i], ov::Rank(3));
+            auto gate = std::make_shared<FullyConnectedNode>(src, gate_wgts[i], ov::Rank(3));
+            auto hidden = std::make_shared<ov::opset1::Multiply>(makeActivation(gate, true), up);
+            partial_results.push_back(std::make_shared<FullyConnectedNode>(hidden, down_wgts[i], ov::Rank(3)));
+        }
+        auto sum = std::make_shared<ov::opset1::Add>(partial_results[0], partial_results[1]);
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{sum}, ov::ParameterVector{src});
+    }
+}
+
+// a split of the down projection by input channels must not break a group of scales
+TEST_F(TransformationTestsF, SplitMLPTest_Gelu_group_not_divisible) {
+    auto src = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4, hidden_size});
+    auto up = std::make_shared<FullyConnectedNode>(src, makeCompressedWeights({inner_size, hidden_size}, 0), ov::Rank(3));
+    auto hidden = makeActivation(up, false);
+    auto down = std::make_shared<FullyConnectedNode>(hidden,
+                                                     makeCompressedWeights({hidden_size, inner_size}, inner_size),
+                                                     ov::Rank(3));
+    model = std::make_shared<ov::Model>(ov::NodeVector{down}, ov::ParameterVector{src});
+    manager.register_pass<SplitMLP>(1);
+}
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include <openvino/opsets/opset13.hpp>
+#include <transformations/cpu_opset/common/op/rope.hpp>
 #include <transformations/cpu_opset/common/op/sdpa.hpp>
 #include <transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp>
 #include <transformations/init_node_info.hpp>
@@ -158,3 +159,71 @@ TEST(TransformationTests, StateConcatSDPAMixtral) {
         ASSERT_TRUE(res.first) << res.second;
     }
 }
+
+static std::shared_ptr<ov::Model> makeSDPAWithRoPE(bool isRef = false) {
+    // GPT-NeoX like: q & k are sliced from the same [B, L, H, 3*S] projection and rotated with shared cos/sin
+    const size_t H = 8, S = 64, rotary_ndims = 32;
+    auto qkv = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{-1, -1, H, 3 * S});
+    auto v = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{-1, H, -1, S});
+    auto cos = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{1, 1, -1, rotary_ndims});
+    auto sin = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{1, 1, -1, rotary_ndims});
+    auto position_ids = std::make_shared<ov::op::v0::Parameter>(element::i32, ov::PartialShape{-1, -1});
+    auto beam_idx = std::make_shared<ov::op::v0::Parameter>(element::i32, ov::PartialShape{-1});
+    auto kvShape = ov::PartialShape{-1, H, -1, S};
+    auto var_k = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{kvShape, element::f32, "pastk"});
+    auto var_v = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{kvShape, element::f32, "pastv"});
+    auto pastk = std::make_shared<ov::op::v6::ReadValue>(var_k);
+    auto pastv = std::make_shared<ov::op::v6::ReadValue>(var_v);
+
+    RoPENode::Config rope_config;
+    rope_config.input_trans0213 = true;
+    rope_config.rotary_ndims = rotary_ndims;
+    rope_config.gather_position_arg_id = 3;
+    ov::intel_cpu::ScaledDotProductAttentionWithKVCache::Config config;
+    config.fuse_concat = true;
+    std::shared_ptr<ov::intel_cpu::ScaledDotProductAttentionWithKVCache> sdp;
+    if (isRef) {
+        config.fuse_rope = true;
+        config.rope_rotary_ndims = rotary_ndims;
+        config.rope_input_trans0213 = true;
+        config.rope_slice_q = {0, S};
+        config.rope_slice_k = {S, 2 * S};
+        config.rope_gather_position = true;
+        sdp = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(
+            OutputVector{qkv, qkv, v, cos, sin, position_ids, beam_idx, pastk, pastv}, config);
+    } else {
+        auto config_q = rope_config;
+        config_q.slice_start = 0;
+        config_q.slice_stop = S;
+        auto config_k = rope_config;
+        config_k.slice_start = S;
+        config_k.slice_stop = 2 * S;
+        auto q = std::make_shared<RoPENode>(OutputVector{qkv, cos, sin, position_ids}, config_q);
+        auto k = std::make_shared<RoPENode>(OutputVector{qkv, cos, sin, position_ids}, config_k);
+        sdp = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(
+            OutputVector{q, k, v, beam_idx, pastk, pastv}, config);
+    }
+    auto pastk_assign = std::make_shared<op::v6::Assign>(sdp->output(1), var_k);
+    auto pastv_assign = std::make_shared<op::v6::Assign>(sdp->output(2), var_v);
+    auto add = std::make_shared<op::v1::Add>(sdp->output(0), op::v0::Constant::create(element::f32, {1}, {1.0f}));
+
+    ResultVector results{std::make_shared<ov::op::v0::Result>(add)};
+    SinkVector sinks{pastk_assign, pastv_assign};
+    return std::make_shared<Model>(results, sinks, ParameterVector{qkv, v, cos, sin, position_ids, beam_idx}, "RoPESDP");
+}
+
+TEST(TransformationTests, StateConcatSDPAWithRoPE) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        f = makeSDPAWithRoPE();
+        pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<SDPARoPEFusion>();
+        m.run_passes(f);
+    }
+    f_ref = makeSDPAWithRoPE(true);
+    auto comparator = FunctionsComparator::with_default();
+    comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+    const auto res = comparator.compare(f, f_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
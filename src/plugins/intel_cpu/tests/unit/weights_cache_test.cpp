@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// byte-wise ECMA-182 CRC, the reference all the optimized paths must stay bit exact with
+uint64_t referenceHash(const unsigned char* data, size_t size) {
+    uint64_t table[256];
+    for (int i = 0; i < 256; i++) {
+        uint64_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+        table[i] = c;
+    }
+    uint64_t crc = 0;
+    for (size_t idx = 0; idx < size; idx++)
+        crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::vector<unsigned char> randomData(size_t size) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<unsigned char> data(size);
+    for (auto& byte : data)
+        byte = static_cast<unsigned char>(dist(gen));
+    return data;
+}
+}  // namespace
+
+TEST(SimpleDataHashTests, MatchesReference) {
+    constexpr size_t MiB = 1 << 20;
+    const auto data = randomData(4 * MiB + 12345);
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+
+    for (size_t size : {size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(1000),
+                        MiB - 1, MiB, MiB + 1, 2 * MiB, 2 * MiB + 3, 3 * MiB + 17, data.size()}) {
+        ASSERT_EQ(hashFunc.hash(data.data(), size), referenceHash(data.data(), size)) << "size: " << size;
+    }
+}
+
+TEST(SimpleDataHashTests, UnalignedInput) {
+    const auto data = randomData((3 << 20) + 64);
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+
+    for (size_t offset = 1; offset < 8; offset++) {
+        const size_t size = data.size() - offset;
+        ASSERT_EQ(hashFunc.hash(data.data() + offset, size), referenceHash(data.data() + offset, size))
+            << "offset: " << offset;
+    }
+}